@@ -0,0 +1,80 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+namespace util {
+
+/**
+ * Compress @p data with a fast LZ77 style coder. Repeated sequences of at least four bytes within
+ * a window of 64KB are replaced by references to their previous occurrence, which makes long runs
+ * of equal bytes very cheap. Incompressible data grows by less than 1%.
+ * @see decompressLZ
+ */
+IVW_CORE_API std::vector<std::byte> compressLZ(std::span<const std::byte> data);
+
+/**
+ * Decompress data compressed by compressLZ into @p data, which must have the size of the original
+ * data.
+ * @throws Exception if @p compressed is corrupt or does not match the size of @p data
+ */
+IVW_CORE_API void decompressLZ(std::span<const std::byte> compressed, std::span<std::byte> data);
+
+/**
+ * Lossless compression of a brick of voxels. The data is treated as a sequence of components of
+ * @p componentSize bytes, with @p components components per voxel. Each component is replaced by
+ * its difference to the same component of the previous voxel, the bytes of the differences are
+ * grouped by significance, and the result is compressed by compressLZ. Smooth data and labels then
+ * turn into long runs of zeros. Floating point components are differenced as integers, which keeps
+ * the compression lossless. Falls back to storing the data uncompressed when that is smaller.
+ * @see decompressBrick
+ */
+IVW_CORE_API std::vector<std::byte> compressBrick(std::span<const std::byte> data,
+                                                  size_t componentSize, size_t components);
+
+/**
+ * Decompress a brick compressed by compressBrick into @p data, which must have the size of the
+ * original data. @p componentSize and @p components must match the ones used for compression.
+ * @throws Exception if @p compressed is corrupt or does not match the size of @p data
+ */
+IVW_CORE_API void decompressBrick(std::span<const std::byte> compressed, std::span<std::byte> data,
+                                  size_t componentSize, size_t components);
+
+}  // namespace util
+
+}  // namespace inviwo
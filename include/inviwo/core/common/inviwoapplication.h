@@ -101,6 +101,7 @@ class TimerThread;
 class FileSystemObserver;
 
 class LayerRamResizer;
+class NetworkTraceObserver;
 
 /**
  * \class InviwoApplication
@@ -495,6 +496,7 @@ protected:
     std::unique_ptr<WorkspaceManager> workspaceManager_;
     std::unique_ptr<PropertyPresetManager> propertyPresetManager_;
     std::unique_ptr<PortInspectorManager> portInspectorManager_;
+    std::unique_ptr<NetworkTraceObserver> networkTraceObserver_;
     WorkspaceManager::ClearHandle networkClearHandle_;
     WorkspaceManager::SerializationHandle networkSerializationHandle_;
     WorkspaceManager::DeserializationHandle networkDeserializationHandle_;
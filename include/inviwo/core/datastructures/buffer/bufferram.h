@@ -38,6 +38,8 @@
 #include <inviwo/core/util/stdextensions.h>
 
 #include <initializer_list>
+#include <memory>
+#include <vector>
 
 namespace inviwo {
 
@@ -148,11 +150,18 @@ public:
     explicit BufferRAMPrecision(BufferUsage usage = BufferUsage::Static);
     explicit BufferRAMPrecision(size_t size, BufferUsage usage = BufferUsage::Static);
     explicit BufferRAMPrecision(std::vector<T> data, BufferUsage usage = BufferUsage::Static);
+    /**
+     * Copies share the data until one of them is written to. All non-const accessors, like
+     * getDataContainer(), add() and set(), first copy the data if it is shared. References and
+     * pointers from them stay valid until the buffer is copied or resized.
+     */
     BufferRAMPrecision(const BufferRAMPrecision<T, Target>& rhs) = default;
     BufferRAMPrecision<T, Target>& operator=(const BufferRAMPrecision<T, Target>& that) = default;
     virtual ~BufferRAMPrecision() = default;
     virtual BufferRAMPrecision<T, Target>* clone() const override;
 
+    virtual void detach() override;
+
     virtual void setSize(size_t size) override;
     virtual size_t getSize() const override;
 
@@ -198,7 +207,7 @@ public:
     virtual void clear() override;
 
 private:
-    std::vector<T> data_;
+    std::shared_ptr<std::vector<T>> data_;
 };
 
 using FloatBufferRAM = BufferRAMPrecision<float>;
@@ -210,12 +219,13 @@ using IndexBufferRAM = BufferRAMPrecision<std::uint32_t, BufferTarget::Index>;
 
 template <typename T, BufferTarget Target>
 const T& BufferRAMPrecision<T, Target>::operator[](size_t i) const {
-    return data_[i];
+    return (*data_)[i];
 }
 
 template <typename T, BufferTarget Target>
 T& BufferRAMPrecision<T, Target>::operator[](size_t i) {
-    return data_[i];
+    detach();
+    return (*data_)[i];
 }
 
 template <typename T, BufferTarget Target>
@@ -224,172 +234,205 @@ BufferRAMPrecision<T, Target>::BufferRAMPrecision(BufferUsage usage)
 
 template <typename T, BufferTarget Target>
 BufferRAMPrecision<T, Target>::BufferRAMPrecision(size_t size, BufferUsage usage)
-    : BufferRAM(DataFormat<T>::get(), usage, Target), data_(size) {}
+    : BufferRAM(DataFormat<T>::get(), usage, Target)
+    , data_(std::make_shared<std::vector<T>>(size)) {}
 
 template <typename T, BufferTarget Target>
 BufferRAMPrecision<T, Target>::BufferRAMPrecision(std::vector<T> data, BufferUsage usage)
-    : BufferRAM(DataFormat<T>::get(), usage, Target), data_(std::move(data)) {}
+    : BufferRAM(DataFormat<T>::get(), usage, Target)
+    , data_(std::make_shared<std::vector<T>>(std::move(data))) {}
 
 template <typename T, BufferTarget Target>
 BufferRAMPrecision<T, Target>* BufferRAMPrecision<T, Target>::clone() const {
     return new BufferRAMPrecision<T, Target>(*this);
 }
 
+template <typename T, BufferTarget Target>
+void BufferRAMPrecision<T, Target>::detach() {
+    if (data_.use_count() > 1) data_ = std::make_shared<std::vector<T>>(*data_);
+}
+
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setSize(size_t size) {
-    return data_.resize(size);
+    detach();
+    return data_->resize(size);
 }
 
 template <typename T, BufferTarget Target>
 size_t BufferRAMPrecision<T, Target>::getSize() const {
-    return data_.size();
+    return data_->size();
 }
 
 template <typename T, BufferTarget Target>
 void* BufferRAMPrecision<T, Target>::getData() {
-    return (data_.empty() ? nullptr : data_.data());
+    detach();
+    auto& data = *data_;
+    return (data.empty() ? nullptr : data.data());
 }
 
 template <typename T, BufferTarget Target>
 const void* BufferRAMPrecision<T, Target>::getData() const {
-    return (data_.empty() ? nullptr : data_.data());
+    return (data_->empty() ? nullptr : data_->data());
 }
 
 template <typename T, BufferTarget Target>
 std::vector<T>& BufferRAMPrecision<T, Target>::getDataContainer() {
-    return data_;
+    detach();
+    return *data_;
 }
 
 template <typename T, BufferTarget Target>
 const std::vector<T>& BufferRAMPrecision<T, Target>::getDataContainer() const {
-    return data_;
+    return *data_;
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::reserve(size_t size) {
-    data_.reserve(size);
+    detach();
+    data_->reserve(size);
 }
 
 template <typename T, BufferTarget Target>
 double BufferRAMPrecision<T, Target>::getAsDouble(const size_t& pos) const {
-    return util::glm_convert<double>(data_[pos]);
+    return util::glm_convert<double>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec2 BufferRAMPrecision<T, Target>::getAsDVec2(const size_t& pos) const {
-    return util::glm_convert<dvec2>(data_[pos]);
+    return util::glm_convert<dvec2>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec3 BufferRAMPrecision<T, Target>::getAsDVec3(const size_t& pos) const {
-    return util::glm_convert<dvec3>(data_[pos]);
+    return util::glm_convert<dvec3>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec4 BufferRAMPrecision<T, Target>::getAsDVec4(const size_t& pos) const {
-    return util::glm_convert<dvec4>(data_[pos]);
+    return util::glm_convert<dvec4>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromDouble(const size_t& pos, double val) {
-    data_[pos] = util::glm_convert<T>(val);
+    detach();
+    (*data_)[pos] = util::glm_convert<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromDVec2(const size_t& pos, dvec2 val) {
-    data_[pos] = util::glm_convert<T>(val);
+    detach();
+    (*data_)[pos] = util::glm_convert<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromDVec3(const size_t& pos, dvec3 val) {
-    data_[pos] = util::glm_convert<T>(val);
+    detach();
+    (*data_)[pos] = util::glm_convert<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromDVec4(const size_t& pos, dvec4 val) {
-    data_[pos] = util::glm_convert<T>(val);
+    detach();
+    (*data_)[pos] = util::glm_convert<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 double BufferRAMPrecision<T, Target>::getAsNormalizedDouble(const size_t& pos) const {
-    return util::glm_convert_normalized<double>(data_[pos]);
+    return util::glm_convert_normalized<double>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec2 BufferRAMPrecision<T, Target>::getAsNormalizedDVec2(const size_t& pos) const {
-    return util::glm_convert_normalized<dvec2>(data_[pos]);
+    return util::glm_convert_normalized<dvec2>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec3 BufferRAMPrecision<T, Target>::getAsNormalizedDVec3(const size_t& pos) const {
-    return util::glm_convert_normalized<dvec3>(data_[pos]);
+    return util::glm_convert_normalized<dvec3>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec4 BufferRAMPrecision<T, Target>::getAsNormalizedDVec4(const size_t& pos) const {
-    return util::glm_convert_normalized<dvec4>(data_[pos]);
+    return util::glm_convert_normalized<dvec4>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromNormalizedDouble(const size_t& pos, double val) {
-    data_[pos] = util::glm_convert_normalized<T>(val);
+    detach();
+    (*data_)[pos] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromNormalizedDVec2(const size_t& pos, dvec2 val) {
-    data_[pos] = util::glm_convert_normalized<T>(val);
+    detach();
+    (*data_)[pos] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromNormalizedDVec3(const size_t& pos, dvec3 val) {
-    data_[pos] = util::glm_convert_normalized<T>(val);
+    detach();
+    (*data_)[pos] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromNormalizedDVec4(const size_t& pos, dvec4 val) {
-    data_[pos] = util::glm_convert_normalized<T>(val);
+    detach();
+    (*data_)[pos] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::add(const T& item) {
-    data_.push_back(item);
+    detach();
+    data_->push_back(item);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::add(std::initializer_list<T> data) {
+    detach();
+    auto& vec = *data_;
     for (auto& elem : data) {
-        data_.push_back(elem);
+        vec.push_back(elem);
     }
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::append(const std::vector<T>* data) {
-    data_.insert(data_.end(), data->begin(), data->end());
+    detach();
+    auto& vec = *data_;
+    vec.insert(vec.end(), data->begin(), data->end());
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::append(const std::vector<T>& data) {
-    data_.insert(data_.end(), data.begin(), data.end());
+    detach();
+    auto& vec = *data_;
+    vec.insert(vec.end(), data.begin(), data.end());
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::set(size_t index, const T& item) {
-    data_[index] = item;
+    detach();
+    (*data_)[index] = item;
 }
 
 template <typename T, BufferTarget Target>
 T BufferRAMPrecision<T, Target>::get(size_t index) const {
-    return data_[index];
+    return (*data_)[index];
 }
 
 template <typename T, BufferTarget Target>
 T& BufferRAMPrecision<T, Target>::get(size_t index) {
-    return data_[index];
+    detach();
+    return (*data_)[index];
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::clear() {
-    data_.clear();
+    if (data_.use_count() > 1) {
+        data_ = std::make_shared<std::vector<T>>();
+    } else {
+        data_->clear();
+    }
 }
 
 namespace detail {
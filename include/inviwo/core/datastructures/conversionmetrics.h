@@ -0,0 +1,108 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * \brief Counts the representation conversions done by Data::getRepresentation.
+ *
+ * Each step of a conversion is recorded per converter, i.e. per pair of source and destination
+ * representation type, with the number of conversions, the number of bytes of the created or
+ * updated representations, and the time spent in the converter. This makes it possible to find
+ * pipelines where data keeps bouncing between representations, like a volume that is downloaded
+ * from the GPU and uploaded again on each evaluation.
+ *
+ * Example:
+ * ```{.cpp}
+ * ConversionMetrics::reset();
+ * // Evaluate the network a few times
+ * LogInfoCustom("Conversions", ConversionMetrics::report());
+ * ```
+ */
+class IVW_CORE_API ConversionMetrics {
+public:
+    using ConverterID = std::pair<std::type_index, std::type_index>;
+
+    struct Entry {
+        std::type_index from;
+        std::type_index to;
+        /** The number of conversions */
+        size_t count = 0;
+        /** The total number of bytes converted */
+        size_t bytes = 0;
+        /** The total time spent converting */
+        std::chrono::nanoseconds time{0};
+    };
+
+    /**
+     * Record one conversion of @p bytes bytes by the converter @p id, that took @p time.
+     */
+    static void record(ConverterID id, size_t bytes, std::chrono::nanoseconds time);
+
+    /**
+     * The metrics of all converters used since the last reset, ordered by the total time spent,
+     * most expensive first.
+     */
+    static std::vector<Entry> get();
+
+    /**
+     * The metrics of the converter @p id, zero if it has not been used since the last reset.
+     */
+    static Entry get(ConverterID id);
+
+    /**
+     * The total number of conversions since the last reset.
+     */
+    static size_t getCount();
+
+    /**
+     * Forget all recorded conversions.
+     */
+    static void reset();
+
+    /**
+     * A table of the recorded conversions, ordered as in get().
+     */
+    static std::string report();
+};
+
+}  // namespace inviwo
@@ -31,15 +31,25 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/datastructures/representationfactory.h>
+#include <inviwo/core/datastructures/conversionmetrics.h>
 #include <inviwo/core/datastructures/representationconverterfactory.h>
 #include <inviwo/core/datastructures/representationfactorymanager.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/idlecompressionmanager.h>
+#include <inviwo/core/datastructures/representationusage.h>
+#include <inviwo/core/datastructures/residencymanager.h>
 
 #include <inviwo/core/util/demangle.h>
+#include <inviwo/core/util/tracerecorder.h>
 
+#include <atomic>
+#include <chrono>
 #include <typeindex>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace inviwo {
 
@@ -96,7 +106,7 @@ public:
     using repr = Repr;
 
     virtual Data<Self, Repr>* clone() const = 0;
-    virtual ~Data() = default;
+    virtual ~Data();
 
     /**
      * Get a representation of type T. If there already is a valid representation of type T, just
@@ -104,6 +114,8 @@ public:
      * valid. It there is no representation of type T, create it from the last valid representation.
      * If there are no representations create a default representation and from that create a
      * representation of type T.
+     * Returning an already valid representation only takes a shared lock, hence many threads can
+     * get the same representation concurrently. Conversions are done under an exclusive lock.
      */
     template <typename T>
     const T* getRepresentation() const;
@@ -113,7 +125,9 @@ public:
 
     /**
      * Get an editable representation. This will invalidate all other representations.
-     * They will now have to be updated from this one before use.
+     * They will now have to be updated from this one before use. If the representation shares
+     * its data with a copy, the data is copied here, see DataRepresentation::detach. Pointers into
+     * the data then stay valid until the data is copied.
      * @see getRepresentation and invalidateAllOther
      */
     template <typename T>
@@ -130,6 +144,14 @@ public:
     template <typename T>
     bool hasRepresentation() const;
 
+    /**
+     * Check if a specific representation type exists and is valid, i.e. if getRepresentation
+     * can return it without any conversion.
+     * @return true if existing and valid, false otherwise.
+     */
+    template <typename T>
+    bool hasValidRepresentation() const;
+
     /**
      * Check if the Data object has any representation.
      * @return true if any representation exist, false otherwise.
@@ -178,25 +200,40 @@ protected:
 
     template <typename F, typename T>
     decltype(auto) getLastOr(F&& f, T&& fallback) const {
-        std::scoped_lock lock(mutex_);
+        std::shared_lock lock(viewMutex_);
         return lastValidRepresentation_ ? std::invoke(std::forward<F>(f), *lastValidRepresentation_)
                                         : std::forward<T>(fallback);
     }
     template <typename F, typename T>
     void setLastAndInvalidateOther(F&& f, T&& value) {
         std::scoped_lock lock(mutex_);
+        // Readers in getLastOr only hold viewMutex_, so the modification has to exclude them too.
+        std::unique_lock view{viewMutex_};
         if (lastValidRepresentation_) {
             std::invoke(std::forward<F>(f), *lastValidRepresentation_, std::forward<T>(value));
-            invalidateAllOtherInternal(lastValidRepresentation_.get());
+            invalidateAllOtherLocked(lastValidRepresentation_.get());
         }
     }
 
 private:
     void copyRepresentationsTo(Data<Self, Repr>* targetData) const;
+    /**
+     * Add the representation and set it as the last valid one
+     */
     std::shared_ptr<Repr> addRepresentationInternal(std::shared_ptr<Repr> representation) const;
+    void setLastValid(std::shared_ptr<Repr> repr) const;
     void invalidateAllOtherInternal(const Repr* repr);
+    /**
+     * Same as invalidateAllOtherInternal, but the caller must hold viewMutex_ exclusively.
+     */
+    void invalidateAllOtherLocked(const Repr* repr);
     template <typename T, typename D>
     static std::shared_ptr<T> getReprInternal(D& data);
+    /**
+     * Returns the representation of type T if it is valid, without taking the exclusive lock.
+     */
+    template <typename T>
+    std::shared_ptr<T> findValidRepr() const;
 
     std::shared_ptr<Repr> findRepr(std::type_index idx) const {
         if (auto it = representations_.find(idx); it != representations_.end()) {
@@ -206,10 +243,41 @@ private:
         }
     }
 
+    /**
+     * Returns a valid DiskRepresentation with a loader that other representations can be reloaded
+     * from, or nullptr if there is none.
+     */
+    std::shared_ptr<Repr> findReloadSource() const;
+    /**
+     * Register a use of \p repr with the ResidencyManager if it can be reloaded from the disk, and
+     * with the IdleCompressionManager. Pins \p repr if called within a RepresentationPins scope.
+     */
+    void touchResidency(const Repr& repr, bool reloadable) const;
+    /**
+     * Evict the representation of type \p type if it can be reloaded, and if it has not been used
+     * since the epoch \p usedSince. Used by the ResidencyManager.
+     */
+    static bool evictRepresentation(const void* owner, std::type_index type, size_t usedSince);
+    /**
+     * Replace the representation of type \p type with one of type \p compressed, if it has not
+     * been used since the epoch \p idleSince. Used by the IdleCompressionManager.
+     */
+    static bool compressRepresentation(const void* owner, std::type_index type,
+                                       std::type_index compressed, size_t idleSince);
+
+    // Locking: mutex_ serializes all modifications and conversions. Modifications of
+    // representations_, reloadable_, lastValidRepresentation_ and of the validity of the
+    // representations additionally hold viewMutex_ exclusively, but never while calling out to
+    // converters. Readers only need one of the two, the fast path of getRepresentation takes
+    // viewMutex_ shared. Always lock mutex_ before viewMutex_.
     mutable std::recursive_mutex mutex_;
+    mutable std::shared_mutex viewMutex_;
     mutable std::unordered_map<std::type_index, std::shared_ptr<Repr>> representations_;
     // A pointer to the the most recently updated representation. Makes updates and creation faster.
     mutable std::shared_ptr<Repr> lastValidRepresentation_;
+    // Representations that were created directly from a DiskRepresentation, @see ResidencyManager
+    mutable std::vector<std::type_index> reloadable_;
+    mutable std::atomic<bool> resident_ = false;
 };
 
 /*
@@ -224,6 +292,125 @@ Data<Self, Repr>::Data(const Data<Self, Repr>& rhs) : lastValidRepresentation_{n
     rhs.copyRepresentationsTo(this);
 }
 
+template <typename Self, typename Repr>
+Data<Self, Repr>::~Data() {
+    if (resident_) {
+        ResidencyManager::remove(this);
+        IdleCompressionManager::remove(this);
+    }
+}
+
+template <typename Self, typename Repr>
+std::shared_ptr<Repr> Data<Self, Repr>::findReloadSource() const {
+    for (const auto& [type, repr] : representations_) {
+        if (!repr->isValid()) continue;
+        if (auto disk = dynamic_cast<const DiskRepresentationBase*>(repr.get());
+            disk && disk->hasLoader()) {
+            return repr;
+        }
+    }
+    return nullptr;
+}
+
+template <typename Self, typename Repr>
+void Data<Self, Repr>::touchResidency(const Repr& repr, bool reloadable) const {
+    RepresentationPins::pin(repr.getUsage());
+    if (IdleCompressionManager::isEnabled()) {
+        resident_ = true;
+        IdleCompressionManager::touch(this, repr.getTypeIndex(), repr.getUsage(),
+                                      &compressRepresentation);
+    }
+    if (!reloadable || !ResidencyManager::isEnabled()) return;
+    resident_ = true;
+    ResidencyManager::touch(this, repr.getTypeIndex(), repr.getUsage(), util::residentBytes(repr),
+                            &evictRepresentation);
+}
+
+template <typename Self, typename Repr>
+bool Data<Self, Repr>::evictRepresentation(const void* owner, std::type_index type,
+                                           size_t usedSince) {
+    const auto* data = static_cast<const Data<Self, Repr>*>(owner);
+
+    // The data is in use by another thread, try again later.
+    std::unique_lock<std::recursive_mutex> lock{data->mutex_, std::try_to_lock};
+    if (!lock) return false;
+
+    std::unique_lock view{data->viewMutex_};
+    const auto repr = data->findRepr(type);
+    if (!repr) return true;
+
+    const auto source = data->findReloadSource();
+    if (!source || source == repr) return false;
+
+    // Held by the map, by the local copy, and maybe as the last valid representation. Any other
+    // owner is using the representation. Raw pointers are valid until the epoch after they were
+    // returned, or as long as they are pinned.
+    const long owners = data->lastValidRepresentation_ == repr ? 3 : 2;
+    if (repr.use_count() > owners) return false;
+    // Readers stamp and pin their use before they release their reference
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto& usage = repr->getUsage();
+    if (usage.isPinned() || usage.getLastResidentUse() >= usedSince) return false;
+
+    data->representations_.erase(type);
+    std::erase(data->reloadable_, type);
+    if (data->lastValidRepresentation_ == repr) data->lastValidRepresentation_ = source;
+    return true;
+}
+
+template <typename Self, typename Repr>
+bool Data<Self, Repr>::compressRepresentation(const void* owner, std::type_index type,
+                                              std::type_index compressedType, size_t idleSince) {
+    const auto* data = static_cast<const Data<Self, Repr>*>(owner);
+
+    // The data is in use by another thread, try again later.
+    std::unique_lock<std::recursive_mutex> lock{data->mutex_, std::try_to_lock};
+    if (!lock) return false;
+
+    const auto repr = data->findRepr(type);
+    if (!repr || !repr->isValid()) return true;
+
+    // Held by the map, by the local copy, and maybe as the last valid representation. Any other
+    // owner is using the representation. Raw pointers are valid until the epoch after they were
+    // returned, or as long as they are pinned, hence the representation must not have been used
+    // since idleSince or be pinned either.
+    const auto unused = [&]() {
+        const long owners = data->lastValidRepresentation_ == repr ? 3 : 2;
+        if (repr.use_count() > owners) return false;
+        // Readers stamp and pin their use before they release their reference
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto& usage = repr->getUsage();
+        return !usage.isPinned() && usage.getLastUse() < idleSince;
+    };
+    if (!unused()) return false;
+
+    auto compressed = data->findRepr(compressedType);
+    if (!compressed || !compressed->isValid()) {
+        auto factory = RepresentationFactoryManager::getRepresentationConverterFactory<Repr>();
+        const auto package = factory->getRepresentationConverter(type, compressedType);
+        if (!package || package->steps() != 1) return true;
+        const auto* converter = package->getConverters().front();
+        if (compressed) {
+            converter->update(repr, compressed);
+            std::unique_lock view{data->viewMutex_};
+            compressed->setValid(true);
+        } else {
+            compressed = converter->createFrom(repr);
+            if (!compressed) return true;
+            data->addRepresentationInternal(compressed);
+        }
+    }
+
+    std::unique_lock view{data->viewMutex_};
+    // The fast path of getRepresentation only takes viewMutex_, check again for readers that
+    // picked up the representation while it was compressed.
+    if (!unused()) return false;
+    data->representations_.erase(type);
+    std::erase(data->reloadable_, type);
+    data->lastValidRepresentation_ = compressed;
+    return true;
+}
+
 template <typename Self, typename Repr>
 Data<Self, Repr>& Data<Self, Repr>::operator=(const Data<Self, Repr>& that) {
     if (this != &that) {
@@ -242,11 +429,12 @@ std::shared_ptr<T> Data<Self, Repr>::getReprInternal(D& data) {
         if (!repr) {
             throw Exception("Failed to create default representation", IVW_CONTEXT_CUSTOM("Data"));
         }
-        data.lastValidRepresentation_ = data.addRepresentationInternal(repr);
+        data.addRepresentationInternal(repr);
     }
 
     if (auto repr = data.findRepr(requestedType); repr && repr->isValid()) {
-        data.lastValidRepresentation_ = repr;
+        data.setLastValid(repr);
+        data.touchResidency(*repr, util::contains(data.reloadable_, requestedType));
         return std::dynamic_pointer_cast<T>(repr);
     } else {
         auto factory = RepresentationFactoryManager::getRepresentationConverterFactory<Repr>();
@@ -256,19 +444,35 @@ std::shared_ptr<T> Data<Self, Repr>::getReprInternal(D& data) {
             for (auto converter : package->getConverters()) {
                 const auto dstType = converter->getConverterID().second;
                 const auto srcRepr = data.lastValidRepresentation_;
+                IVW_TRACE_SCOPE("conversion",
+                                util::demangle(converter->getConverterID().first.name()) + " -> " +
+                                    util::demangle(dstType.name()));
+                const auto start = std::chrono::steady_clock::now();
 
                 if (auto dstRepr = data.findRepr(dstType)) {
                     converter->update(srcRepr, dstRepr);
+                    std::unique_lock view{data.viewMutex_};
+                    dstRepr->setValid(true);
                     data.lastValidRepresentation_ = dstRepr;
-                    data.lastValidRepresentation_->setValid(true);
                 } else {  // No representation found, create it
                     dstRepr = converter->createFrom(srcRepr);
                     if (!dstRepr)
                         throw ConverterException("Converter failed to create",
                                                  IVW_CONTEXT_CUSTOM("Data"));
-                    data.lastValidRepresentation_ = data.addRepresentationInternal(dstRepr);
+                    data.addRepresentationInternal(dstRepr);
+                }
+                ConversionMetrics::record(converter->getConverterID(),
+                                          util::residentBytes(*data.lastValidRepresentation_),
+                                          std::chrono::steady_clock::now() - start);
+                // Representations loaded from the disk can be evicted and reloaded
+                if (auto disk = dynamic_cast<const DiskRepresentationBase*>(srcRepr.get());
+                    disk && disk->hasLoader() && !util::contains(data.reloadable_, dstType)) {
+                    std::unique_lock view{data.viewMutex_};
+                    data.reloadable_.push_back(dstType);
                 }
             }
+            data.touchResidency(*data.lastValidRepresentation_,
+                                util::contains(data.reloadable_, requestedType));
             return std::dynamic_pointer_cast<T>(data.lastValidRepresentation_);
         } else {
             auto buff = fmt::memory_buffer();
@@ -289,9 +493,27 @@ std::shared_ptr<T> Data<Self, Repr>::getReprInternal(D& data) {
     }
 };
 
+template <typename Self, typename Repr>
+template <typename T>
+std::shared_ptr<T> Data<Self, Repr>::findValidRepr() const {
+    const auto requestedType = std::type_index(typeid(T));
+    std::shared_ptr<Repr> repr;
+    bool reloadable = false;
+    {
+        std::shared_lock view{viewMutex_};
+        repr = findRepr(requestedType);
+        if (!repr || !repr->isValid()) return nullptr;
+        reloadable = ResidencyManager::isEnabled() && util::contains(reloadable_, requestedType);
+    }
+    // The ResidencyManager might evict from other threads, don't hold any lock while touching
+    touchResidency(*repr, reloadable);
+    return std::dynamic_pointer_cast<T>(repr);
+}
+
 template <typename Self, typename Repr>
 template <typename T>
 std::shared_ptr<const T> Data<Self, Repr>::getRepresentationShared() const {
+    if (auto repr = findValidRepr<const T>()) return repr;
     std::scoped_lock lock(mutex_);
     return getReprInternal<const T>(*static_cast<const Self*>(this));
 }
@@ -299,6 +521,7 @@ std::shared_ptr<const T> Data<Self, Repr>::getRepresentationShared() const {
 template <typename Self, typename Repr>
 template <typename T>
 const T* Data<Self, Repr>::getRepresentation() const {
+    if (auto repr = findValidRepr<const T>()) return repr.get();
     std::scoped_lock lock(mutex_);
     return getReprInternal<const T>(*static_cast<const Self*>(this)).get();
 }
@@ -308,6 +531,7 @@ template <typename T>
 T* Data<Self, Repr>::getEditableRepresentation() {
     std::scoped_lock lock(mutex_);
     auto repr = getReprInternal<T>(*static_cast<const Self*>(this)).get();
+    repr->detach();
     invalidateAllOtherInternal(repr);
     return repr;
 }
@@ -315,10 +539,18 @@ T* Data<Self, Repr>::getEditableRepresentation() {
 template <typename Self, typename Repr>
 template <typename T>
 bool Data<Self, Repr>::hasRepresentation() const {
-    std::scoped_lock lock(mutex_);
+    std::shared_lock view{viewMutex_};
     return util::has_key(representations_, std::type_index(typeid(T)));
 }
 
+template <typename Self, typename Repr>
+template <typename T>
+bool Data<Self, Repr>::hasValidRepresentation() const {
+    std::shared_lock view{viewMutex_};
+    const auto repr = findRepr(std::type_index(typeid(T)));
+    return repr && repr->isValid();
+}
+
 template <typename Self, typename Repr>
 void Data<Self, Repr>::invalidateAllOther(const Repr* repr) {
     std::scoped_lock lock(mutex_);
@@ -326,6 +558,11 @@ void Data<Self, Repr>::invalidateAllOther(const Repr* repr) {
 }
 template <typename Self, typename Repr>
 void Data<Self, Repr>::invalidateAllOtherInternal(const Repr* repr) {
+    std::unique_lock view{viewMutex_};
+    invalidateAllOtherLocked(repr);
+}
+template <typename Self, typename Repr>
+void Data<Self, Repr>::invalidateAllOtherLocked(const Repr* repr) {
     bool found = false;
     for (auto& elem : representations_) {
         if (elem.second.get() != repr) {
@@ -342,38 +579,52 @@ void Data<Self, Repr>::invalidateAllOtherInternal(const Repr* repr) {
 template <typename Self, typename Repr>
 void Data<Self, Repr>::clearRepresentations() {
     std::scoped_lock lock(mutex_);
+    std::unique_lock view{viewMutex_};
     representations_.clear();
+    reloadable_.clear();
 }
 
 template <typename Self, typename Repr>
 void Data<Self, Repr>::copyRepresentationsTo(Data<Self, Repr>* target) const {
     std::scoped_lock targetLock(mutex_, target->mutex_);
-    target->representations_.clear();
+    {
+        std::unique_lock view{target->viewMutex_};
+        target->representations_.clear();
+    }
 
     if (lastValidRepresentation_) {
         auto rep = std::shared_ptr<Repr>(lastValidRepresentation_->clone());
-        target->lastValidRepresentation_ = target->addRepresentationInternal(rep);
+        target->addRepresentationInternal(rep);
     }
 }
 
 template <typename Self, typename Repr>
 std::shared_ptr<Repr> Data<Self, Repr>::addRepresentationInternal(
     std::shared_ptr<Repr> repr) const {
+    std::unique_lock view{viewMutex_};
     repr->setValid(true);
     repr->setOwner(static_cast<const Self*>(this));
     representations_[repr->getTypeIndex()] = repr;
+    lastValidRepresentation_ = repr;
     return repr;
 }
 
+template <typename Self, typename Repr>
+void Data<Self, Repr>::setLastValid(std::shared_ptr<Repr> repr) const {
+    std::unique_lock view{viewMutex_};
+    lastValidRepresentation_ = std::move(repr);
+}
+
 template <typename Self, typename Repr>
 void Data<Self, Repr>::addRepresentation(std::shared_ptr<Repr> representation) {
     std::scoped_lock lock(mutex_);
-    lastValidRepresentation_ = addRepresentationInternal(representation);
+    addRepresentationInternal(representation);
 }
 
 template <typename Self, typename Repr>
 void Data<Self, Repr>::removeRepresentation(const Repr* representation) {
     std::scoped_lock lock(mutex_);
+    std::unique_lock view{viewMutex_};
 
     for (auto& elem : representations_) {
         if (elem.second.get() == representation) {
@@ -396,6 +647,7 @@ void Data<Self, Repr>::removeRepresentation(const Repr* representation) {
 template <typename Self, typename Repr>
 void Data<Self, Repr>::removeOtherRepresentations(const Repr* representation) {
     std::scoped_lock lock(mutex_);
+    std::unique_lock view{viewMutex_};
 
     std::unordered_map<std::type_index, std::shared_ptr<Repr>> repr;
     for (auto& elem : representations_) {
@@ -416,7 +668,7 @@ void Data<Self, Repr>::removeOtherRepresentations(const Repr* representation) {
 
 template <typename Self, typename Repr>
 bool Data<Self, Repr>::hasRepresentations() const {
-    std::scoped_lock lock(mutex_);
+    std::shared_lock view{viewMutex_};
     return !representations_.empty();
 }
 
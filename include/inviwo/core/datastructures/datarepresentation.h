@@ -31,6 +31,7 @@
 
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/exception.h>
+#include <inviwo/core/datastructures/representationusage.h>
 #include <typeindex>
 
 namespace inviwo {
@@ -60,12 +61,25 @@ public:
 
     virtual std::type_index getTypeIndex() const = 0;
 
+    /**
+     * Make sure that the representation does not share its data with any other representation,
+     * such that it can be modified. Representations that share data between copies, like the RAM
+     * representations, copy it here. Called by Data::getEditableRepresentation, the RAM
+     * representations also detach in all their non-const accessors.
+     */
+    virtual void detach() {}
+
     void setOwner(const Owner* owner);
     const Owner* getOwner() const;
 
     bool isValid() const;
     void setValid(bool valid);
 
+    /**
+     * The uses of the representation, @see ResidencyManager, IdleCompressionManager
+     */
+    const RepresentationUsage& getUsage() const { return usage_; }
+
 protected:
     DataRepresentation() = default;
     DataRepresentation(const DataFormatBase* format);
@@ -76,6 +90,7 @@ protected:
     bool isValid_ = true;
     const DataFormatBase* dataFormatBase_ = DataUInt8::get();
     const Owner* owner_ = nullptr;
+    RepresentationUsage usage_;
 };
 
 template <typename Owner>
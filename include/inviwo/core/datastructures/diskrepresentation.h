@@ -42,12 +42,25 @@ namespace inviwo {
 template <typename Repr>
 class DiskRepresentationLoader;
 
+/**
+ * Non template base of all DiskRepresentations, used to find representations that other
+ * representations can be reloaded from. @see ResidencyManager
+ */
+class IVW_CORE_API DiskRepresentationBase {
+public:
+    virtual ~DiskRepresentationBase() = default;
+    /**
+     * Returns true if there is a loader available to create representations from the disk.
+     */
+    virtual bool hasLoader() const = 0;
+};
+
 /**
  * \ingroup datastructures
  * Base class for all DiskRepresentations \see Data, DataRepresentation
  */
 template <typename Repr, typename Self>
-class DiskRepresentation {
+class DiskRepresentation : public DiskRepresentationBase {
 public:
     DiskRepresentation() = default;
     DiskRepresentation(std::string_view srcFile, DiskRepresentationLoader<Repr>* loader = nullptr);
@@ -60,6 +73,8 @@ public:
     bool hasSourceFile() const;
 
     void setLoader(DiskRepresentationLoader<Repr>* loader);
+    virtual bool hasLoader() const override;
+    const DiskRepresentationLoader<Repr>* getLoader() const;
 
     std::shared_ptr<Repr> createRepresentation() const;
     void updateRepresentation(std::shared_ptr<Repr> dest) const;
@@ -96,6 +111,16 @@ void DiskRepresentation<Repr, Self>::setLoader(DiskRepresentationLoader<Repr>* l
     loader_.reset(loader);
 }
 
+template <typename Repr, typename Self>
+bool DiskRepresentation<Repr, Self>::hasLoader() const {
+    return static_cast<bool>(loader_);
+}
+
+template <typename Repr, typename Self>
+const DiskRepresentationLoader<Repr>* DiskRepresentation<Repr, Self>::getLoader() const {
+    return loader_.get();
+}
+
 template <typename Repr, typename Self>
 std::shared_ptr<Repr> DiskRepresentation<Repr, Self>::createRepresentation() const {
     if (!loader_) throw Exception("No loader available to create representation", IVW_CONTEXT);
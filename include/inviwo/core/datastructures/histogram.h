@@ -36,7 +36,10 @@
 
 #include <glm/common.hpp>
 
+#include <algorithm>
+#include <array>
 #include <iterator>
+#include <limits>
 #include <vector>
 #include <bitset>
 
@@ -86,6 +89,7 @@ public:
     HistogramContainer() = default;
     template <typename FirstIter, typename LastIter>
     HistogramContainer(dvec2 range, size_t bins, FirstIter begin, LastIter end);
+    explicit HistogramContainer(std::vector<NormalizedHistogram> histograms);
 
     const NormalizedHistogram& operator[](size_t i) const;
     const NormalizedHistogram& get(size_t i) const;
@@ -102,64 +106,107 @@ private:
     std::vector<NormalizedHistogram> histograms_;
 };
 
-template <typename FirstIter, typename LastIter>
-HistogramContainer::HistogramContainer(dvec2 dataRange, size_t bins, FirstIter begin,
-                                       LastIter end) {
-    using T = typename std::iterator_traits<FirstIter>::value_type;
+/**
+ * Incrementally computes the histograms and statistics of values of type T, one histogram per
+ * component. Values can be added in several chunks, which makes it possible to compute the
+ * histograms of data that does not fit into memory at once.
+ * ```{.cpp}
+ * HistogramAccumulator<float> acc(dataRange, 2048);
+ * for (const auto& chunk : chunks) {
+ *     acc.add(chunk.begin(), chunk.end());
+ * }
+ * HistogramContainer histograms = acc.finish();
+ * ```
+ * @see HistogramContainer
+ */
+template <typename T>
+class HistogramAccumulator {
+public:
+    HistogramAccumulator(dvec2 dataRange, size_t bins);
 
+    template <typename FirstIter, typename LastIter>
+    void add(FirstIter begin, LastIter end);
+
+    HistogramContainer finish() const;
+
+private:
     // a double type with the same extent as T
     using D = typename util::same_extent<T, double>::type;
     // a size_t type with same extent as T
     using I = typename util::same_extent<T, size_t>::type;
 
-    constexpr size_t extent = util::rank<T>::value > 0 ? util::extent<T>::value : 1;
+    static constexpr size_t extent = util::rank<T>::value > 0 ? util::extent<T>::value : 1;
 
+    dvec2 dataRange_;
+    size_t bins_;
+    std::array<std::vector<double>, extent> histData_;
+
+    D min_{std::numeric_limits<double>::max()};
+    D max_{std::numeric_limits<double>::lowest()};
+    D sum_{0};
+    D sum2_{0};
+    size_t count_{0};
+};
+
+template <typename T>
+HistogramAccumulator<T>::HistogramAccumulator(dvec2 dataRange, size_t bins)
+    : dataRange_{dataRange}, bins_{bins} {
     // check whether number of bins exceeds the data range only if it is an integral type
     if constexpr (!util::is_floating_point<typename util::value_type<T>::type>::value) {
-        bins = std::min(bins, static_cast<std::size_t>(dataRange.y - dataRange.x + 1));
+        bins_ = std::min(bins_, static_cast<std::size_t>(dataRange.y - dataRange.x + 1));
     }
-
-    std::array<std::vector<double>, extent> histData;
     for (size_t i = 0; i < extent; ++i) {
-        histData[i].resize(bins, 0.0);
+        histData_[i].resize(bins_, 0.0);
     }
+}
 
-    D min(std::numeric_limits<double>::max());
-    D max(std::numeric_limits<double>::lowest());
-    D sum(0);
-    D sum2(0);
-    size_t count(0);
-
-    const D rangeMin(dataRange.x);
-    const D rangeScaleFactor(static_cast<double>(bins - 1) / (dataRange.y - dataRange.x));
+template <typename T>
+template <typename FirstIter, typename LastIter>
+void HistogramAccumulator<T>::add(FirstIter begin, LastIter end) {
+    const D rangeMin(dataRange_.x);
+    const D rangeScaleFactor(static_cast<double>(bins_ - 1) / (dataRange_.y - dataRange_.x));
 
     for (; begin != end; ++begin) {
 
         const auto val = static_cast<D>(*begin);
 
-        min = glm::min(min, val);
-        max = glm::max(max, val);
-        sum += val;
-        sum2 += val * val;
-        count++;
+        min_ = glm::min(min_, val);
+        max_ = glm::max(max_, val);
+        sum_ += val;
+        sum2_ += val * val;
+        count_++;
 
         const auto ind = static_cast<I>(glm::clamp((val - rangeMin) * rangeScaleFactor, D{0.0},
-                                                   D{static_cast<double>(bins - 1)}));
+                                                   D{static_cast<double>(bins_ - 1)}));
         for (size_t i = 0; i < extent; ++i) {
             const auto v = util::glmcomp(ind, i);
-            ++histData[i][v];
+            ++histData_[i][v];
         }
     }
+}
 
-    const auto dcount = static_cast<double>(count);
-    const auto mean = sum / dcount;
-    const auto stddev = glm::sqrt((dcount * sum2 - sum * sum) / (dcount * (dcount - D{1})));
+template <typename T>
+HistogramContainer HistogramAccumulator<T>::finish() const {
+    const auto dcount = static_cast<double>(count_);
+    const auto mean = sum_ / dcount;
+    const auto stddev = glm::sqrt((dcount * sum2_ - sum_ * sum_) / (dcount * (dcount - D{1})));
 
+    std::vector<NormalizedHistogram> histograms;
     for (size_t i = 0; i < extent; ++i) {
-        histograms_.emplace_back(dataRange, std::move(histData[i]), util::glmcomp(min, i),
-                                 util::glmcomp(max, i), util::glmcomp(mean, i),
-                                 util::glmcomp(stddev, i));
+        histograms.emplace_back(dataRange_, histData_[i], util::glmcomp(min_, i),
+                                util::glmcomp(max_, i), util::glmcomp(mean, i),
+                                util::glmcomp(stddev, i));
     }
+    return HistogramContainer{std::move(histograms)};
+}
+
+template <typename FirstIter, typename LastIter>
+HistogramContainer::HistogramContainer(dvec2 dataRange, size_t bins, FirstIter begin,
+                                       LastIter end) {
+    using T = typename std::iterator_traits<FirstIter>::value_type;
+    HistogramAccumulator<T> acc{dataRange, bins};
+    acc.add(begin, end);
+    *this = acc.finish();
 }
 
 }  // namespace inviwo
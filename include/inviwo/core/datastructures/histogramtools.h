@@ -33,8 +33,10 @@
 #include <inviwo/core/util/dispatcher.h>
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/cancellationtoken.h>
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -48,11 +50,11 @@ public:
     HistogramCalculationState(std::weak_ptr<HistogramContainer> container, size_t bins,
                               dvec2 dataRange)
         : container_{container}
-        , stop_{std::make_shared<std::atomic<bool>>(false)}
+        , stop_{}
         , bins_{bins}
         , dataRange_{dataRange} {}
 
-    ~HistogramCalculationState() { *stop_ = true; }
+    ~HistogramCalculationState() { stop_.cancel(); }
 
     void whenDone(std::function<void(const HistogramContainer&)> callback);
 
@@ -63,7 +65,7 @@ private:
     std::weak_ptr<HistogramContainer> container_;
     Dispatcher<void(const HistogramContainer&)> callbacks_;
     std::vector<std::shared_ptr<std::function<void(const HistogramContainer&)>>> callbackHandles_;
-    std::shared_ptr<std::atomic<bool>> stop_;
+    CancellationSource stop_;
     bool done = false;
 
     size_t bins_;
@@ -92,6 +94,13 @@ public:
 protected:
     std::shared_ptr<HistogramCalculationState> startCalculation(
         std::shared_ptr<const VolumeRAM> volumeRam, dvec2 dataRange, size_t bins) const;
+    /**
+     * Start a calculation using @p calculate, which is called in the thread pool and should
+     * return early if the token is cancelled.
+     */
+    std::shared_ptr<HistogramCalculationState> startCalculation(
+        std::function<HistogramContainer(const CancellationToken&)> calculate, dvec2 dataRange,
+        size_t bins) const;
 
 private:
     static void done(std::shared_ptr<HistogramCalculationState> state,
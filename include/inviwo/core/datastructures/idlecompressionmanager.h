@@ -0,0 +1,143 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/representationusage.h>
+
+#include <cstddef>
+#include <typeindex>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * \brief Compresses representations that have not been used for a number of evaluations.
+ *
+ * Workspaces keep many intermediate volumes alive in outports and caches, and most of them are not
+ * touched between evaluations. When enabled, Data registers each use of a representation whose
+ * type has a registered compressed type, like VolumeRAM and VolumeCompressedRAM. Representations
+ * that have not been used for `getIdleEpochs()` epochs are converted into the compressed type and
+ * released. A later call to Data::getRepresentation transparently decompresses them again.
+ *
+ * A representation is only compressed if
+ *   * its Data is not locked by another thread,
+ *   * it is valid,
+ *   * no one else holds it through Data::getRepresentationShared,
+ *   * it is not pinned by a RepresentationPins scope, like a running ThreadPool task,
+ *   * it has not been used since it was selected for compression.
+ *
+ * The ProcessorNetworkEvaluator starts a new epoch for each evaluation. Hence, as for the
+ * ResidencyManager, raw representation pointers must not be kept between evaluations, unless they
+ * are pinned. The compression task itself works on the representations directly and does not
+ * pin them.
+ *
+ * Registering a use only updates the RepresentationUsage of the representation, and takes a lock
+ * only the first time a representation is used. nextEpoch selects the idle representations and
+ * compresses them in a background task on the thread pool, or right away if there is no pool.
+ *
+ * The number of idle epochs is zero by default, which disables the manager. It can be configured
+ * in the SystemSettings.
+ * @see ResidencyManager, VolumeCompressedRAM
+ */
+class IVW_CORE_API IdleCompressionManager {
+public:
+    /**
+     * Callback used to compress the representation of type \p type of \p owner into a
+     * representation of type \p compressed, unless it was used in epoch \p idleSince or later.
+     * Should return true if the representation was compressed or does not exist anymore, and false
+     * if it should be tried again in a later epoch.
+     */
+    using Compress = bool (*)(const void* owner, std::type_index type, std::type_index compressed,
+                              size_t idleSince);
+
+    /**
+     * Returns true if the number of idle epochs is larger than zero.
+     */
+    static bool isEnabled();
+
+    /**
+     * Compress representations that have not been used for \p epochs epochs. Zero disables the
+     * manager.
+     */
+    static void setIdleEpochs(size_t epochs);
+    static size_t getIdleEpochs();
+
+    /**
+     * Representations of type \p type will be compressed into representations of type
+     * \p compressed. There has to be a converter between the two types. Should be called before
+     * any representation of type \p type is used.
+     */
+    static void registerCompressedType(std::type_index type, std::type_index compressed);
+    static void unregisterCompressedType(std::type_index type);
+
+    /**
+     * Register a use of the representation of type \p type of \p owner with \p usage in the
+     * current epoch. Representations without a registered compressed type are ignored.
+     */
+    static void touch(const void* owner, std::type_index type, const RepresentationUsage& usage,
+                      Compress compress);
+
+    /**
+     * Forget all representations of \p owner, needs to be called before \p owner is destroyed.
+     * Waits for a running compression of a representation of \p owner to finish.
+     */
+    static void remove(const void* owner);
+
+    /**
+     * Start a new epoch, and compress the representations that have been idle for the configured
+     * number of epochs in the background. Nothing is compressed while the compression started by a
+     * previous epoch is still running.
+     */
+    static void nextEpoch();
+
+    /**
+     * Wait for the running compression, if any, to finish.
+     */
+    static void wait();
+
+    /**
+     * The number of registered representations.
+     */
+    static size_t size();
+    /**
+     * The total number of representations that were compressed, or that did not need compression
+     * anymore when they became idle.
+     */
+    static size_t getCompressions();
+
+    /**
+     * Forget all representations without compressing them, waits for a running compression.
+     */
+    static void clear();
+};
+
+}  // namespace inviwo
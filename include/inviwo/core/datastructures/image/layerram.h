@@ -35,6 +35,7 @@
 #include <inviwo/core/util/assertion.h>
 #include <inviwo/core/util/formatdispatching.h>
 #include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/ramallocation.h>
 
 #include <algorithm>
 
@@ -159,15 +160,31 @@ public:
                                const SwizzleMask& swizzleMask = swizzlemasks::rgba,
                                InterpolationType interpolation = InterpolationType::Linear,
                                const Wrapping2D& wrap = wrapping2d::clampAll);
+    /**
+     * Create a layer with memory allocated according to @p allocation. Color layers are
+     * initialized to zero and depth layers to one, unless @p allocation is uninitialized.
+     */
+    LayerRAMPrecision(size2_t dimensions, const RAMAllocation& allocation,
+                      LayerType type = LayerType::Color,
+                      const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+                      InterpolationType interpolation = InterpolationType::Linear,
+                      const Wrapping2D& wrap = wrapping2d::clampAll);
     LayerRAMPrecision(T* data, size2_t dimensions, LayerType type = LayerType::Color,
                       const SwizzleMask& swizzleMask = swizzlemasks::rgba,
                       InterpolationType interpolation = InterpolationType::Linear,
                       const Wrapping2D& wrap = wrapping2d::clampAll);
-    LayerRAMPrecision(const LayerRAMPrecision<T>& rhs);
-    LayerRAMPrecision<T>& operator=(const LayerRAMPrecision<T>& that);
+    /**
+     * Copies share the pixel data until one of them is written to. The non-const accessors, like
+     * getDataTyped() and setFromDouble(), first copy the data if it is shared. Pointers from them
+     * stay valid until the layer is copied.
+     */
+    LayerRAMPrecision(const LayerRAMPrecision<T>& rhs) = default;
+    LayerRAMPrecision<T>& operator=(const LayerRAMPrecision<T>& that) = default;
     virtual LayerRAMPrecision<T>* clone() const override;
     virtual ~LayerRAMPrecision() = default;
 
+    virtual void detach() override;
+
     T* getDataTyped();
     const T* getDataTyped() const;
 
@@ -213,7 +230,7 @@ public:
 
 private:
     size2_t dimensions_;
-    std::unique_ptr<T[]> data_;
+    RAMStorage<T> data_;
     SwizzleMask swizzleMask_;
     InterpolationType interpolation_;
     Wrapping2D wrapping_;
@@ -237,18 +254,47 @@ IVW_CORE_API std::shared_ptr<LayerRAM> createLayerRAM(
     InterpolationType interpolation = InterpolationType::Linear,
     const Wrapping2D& wrapping = wrapping2d::clampAll);
 
+/**
+ * Factory for layers with memory allocated according to @p allocation.
+ * Use RAMAllocation::uninitialized() to skip initializing the data when all of it will be
+ * overwritten.
+ *
+ * @param dimensions of layer to create.
+ * @param type of layer to create.
+ * @param format of layer to create.
+ * @param allocation how the data is allocated and initialized.
+ * @param swizzleMask used in for the layer, defaults to RGB-alpha
+ * @param interpolation method to use.
+ * @param wrapping method to use.
+ * @return nullptr if no valid format was specified.
+ */
+IVW_CORE_API std::shared_ptr<LayerRAM> createLayerRAM(
+    const size2_t& dimensions, LayerType type, const DataFormatBase* format,
+    const RAMAllocation& allocation, const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+    InterpolationType interpolation = InterpolationType::Linear,
+    const Wrapping2D& wrapping = wrapping2d::clampAll);
+
 template <typename T>
 LayerRAMPrecision<T>::LayerRAMPrecision(size2_t dimensions, LayerType type,
                                         const SwizzleMask& swizzleMask,
                                         InterpolationType interpolation, const Wrapping2D& wrapping)
+    : LayerRAMPrecision(dimensions, RAMAllocation{}, type, swizzleMask, interpolation, wrapping) {}
+
+template <typename T>
+LayerRAMPrecision<T>::LayerRAMPrecision(size2_t dimensions, const RAMAllocation& allocation,
+                                        LayerType type, const SwizzleMask& swizzleMask,
+                                        InterpolationType interpolation, const Wrapping2D& wrapping)
     : LayerRAM(type, DataFormat<T>::get())
     , dimensions_(dimensions)
-    , data_(new T[dimensions_.x * dimensions_.y]())
+    , data_(util::makeRAMArray<T>(dimensions_.x * dimensions_.y,
+                                  type == LayerType::Depth ? RAMAllocation::uninitialized()
+                                                           : allocation))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
     , wrapping_{wrapping} {
-    std::fill(data_.get(), data_.get() + glm::compMul(dimensions_),
-              (type == LayerType::Depth) ? T{1} : T{0});
+    if (type == LayerType::Depth && allocation.init == RAMAllocation::Init::Zero) {
+        std::fill(getDataTyped(), getDataTyped() + glm::compMul(dimensions_), T{1});
+    }
 }
 
 template <typename T>
@@ -257,82 +303,55 @@ LayerRAMPrecision<T>::LayerRAMPrecision(T* data, size2_t dimensions, LayerType t
                                         InterpolationType interpolation, const Wrapping2D& wrapping)
     : LayerRAM(type, DataFormat<T>::get())
     , dimensions_(dimensions)
-    , data_(data ? data : new T[dimensions_.x * dimensions_.y]())
+    , data_(data ? RAMArray<T>{data} : util::makeRAMArray<T>(dimensions_.x * dimensions_.y))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
     , wrapping_{wrapping} {
-    if (!data) {
-        std::fill(data_.get(), data_.get() + glm::compMul(dimensions_),
-                  (type == LayerType::Depth) ? T{1} : T{0});
+    if (!data && type == LayerType::Depth) {
+        std::fill(getDataTyped(), getDataTyped() + glm::compMul(dimensions_), T{1});
     }
 }
 
 template <typename T>
-LayerRAMPrecision<T>::LayerRAMPrecision(const LayerRAMPrecision<T>& rhs)
-    : LayerRAM(rhs)
-    , dimensions_(rhs.dimensions_)
-    , data_(new T[dimensions_.x * dimensions_.y])
-    , swizzleMask_(rhs.swizzleMask_)
-    , interpolation_{rhs.interpolation_}
-    , wrapping_{rhs.wrapping_} {
-    std::memcpy(data_.get(), rhs.data_.get(), dimensions_.x * dimensions_.y * sizeof(T));
-}
-
-template <typename T>
-LayerRAMPrecision<T>& LayerRAMPrecision<T>::operator=(const LayerRAMPrecision<T>& that) {
-    if (this != &that) {
-        LayerRAM::operator=(that);
-
-        const auto dim = that.dimensions_;
-        auto data = std::make_unique<T[]>(dim.x * dim.y);
-        std::memcpy(data.get(), that.data_.get(), dim.x * dim.y * sizeof(T));
-        data_.swap(data);
-
-        dimensions_ = that.dimensions_;
-        swizzleMask_ = that.swizzleMask_;
-        interpolation_ = that.interpolation_;
-        wrapping_ = that.wrapping_;
-    }
-    return *this;
+LayerRAMPrecision<T>* LayerRAMPrecision<T>::clone() const {
+    return new LayerRAMPrecision<T>(*this);
 }
 
 template <typename T>
-LayerRAMPrecision<T>* LayerRAMPrecision<T>::clone() const {
-    return new LayerRAMPrecision<T>(*this);
+void LayerRAMPrecision<T>::detach() {
+    data_.detach(dimensions_.x * dimensions_.y);
 }
 
 template <typename T>
 T* inviwo::LayerRAMPrecision<T>::getDataTyped() {
-    return data_.get();
+    return data_.edit(dimensions_.x * dimensions_.y);
 }
 
 template <typename T>
 const T* inviwo::LayerRAMPrecision<T>::getDataTyped() const {
-    return data_.get();
+    return data_.data();
 }
 
 template <typename T>
 void* LayerRAMPrecision<T>::getData() {
-    return data_.get();
+    return data_.edit(dimensions_.x * dimensions_.y);
 }
 template <typename T>
 const void* LayerRAMPrecision<T>::getData() const {
-    return const_cast<const T*>(data_.get());
+    return data_.data();
 }
 
 template <typename T>
 void inviwo::LayerRAMPrecision<T>::setData(void* d, size2_t dimensions) {
-    std::unique_ptr<T[]> data(static_cast<T*>(d));
-    data_.swap(data);
-    std::swap(dimensions_, dimensions);
+    data_ = RAMStorage<T>{RAMArray<T>{static_cast<T*>(d)}};
+    dimensions_ = dimensions;
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setDimensions(size2_t dimensions) {
     if (dimensions != dimensions_) {
-        auto data = std::make_unique<T[]>(dimensions.x * dimensions.y);
-        data_.swap(data);
-        std::swap(dimensions, dimensions_);
+        data_ = RAMStorage<T>{util::makeRAMArray<T>(dimensions.x * dimensions.y)};
+        dimensions_ = dimensions;
     }
 }
 
@@ -373,82 +392,82 @@ Wrapping2D LayerRAMPrecision<T>::getWrapping() const {
 
 template <typename T>
 double LayerRAMPrecision<T>::getAsDouble(const size2_t& pos) const {
-    return util::glm_convert<double>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<double>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec2 LayerRAMPrecision<T>::getAsDVec2(const size2_t& pos) const {
-    return util::glm_convert<dvec2>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<dvec2>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec3 LayerRAMPrecision<T>::getAsDVec3(const size2_t& pos) const {
-    return util::glm_convert<dvec3>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<dvec3>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec4 LayerRAMPrecision<T>::getAsDVec4(const size2_t& pos) const {
-    return util::glm_convert<dvec4>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<dvec4>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromDouble(const size2_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromDVec2(const size2_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromDVec3(const size2_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromDVec4(const size2_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 double LayerRAMPrecision<T>::getAsNormalizedDouble(const size2_t& pos) const {
-    return util::glm_convert_normalized<double>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<double>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec2 LayerRAMPrecision<T>::getAsNormalizedDVec2(const size2_t& pos) const {
-    return util::glm_convert_normalized<dvec2>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<dvec2>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec3 LayerRAMPrecision<T>::getAsNormalizedDVec3(const size2_t& pos) const {
-    return util::glm_convert_normalized<dvec3>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<dvec3>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec4 LayerRAMPrecision<T>::getAsNormalizedDVec4(const size2_t& pos) const {
-    return util::glm_convert_normalized<dvec4>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<dvec4>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromNormalizedDouble(const size2_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromNormalizedDVec2(const size2_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromNormalizedDVec3(const size2_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromNormalizedDVec4(const size2_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 size_t inline LayerRAM::posToIndex(const size2_t& pos, const size2_t& dim) {
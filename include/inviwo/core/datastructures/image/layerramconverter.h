@@ -42,6 +42,7 @@ namespace inviwo {
 class IVW_CORE_API LayerDisk2RAMConverter
     : public RepresentationConverterType<LayerRepresentation, LayerDisk, LayerRAM> {
 public:
+    virtual double getCost() const override { return convertercost::disk; }
     virtual std::shared_ptr<LayerRAM> createFrom(
         std::shared_ptr<const LayerDisk> source) const override;
     virtual void update(std::shared_ptr<const LayerDisk> source,
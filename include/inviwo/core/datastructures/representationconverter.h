@@ -44,6 +44,23 @@ public:
     using Exception::Exception;
 };
 
+/**
+ * Typical costs of converters, per byte and relative to a copy within RAM.
+ * @see RepresentationConverter::getCost
+ */
+namespace convertercost {
+/** Sharing data between APIs without copying it, like OpenGL to OpenCL interop */
+constexpr double share = 0.1;
+/** A copy within the same device */
+constexpr double copy = 1.0;
+/** Uploading from RAM to a device */
+constexpr double upload = 2.0;
+/** Downloading from a device to RAM, which has to wait for the device to finish */
+constexpr double download = 4.0;
+/** Reading from disk */
+constexpr double disk = 8.0;
+}  // namespace convertercost
+
 /**
  * A base type for all RepresentationConverters
  * @see RepresentationConverter
@@ -70,6 +87,14 @@ public:
     using ConverterID = std::pair<std::type_index, std::type_index>;
     virtual ConverterID getConverterID() const = 0;
 
+    /**
+     * The estimated cost of converting one byte, relative to a copy within RAM. When there are
+     * several ways of converting between two representations, the RepresentationConverterFactory
+     * selects the one with the lowest total cost. Defaults to convertercost::copy.
+     * @see convertercost
+     */
+    virtual double getCost() const { return convertercost::copy; }
+
     virtual std::shared_ptr<BaseRepr> createFrom(std::shared_ptr<const BaseRepr> source) const = 0;
     virtual void update(std::shared_ptr<const BaseRepr> source,
                         std::shared_ptr<BaseRepr> destination) const = 0;
@@ -115,6 +140,10 @@ public:
     using ConverterList = std::vector<const RepresentationConverter<BaseRepr>*>;
 
     size_t steps() const;
+    /**
+     * The sum of the costs of all the converters.
+     */
+    double cost() const;
     ConverterID getConverterID() const;
 
     void addConverter(const RepresentationConverter<BaseRepr>* converter);
@@ -139,6 +168,13 @@ size_t RepresentationConverterPackage<BaseRepr>::steps() const {
     return converters_.size();
 }
 
+template <typename BaseRepr>
+double RepresentationConverterPackage<BaseRepr>::cost() const {
+    double sum = 0.0;
+    for (auto converter : converters_) sum += converter->getCost();
+    return sum;
+}
+
 template <typename BaseRepr>
 auto RepresentationConverterPackage<BaseRepr>::getConverterID() const -> ConverterID {
     return ConverterID(converters_.front()->getConverterID().first,
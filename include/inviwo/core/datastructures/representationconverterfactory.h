@@ -35,11 +35,13 @@
 
 #include <warn/push>
 #include <warn/ignore/all>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <typeindex>
 #include <unordered_set>
 #include <unordered_map>
+#include <utility>
 #include <warn/pop>
 
 namespace inviwo {
@@ -69,33 +71,42 @@ class RepresentationConverterFactory : public BaseRepresentationConverterFactory
 public:
     using ConverterID = typename RepresentationConverter<BaseRepr>::ConverterID;
     using RepMap = std::unordered_map<ConverterID, RepresentationConverter<BaseRepr>*>;
-    using PackageMap =
-        std::unordered_multimap<ConverterID,
-                                std::unique_ptr<RepresentationConverterPackage<BaseRepr>>>;
+    using Package = RepresentationConverterPackage<BaseRepr>;
+    using PackageMap = std::unordered_map<ConverterID, std::shared_ptr<const Package>>;
     RepresentationConverterFactory() = default;
     virtual ~RepresentationConverterFactory() = default;
 
     virtual BaseReprId getBaseReprId() override final;
 
-    const RepMap& getConverters() const;
+    /**
+     * A copy of the registered converters, the converters can be registered and unregistered
+     * from other threads.
+     */
+    RepMap getConverters() const;
 
     // This will not assume ownership.
     bool registerObject(RepresentationConverter<BaseRepr>* representationConverter);
     bool unRegisterObject(RepresentationConverter<BaseRepr>* representationConverter);
 
-    // Get best converter
-    const RepresentationConverterPackage<BaseRepr>* getRepresentationConverter(ConverterID);
-    const RepresentationConverterPackage<BaseRepr>* getRepresentationConverter(std::type_index from,
-                                                                               std::type_index to);
+    /**
+     * Get the cheapest sequence of converters from one representation to another, i.e. the one
+     * with the lowest sum of RepresentationConverter::getCost(), the number of steps is used to
+     * break ties. Returns nullptr if there is no way to convert between the representations.
+     * Registering a converter invalidates the cached packages since there might be a cheaper path,
+     * the returned package stays valid as long as it is held.
+     */
+    std::shared_ptr<const Package> getRepresentationConverter(ConverterID);
+    std::shared_ptr<const Package> getRepresentationConverter(std::type_index from,
+                                                              std::type_index to);
 
 private:
-    const RepresentationConverterPackage<BaseRepr>* createConverterPackage(ConverterID id);
+    std::shared_ptr<const Package> createConverterPackage(ConverterID id) const;
 
+    // Guards converters_ and packages_
+    mutable std::mutex mutex_;
     // converters are owned by the Module
     RepMap converters_;
-
-    // All the converter packages created locally;
-    std::mutex mutex_;
+    // All the converter packages created locally
     PackageMap packages_;
 };
 
@@ -105,22 +116,28 @@ auto RepresentationConverterFactory<BaseRepr>::getBaseReprId() -> BaseReprId {
 }
 
 template <typename BaseRepr>
-auto RepresentationConverterFactory<BaseRepr>::getConverters() const -> const RepMap& {
+auto RepresentationConverterFactory<BaseRepr>::getConverters() const -> RepMap {
+    std::scoped_lock lock(mutex_);
     return converters_;
 };
 
 template <typename BaseRepr>
 bool RepresentationConverterFactory<BaseRepr>::registerObject(
     RepresentationConverter<BaseRepr>* converter) {
+    std::scoped_lock lock(mutex_);
     if (!util::insert_unique(converters_, converter->getConverterID(), converter))
         throw(ConverterException("Converter with supplied ID already registered", IVW_CONTEXT));
 
+    // The new converter might provide a cheaper path. Packages that are in use are kept alive by
+    // their users.
+    packages_.clear();
     return true;
 }
 
 template <typename BaseRepr>
 bool RepresentationConverterFactory<BaseRepr>::unRegisterObject(
     RepresentationConverter<BaseRepr>* converter) {
+    std::scoped_lock lock(mutex_);
     size_t removed = std::erase_if(
         converters_, [converter](const auto& elem) { return elem.second == converter; });
 
@@ -135,36 +152,26 @@ bool RepresentationConverterFactory<BaseRepr>::unRegisterObject(
 }
 
 template <typename BaseRepr>
-const RepresentationConverterPackage<BaseRepr>*
-RepresentationConverterFactory<BaseRepr>::getRepresentationConverter(ConverterID id) {
-    RepresentationConverterPackage<BaseRepr>* res = nullptr;
-    constexpr size_t steps = std::numeric_limits<size_t>::max();
-    {
-        std::unique_lock<std::mutex> lock(mutex_);
-        auto range = packages_.equal_range(id);
-        for (auto it = range.first; it != range.second; ++it) {
-            if (it->second->steps() < steps) {
-                res = it->second.get();
-            }
-        }
-    }
-    if (res) {
-        return res;
-    } else {
-        return createConverterPackage(id);
-    }
+auto RepresentationConverterFactory<BaseRepr>::getRepresentationConverter(ConverterID id)
+    -> std::shared_ptr<const Package> {
+    std::scoped_lock lock(mutex_);
+    if (auto it = packages_.find(id); it != packages_.end()) return it->second;
+
+    auto package = createConverterPackage(id);
+    if (package) packages_.emplace(id, package);
+    return package;
 }
 
 template <typename BaseRepr>
-const RepresentationConverterPackage<BaseRepr>*
-RepresentationConverterFactory<BaseRepr>::getRepresentationConverter(std::type_index from,
-                                                                     std::type_index to) {
+auto RepresentationConverterFactory<BaseRepr>::getRepresentationConverter(std::type_index from,
+                                                                          std::type_index to)
+    -> std::shared_ptr<const Package> {
     return getRepresentationConverter(ConverterID(from, to));
 }
 
 template <typename BaseRepr>
-const RepresentationConverterPackage<BaseRepr>*
-RepresentationConverterFactory<BaseRepr>::createConverterPackage(ConverterID id) {
+auto RepresentationConverterFactory<BaseRepr>::createConverterPackage(ConverterID id) const
+    -> std::shared_ptr<const Package> {
     /* Implementation of Dijkstra's algorithm following
      * https://en.wikipedia.org/wiki/Dijkstra's_algorithm#Pseudocode
      */
@@ -177,39 +184,44 @@ RepresentationConverterFactory<BaseRepr>::createConverterPackage(ConverterID id)
         verts.insert(converter.first.second);
     }
 
-    std::unordered_map<std::type_index, size_t> dist;
+    // The distance is the sum of the converter costs, with the number of steps to break ties
+    using Dist = std::pair<double, size_t>;
+    constexpr Dist inf{std::numeric_limits<double>::infinity(),
+                       std::numeric_limits<size_t>::max()};
+
+    std::unordered_map<std::type_index, Dist> dist;
     std::unordered_map<std::type_index, std::type_index> prev;
 
-    dist[source] = 0;
+    dist[source] = Dist{0.0, 0};
 
     std::unordered_set<std::type_index> Q;
     for (const auto& v : verts) {
         if (v != source) {
-            dist[v] = std::numeric_limits<size_t>::max();
+            dist[v] = inf;
         }
         Q.insert(v);
     }
 
     while (!Q.empty()) {
-        std::size_t steps = std::numeric_limits<size_t>::max();
+        Dist best = inf;
         std::type_index u = *Q.begin();
         for (const auto& t : Q) {
-            if (dist[t] < steps) {
-                steps = dist[t];
+            if (dist[t] < best) {
+                best = dist[t];
                 u = t;
             }
         }
         Q.erase(u);
 
-        if (u == target) break;
+        if (u == target || best == inf) break;
 
         for (const auto& converter : converters_) {
             if (converter.first.first == u) {
                 auto v = converter.first.second;
-                size_t alt = dist[u] + 1;
+                const Dist alt{dist[u].first + converter.second->getCost(), dist[u].second + 1};
                 if (alt < dist[v]) {
                     dist[v] = alt;
-                    prev.emplace(std::make_pair(v, u));
+                    prev.insert_or_assign(v, u);
                 }
             }
         }
@@ -218,23 +230,18 @@ RepresentationConverterFactory<BaseRepr>::createConverterPackage(ConverterID id)
     std::vector<const RepresentationConverter<BaseRepr>*> S;
     std::type_index u = target;
     while (util::has_key(prev, u)) {
-        auto conv = converters_[ConverterID(prev.at(u), u)];
+        auto conv = converters_.at(ConverterID(prev.at(u), u));
         S.push_back(conv);
         u = prev.at(u);
     }
 
     if (!S.empty() && S.back()->getConverterID().first == source &&
         S.front()->getConverterID().second == target) {
-        auto package = std::make_unique<RepresentationConverterPackage<BaseRepr>>();
+        auto package = std::make_shared<Package>();
         for (auto it = S.crbegin(); it != S.crend(); it++) {
             package->addConverter(*it);
         }
-        auto res = package.get();
-        {
-            std::unique_lock<std::mutex> lock(mutex_);
-            packages_.emplace(std::make_pair(package->getConverterID(), std::move(package)));
-        }
-        return res;
+        return package;
     } else {
         return nullptr;
     }
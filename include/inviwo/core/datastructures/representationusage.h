@@ -0,0 +1,131 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * \brief The uses of a representation, tracked by the ResidencyManager and the
+ * IdleCompressionManager
+ *
+ * Every DataRepresentation has one, such that a use can be registered without taking any lock.
+ * The managers share the record with the representation, and only look at it when they select
+ * representations to evict or compress. Copies start out unused.
+ * @see RepresentationPins
+ */
+class IVW_CORE_API RepresentationUsage {
+public:
+    RepresentationUsage() = default;
+    RepresentationUsage(const RepresentationUsage&) : RepresentationUsage{} {}
+    RepresentationUsage& operator=(const RepresentationUsage&) { return *this; }
+
+    /**
+     * The epoch of the IdleCompressionManager in which the representation was last used.
+     */
+    size_t getLastUse() const { return record_->compression.epoch.load(std::memory_order_acquire); }
+    /**
+     * The epoch of the ResidencyManager in which the representation was last used.
+     */
+    size_t getLastResidentUse() const {
+        return record_->residency.epoch.load(std::memory_order_acquire);
+    }
+    /**
+     * True while a RepresentationPins scope holds the representation. Pinned representations are
+     * neither evicted nor compressed.
+     */
+    bool isPinned() const { return record_->pins.load(std::memory_order_acquire) != 0; }
+
+    /// Whether the representation is registered with a manager
+    enum class State { Unknown, Registered, Ignored };
+    struct Stamp {
+        std::atomic<size_t> epoch = 0;
+        std::atomic<State> state = State::Unknown;
+    };
+    struct Record {
+        Stamp compression;
+        Stamp residency;
+        std::atomic<size_t> bytes = 0;
+        std::atomic<size_t> pins = 0;
+    };
+
+private:
+    friend class IdleCompressionManager;
+    friend class ResidencyManager;
+    friend class RepresentationPins;
+    // Shared with the managers, which might outlive the representation
+    std::shared_ptr<Record> record_ = std::make_shared<Record>();
+};
+
+/**
+ * \ingroup datastructures
+ * \brief Pins all representations used on the current thread while the scope is alive
+ *
+ * Pointers returned by Data::getRepresentation are only guaranteed to be valid until the next
+ * network evaluation, after that the ResidencyManager and the IdleCompressionManager might replace
+ * the representation. Work that runs in the background, like the jobs of a PoolProcessor, can
+ * outlive the evaluation that started it. The ThreadPool therefore runs every task in a
+ * RepresentationPins scope: any representation that is used while the scope is alive is pinned and
+ * kept until the scope ends. Scopes can be nested, a representation stays pinned until the last
+ * scope that pinned it ends.
+ */
+class IVW_CORE_API RepresentationPins {
+public:
+    RepresentationPins();
+    RepresentationPins(const RepresentationPins&) = delete;
+    RepresentationPins(RepresentationPins&&) = delete;
+    RepresentationPins& operator=(const RepresentationPins&) = delete;
+    RepresentationPins& operator=(RepresentationPins&&) = delete;
+    ~RepresentationPins();
+
+    /**
+     * Pin the representation of \p usage in the innermost scope of the current thread. Does nothing
+     * if there is no scope.
+     */
+    static void pin(const RepresentationUsage& usage);
+
+    /**
+     * The number of representations pinned by this scope.
+     */
+    size_t size() const { return pinned_.size(); }
+
+private:
+    std::vector<std::shared_ptr<RepresentationUsage::Record>> pinned_;
+    RepresentationPins* outer_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,168 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/representationusage.h>
+#include <inviwo/core/util/detected.h>
+
+#include <cstddef>
+#include <typeindex>
+#include <utility>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * \brief Keeps the RAM used by reloadable representations within a byte budget.
+ *
+ * Representations that are created directly from a DiskRepresentation with a loader, like a
+ * VolumeRAM loaded by a RawVolumeRAMLoader, can always be reconstructed from the disk. Data
+ * registers a use of such representations each time they are accessed. When a new epoch starts
+ * and the total size of the registered representations exceeds the budget, the least recently
+ * used ones are evicted. A later call to Data::getRepresentation will transparently reload them
+ * from the disk.
+ *
+ * A representation is only evicted if
+ *   * its Data is not locked by another thread,
+ *   * the DiskRepresentation is still valid, i.e. the representation has not been edited,
+ *   * no one else holds it through Data::getRepresentationShared,
+ *   * it is not pinned by a RepresentationPins scope, like a running ThreadPool task,
+ *   * it has not been used since the last call to nextEpoch.
+ *
+ * The ProcessorNetworkEvaluator starts a new epoch for each evaluation, hence representations
+ * used during an evaluation are kept resident until the next one. Pointers returned by
+ * Data::getRepresentation on the main thread are hence only valid until the end of the next
+ * evaluation. Tasks on the ThreadPool, like the jobs of a PoolProcessor, pin the representations
+ * they use until they finish. Anything else that holds a representation for longer, like
+ * samplers, has to hold it through Data::getRepresentationShared, @see VolumeSampler.
+ *
+ * Registering a use only updates the RepresentationUsage of the representation, and takes a lock
+ * only the first time a representation is used. The budget is only enforced by nextEpoch and
+ * enforce, hence it can be exceeded within an epoch.
+ *
+ * The budget is zero by default, which disables the manager. It can be configured in the
+ * SystemSettings.
+ */
+class IVW_CORE_API ResidencyManager {
+public:
+    /**
+     * Callback used to evict a representation of type \p type from \p owner, unless it was used in
+     * epoch \p usedSince or later. Should return true if the representation was evicted or does
+     * not exist anymore.
+     */
+    using Evict = bool (*)(const void* owner, std::type_index type, size_t usedSince);
+
+    /**
+     * Returns true if a budget has been set.
+     */
+    static bool isEnabled();
+
+    /**
+     * Set the budget in bytes. A budget of zero disables the manager.
+     */
+    static void setBudget(size_t bytes);
+    static size_t getBudget();
+
+    /**
+     * The total size of all registered representations.
+     */
+    static size_t getResidentBytes();
+    /**
+     * The number of registered representations.
+     */
+    static size_t size();
+    /**
+     * The total number of evictions.
+     */
+    static size_t getEvictions();
+
+    /**
+     * Register a use of the representation of type \p type of \p owner with \p usage and a size
+     * of \p bytes in the current epoch, making it one of the most recently used ones.
+     */
+    static void touch(const void* owner, std::type_index type, const RepresentationUsage& usage,
+                      size_t bytes, Evict evict);
+
+    /**
+     * Forget all representations of \p owner, needs to be called before \p owner is destroyed.
+     */
+    static void remove(const void* owner);
+
+    /**
+     * Start a new epoch, and evict down to the budget. Representations used in the current epoch
+     * are never evicted.
+     */
+    static void nextEpoch();
+
+    /**
+     * Evict the least recently used representations until the resident bytes are within the
+     * budget.
+     */
+    static void enforce();
+
+    /**
+     * Forget all representations without evicting them.
+     */
+    static void clear();
+};
+
+namespace util {
+
+namespace detail {
+template <typename T>
+using getDimensionsType = decltype(std::declval<const T&>().getDimensions());
+template <typename T>
+using getSizeType = decltype(std::declval<const T&>().getSize());
+}  // namespace detail
+
+/**
+ * The number of bytes used by the data of a representation, computed from its dimensions or size
+ * and its data format. Returns 0 for representations without dimensions or size.
+ */
+template <typename Repr>
+size_t residentBytes(const Repr& repr) {
+    if constexpr (util::is_detected_v<detail::getDimensionsType, Repr>) {
+        const auto& dims = repr.getDimensions();
+        size_t count = 1;
+        for (int i = 0; i < static_cast<int>(dims.length()); ++i) {
+            count *= static_cast<size_t>(dims[i]);
+        }
+        return count * repr.getDataFormat()->getSize();
+    } else if constexpr (util::is_detected_v<detail::getSizeType, Repr>) {
+        return repr.getSize() * repr.getDataFormat()->getSize();
+    } else {
+        return 0;
+    }
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -0,0 +1,555 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/assertion.h>
+#include <inviwo/core/util/brickiterator.h>
+#include <inviwo/core/util/formats.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/ramallocation.h>
+#include <inviwo/core/util/volumeramutils.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * \brief A RAM representation of a volume where the voxels are stored in bricks
+ *
+ * The volume is split into cubic bricks of `getBrickSize()` voxels along each axis, and each brick
+ * is stored contiguously, linearized in x, then y, then z. Bricks are ordered in the same way. Each
+ * brick is surrounded by an apron of `getApron()` voxels duplicated from its neighbors, clamped at
+ * the border of the volume. Hence, any kernel with a radius up to the apron size can be evaluated
+ * for the voxels of a brick without leaving the brick's memory, which gives much better cache and
+ * TLB locality than a linear layout for access in the z direction.
+ *
+ * Voxels of the last bricks along an axis that fall outside of the volume are filled by clamping
+ * as well. Aprons are not updated when modifying voxels, call `updateAprons()` after modifications.
+ *
+ * Converters to and from VolumeRAM are registered by the core module, i.e. a bricked
+ * representation is available through `volume.getRepresentation<VolumeBrickedRAM>()`.
+ * @see VolumeBrickedRAMPrecision, util::BrickIterator
+ */
+class IVW_CORE_API VolumeBrickedRAM : public VolumeRepresentation {
+public:
+    static constexpr size_t defaultBrickSize = 32;
+    static constexpr size_t defaultApron = 1;
+
+    VolumeBrickedRAM(const DataFormatBase* format, size_t brickSize = defaultBrickSize,
+                     size_t apron = defaultApron);
+    VolumeBrickedRAM(const VolumeBrickedRAM& rhs) = default;
+    VolumeBrickedRAM& operator=(const VolumeBrickedRAM& that) = default;
+    virtual VolumeBrickedRAM* clone() const override = 0;
+    virtual ~VolumeBrickedRAM() = default;
+
+    virtual std::type_index getTypeIndex() const override final;
+
+    /**
+     * Number of voxels of a brick along each axis, excluding the apron
+     */
+    size_t getBrickSize() const { return brickSize_; }
+    /**
+     * Number of voxels duplicated from neighboring bricks on each side of a brick
+     */
+    size_t getApron() const { return apron_; }
+    /**
+     * Number of voxels of a brick along each axis, including the apron on both sides
+     */
+    size_t getPaddedBrickSize() const { return brickSize_ + 2 * apron_; }
+
+    /**
+     * Number of bricks along each axis
+     */
+    size3_t getBrickCount() const;
+    /**
+     * Position of the first voxel of @p brick in the volume
+     */
+    size3_t getBrickOffset(const size3_t& brick) const { return brick * brickSize_; }
+    /**
+     * Number of voxels of @p brick that are inside of the volume
+     */
+    size3_t getBrickExtent(const size3_t& brick) const;
+
+    /**
+     * Pointer to the first voxel, including the apron, of @p brick
+     */
+    virtual void* getBrickData(const size3_t& brick) = 0;
+    virtual const void* getBrickData(const size3_t& brick) const = 0;
+
+    virtual double getAsDouble(const size3_t& pos) const = 0;
+    virtual dvec4 getAsDVec4(const size3_t& pos) const = 0;
+
+    /**
+     * Copy all the voxels of @p source, which has to have the same format and dimensions.
+     */
+    virtual void copyFrom(const VolumeRAM& source) = 0;
+    /**
+     * Copy all the voxels into @p dest, which has to have the same format and dimensions.
+     */
+    virtual void copyTo(VolumeRAM& dest) const = 0;
+
+    /**
+     * Update all aprons from the voxels of the neighboring bricks
+     */
+    virtual void updateAprons() = 0;
+
+    virtual size_t getNumberOfBytes() const = 0;
+
+    /**
+     * Dispatch functionality to retrieve the actual underlaying VolumeBrickedRAMPrecision.
+     * @see VolumeRAM::dispatch
+     */
+    template <typename Result, template <class> class Predicate = dispatching::filter::All,
+              typename Callable, typename... Args>
+    auto dispatch(Callable&& callable, Args&&... args) -> Result;
+
+    /**
+     *	Const overload. Callable will be called with a const VolumeBrickedRAMPrecision<T> pointer.
+     */
+    template <typename Result, template <class> class Predicate = dispatching::filter::All,
+              typename Callable, typename... Args>
+    auto dispatch(Callable&& callable, Args&&... args) const -> Result;
+
+protected:
+    size_t brickSize_;
+    size_t apron_;
+};
+
+/**
+ * \ingroup datastructures
+ * \brief Bricked RAM representation of a volume with voxels of type T
+ *
+ * Example of a kernel evaluated brick by brick, with an apron of at least one voxel:
+ * ```{.cpp}
+ * const VolumeBrickedRAMPrecision<float>& bricked = ...;
+ * const auto padded = size3_t{bricked.getPaddedBrickSize()};
+ * const util::IndexMapper3D im{padded};
+ * util::forEachVoxel(bricked.getBrickCount(), [&](const size3_t& brick) {
+ *     const float* data = bricked.getBrickDataTyped(brick);
+ *     for (auto it = bricked.brickIterator(brick); it != it.end(); ++it) {
+ *         const auto p = it.globalPos();
+ *         const float dz = data[im(p + size3_t{0, 0, 1})] - data[im(p - size3_t{0, 0, 1})];
+ *         // result at bricked.getBrickOffset(brick) + it.blockPos()
+ *     }
+ * });
+ * ```
+ */
+template <typename T>
+class VolumeBrickedRAMPrecision : public VolumeBrickedRAM {
+public:
+    using type = T;
+
+    explicit VolumeBrickedRAMPrecision(size3_t dimensions = size3_t(128, 128, 128),
+                                       size_t brickSize = defaultBrickSize,
+                                       size_t apron = defaultApron,
+                                       const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+                                       InterpolationType interpolation = InterpolationType::Linear,
+                                       const Wrapping3D& wrapping = wrapping3d::clampAll);
+    /**
+     * Create a volume with memory allocated and initialized according to @p allocation, for
+     * example use RAMAllocation::uninitialized() when all the voxels will be overwritten by
+     * copyFrom().
+     */
+    VolumeBrickedRAMPrecision(size3_t dimensions, const RAMAllocation& allocation,
+                              size_t brickSize = defaultBrickSize, size_t apron = defaultApron,
+                              const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+                              InterpolationType interpolation = InterpolationType::Linear,
+                              const Wrapping3D& wrapping = wrapping3d::clampAll);
+    /**
+     * Copies share the voxel data until one of them is written to. The non-const accessors, like
+     * getBrickDataTyped() and voxel(), first copy the data if it is shared. Pointers from them
+     * stay valid until the volume is copied.
+     */
+    VolumeBrickedRAMPrecision(const VolumeBrickedRAMPrecision<T>& rhs) = default;
+    VolumeBrickedRAMPrecision<T>& operator=(const VolumeBrickedRAMPrecision<T>& that) = default;
+    virtual VolumeBrickedRAMPrecision<T>* clone() const override;
+    virtual ~VolumeBrickedRAMPrecision() = default;
+
+    virtual void detach() override;
+
+    T* getBrickDataTyped(const size3_t& brick);
+    const T* getBrickDataTyped(const size3_t& brick) const;
+    virtual void* getBrickData(const size3_t& brick) override;
+    virtual const void* getBrickData(const size3_t& brick) const override;
+
+    /**
+     * Iterate over the voxels of @p brick that are inside of the volume, excluding the apron.
+     * `globalPos()` of the iterator is the position within the padded brick and `blockPos()` the
+     * position relative to `getBrickOffset(brick)`.
+     */
+    util::BrickIterator<T*> brickIterator(const size3_t& brick);
+    util::BrickIterator<const T*> brickIterator(const size3_t& brick) const;
+
+    T& voxel(const size3_t& pos);
+    const T& voxel(const size3_t& pos) const;
+
+    virtual double getAsDouble(const size3_t& pos) const override;
+    virtual dvec4 getAsDVec4(const size3_t& pos) const override;
+
+    virtual void copyFrom(const VolumeRAM& source) override;
+    virtual void copyTo(VolumeRAM& dest) const override;
+    virtual void updateAprons() override;
+
+    virtual void setDimensions(size3_t dimensions) override;
+    virtual const size3_t& getDimensions() const override;
+
+    virtual void setSwizzleMask(const SwizzleMask& mask) override;
+    virtual SwizzleMask getSwizzleMask() const override;
+
+    virtual void setInterpolation(InterpolationType interpolation) override;
+    virtual InterpolationType getInterpolation() const override;
+
+    virtual void setWrapping(const Wrapping3D& wrapping) override;
+    virtual Wrapping3D getWrapping() const override;
+
+    virtual size_t getNumberOfBytes() const override;
+
+private:
+    /**
+     * Number of voxels of all bricks, including the aprons
+     */
+    size_t size() const;
+    size_t brickIndex(const size3_t& brick) const;
+    /**
+     * Fill the padded @p brick, starting at @p dst, by clamped lookups into @p source, which has
+     * the layout of the volume
+     */
+    template <typename Source>
+    void fillBrick(const size3_t& brick, T* dst, Source source, bool skipInterior);
+
+    size3_t dimensions_;
+    RAMStorage<T> data_;
+    SwizzleMask swizzleMask_;
+    InterpolationType interpolation_;
+    Wrapping3D wrapping_;
+};
+
+/**
+ * Factory for bricked volumes.
+ * Creates an VolumeBrickedRAM with data type specified by format.
+ * @return nullptr if no valid format was specified.
+ */
+IVW_CORE_API std::shared_ptr<VolumeBrickedRAM> createVolumeBrickedRAM(
+    const size3_t& dimensions, const DataFormatBase* format,
+    size_t brickSize = VolumeBrickedRAM::defaultBrickSize,
+    size_t apron = VolumeBrickedRAM::defaultApron,
+    const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+    InterpolationType interpolation = InterpolationType::Linear,
+    const Wrapping3D& wrapping = wrapping3d::clampAll);
+
+/**
+ * Factory for bricked volumes with memory allocated according to @p allocation.
+ * Use RAMAllocation::uninitialized() to skip zeroing the data when all of it will be overwritten.
+ * @return nullptr if no valid format was specified.
+ */
+IVW_CORE_API std::shared_ptr<VolumeBrickedRAM> createVolumeBrickedRAM(
+    const size3_t& dimensions, const DataFormatBase* format, const RAMAllocation& allocation,
+    size_t brickSize = VolumeBrickedRAM::defaultBrickSize,
+    size_t apron = VolumeBrickedRAM::defaultApron,
+    const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+    InterpolationType interpolation = InterpolationType::Linear,
+    const Wrapping3D& wrapping = wrapping3d::clampAll);
+
+template <typename T>
+VolumeBrickedRAMPrecision<T>::VolumeBrickedRAMPrecision(size3_t dimensions, size_t brickSize,
+                                                        size_t apron,
+                                                        const SwizzleMask& swizzleMask,
+                                                        InterpolationType interpolation,
+                                                        const Wrapping3D& wrapping)
+    : VolumeBrickedRAM(DataFormat<T>::get(), brickSize, apron)
+    , dimensions_(dimensions)
+    , data_(util::makeRAMArray<T>(size()))
+    , swizzleMask_(swizzleMask)
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {}
+
+template <typename T>
+VolumeBrickedRAMPrecision<T>::VolumeBrickedRAMPrecision(size3_t dimensions,
+                                                        const RAMAllocation& allocation,
+                                                        size_t brickSize, size_t apron,
+                                                        const SwizzleMask& swizzleMask,
+                                                        InterpolationType interpolation,
+                                                        const Wrapping3D& wrapping)
+    : VolumeBrickedRAM(DataFormat<T>::get(), brickSize, apron)
+    , dimensions_(dimensions)
+    , data_(util::makeRAMArray<T>(size(), allocation))
+    , swizzleMask_(swizzleMask)
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {}
+
+template <typename T>
+VolumeBrickedRAMPrecision<T>* VolumeBrickedRAMPrecision<T>::clone() const {
+    return new VolumeBrickedRAMPrecision<T>(*this);
+}
+
+template <typename T>
+void VolumeBrickedRAMPrecision<T>::detach() {
+    data_.detach(size());
+}
+
+template <typename T>
+size_t VolumeBrickedRAMPrecision<T>::size() const {
+    const auto padded = getPaddedBrickSize();
+    return glm::compMul(getBrickCount()) * padded * padded * padded;
+}
+
+template <typename T>
+size_t VolumeBrickedRAMPrecision<T>::brickIndex(const size3_t& brick) const {
+    const auto padded = getPaddedBrickSize();
+    return util::IndexMapper3D{getBrickCount()}(brick) * padded * padded * padded;
+}
+
+template <typename T>
+T* VolumeBrickedRAMPrecision<T>::getBrickDataTyped(const size3_t& brick) {
+    return data_.edit(size()) + brickIndex(brick);
+}
+
+template <typename T>
+const T* VolumeBrickedRAMPrecision<T>::getBrickDataTyped(const size3_t& brick) const {
+    return data_.data() + brickIndex(brick);
+}
+
+template <typename T>
+void* VolumeBrickedRAMPrecision<T>::getBrickData(const size3_t& brick) {
+    return getBrickDataTyped(brick);
+}
+
+template <typename T>
+const void* VolumeBrickedRAMPrecision<T>::getBrickData(const size3_t& brick) const {
+    return getBrickDataTyped(brick);
+}
+
+template <typename T>
+util::BrickIterator<T*> VolumeBrickedRAMPrecision<T>::brickIterator(const size3_t& brick) {
+    return util::BrickIterator<T*>{getBrickDataTyped(brick), size3_t{getPaddedBrickSize()},
+                                   size3_t{apron_}, getBrickExtent(brick)};
+}
+
+template <typename T>
+util::BrickIterator<const T*> VolumeBrickedRAMPrecision<T>::brickIterator(
+    const size3_t& brick) const {
+    return util::BrickIterator<const T*>{getBrickDataTyped(brick), size3_t{getPaddedBrickSize()},
+                                         size3_t{apron_}, getBrickExtent(brick)};
+}
+
+template <typename T>
+T& VolumeBrickedRAMPrecision<T>::voxel(const size3_t& pos) {
+    const util::IndexMapper3D im{size3_t{getPaddedBrickSize()}};
+    return getBrickDataTyped(pos / brickSize_)[im(pos % brickSize_ + apron_)];
+}
+
+template <typename T>
+const T& VolumeBrickedRAMPrecision<T>::voxel(const size3_t& pos) const {
+    const util::IndexMapper3D im{size3_t{getPaddedBrickSize()}};
+    return getBrickDataTyped(pos / brickSize_)[im(pos % brickSize_ + apron_)];
+}
+
+template <typename T>
+double VolumeBrickedRAMPrecision<T>::getAsDouble(const size3_t& pos) const {
+    return util::glm_convert<double>(voxel(pos));
+}
+
+template <typename T>
+dvec4 VolumeBrickedRAMPrecision<T>::getAsDVec4(const size3_t& pos) const {
+    return util::glm_convert<dvec4>(voxel(pos));
+}
+
+template <typename T>
+template <typename Source>
+void VolumeBrickedRAMPrecision<T>::fillBrick(const size3_t& brick, T* dst, Source source,
+                                             bool skipInterior) {
+    const auto padded = getPaddedBrickSize();
+    const auto offset = getBrickOffset(brick);
+    const auto extent = getBrickExtent(brick);
+    const auto maxPos = dimensions_ - size3_t{1};
+    const auto clamp = [&](size_t p, size_t i) -> size_t {
+        // p is a position in the padded brick, return the clamped position in the volume
+        if (p + offset[i] < apron_) return 0;
+        return std::min(p + offset[i] - apron_, maxPos[i]);
+    };
+
+    for (size_t z = 0; z < padded; ++z) {
+        const bool zIn = z >= apron_ && z < apron_ + extent.z;
+        for (size_t y = 0; y < padded; ++y) {
+            const bool yIn = y >= apron_ && y < apron_ + extent.y;
+            for (size_t x = 0; x < padded; ++x, ++dst) {
+                if (skipInterior && zIn && yIn && x >= apron_ && x < apron_ + extent.x) {
+                    // Jump to the end of the interior of the row
+                    dst += extent.x - 1;
+                    x += extent.x - 1;
+                    continue;
+                }
+                *dst = source(size3_t{clamp(x, 0), clamp(y, 1), clamp(z, 2)});
+            }
+        }
+    }
+}
+
+template <typename T>
+void VolumeBrickedRAMPrecision<T>::copyFrom(const VolumeRAM& source) {
+    IVW_ASSERT(source.getDataFormat() == getDataFormat(), "Format mismatch");
+    IVW_ASSERT(source.getDimensions() == dimensions_, "Dimension mismatch");
+
+    const auto* src = static_cast<const T*>(source.getData());
+    auto* dst = data_.edit(size());
+    const util::IndexMapper3D im{dimensions_};
+    util::forEachVoxel(getBrickCount(), [&](const size3_t& brick) {
+        fillBrick(
+            brick, dst + brickIndex(brick), [&](const size3_t& pos) { return src[im(pos)]; },
+            false);
+    });
+}
+
+template <typename T>
+void VolumeBrickedRAMPrecision<T>::copyTo(VolumeRAM& dest) const {
+    IVW_ASSERT(dest.getDataFormat() == getDataFormat(), "Format mismatch");
+    IVW_ASSERT(dest.getDimensions() == dimensions_, "Dimension mismatch");
+
+    auto* dst = static_cast<T*>(dest.getData());
+    const util::IndexMapper3D im{dimensions_};
+    const util::IndexMapper3D bim{size3_t{getPaddedBrickSize()}};
+    util::forEachVoxel(getBrickCount(), [&](const size3_t& brick) {
+        const T* src = getBrickDataTyped(brick);
+        const auto offset = getBrickOffset(brick);
+        const auto extent = getBrickExtent(brick);
+        for (size_t z = 0; z < extent.z; ++z) {
+            for (size_t y = 0; y < extent.y; ++y) {
+                std::copy_n(src + bim(size3_t{apron_, y + apron_, z + apron_}), extent.x,
+                            dst + im(offset + size3_t{0, y, z}));
+            }
+        }
+    });
+}
+
+template <typename T>
+void VolumeBrickedRAMPrecision<T>::updateAprons() {
+    if (apron_ == 0 && dimensions_ % brickSize_ == size3_t{0}) return;
+    auto* dst = data_.edit(size());
+    const auto& self = std::as_const(*this);
+    util::forEachVoxel(getBrickCount(), [&](const size3_t& brick) {
+        fillBrick(
+            brick, dst + brickIndex(brick), [&](const size3_t& pos) { return self.voxel(pos); },
+            true);
+    });
+}
+
+template <typename T>
+void VolumeBrickedRAMPrecision<T>::setDimensions(size3_t dimensions) {
+    if (dimensions_ != dimensions) {
+        dimensions_ = dimensions;
+        data_ = RAMStorage<T>{util::makeRAMArray<T>(size())};
+    }
+}
+
+template <typename T>
+const size3_t& VolumeBrickedRAMPrecision<T>::getDimensions() const {
+    return dimensions_;
+}
+
+template <typename T>
+void VolumeBrickedRAMPrecision<T>::setSwizzleMask(const SwizzleMask& mask) {
+    swizzleMask_ = mask;
+}
+
+template <typename T>
+SwizzleMask VolumeBrickedRAMPrecision<T>::getSwizzleMask() const {
+    return swizzleMask_;
+}
+
+template <typename T>
+void VolumeBrickedRAMPrecision<T>::setInterpolation(InterpolationType interpolation) {
+    interpolation_ = interpolation;
+}
+
+template <typename T>
+InterpolationType VolumeBrickedRAMPrecision<T>::getInterpolation() const {
+    return interpolation_;
+}
+
+template <typename T>
+void VolumeBrickedRAMPrecision<T>::setWrapping(const Wrapping3D& wrapping) {
+    wrapping_ = wrapping;
+}
+
+template <typename T>
+Wrapping3D VolumeBrickedRAMPrecision<T>::getWrapping() const {
+    return wrapping_;
+}
+
+template <typename T>
+size_t VolumeBrickedRAMPrecision<T>::getNumberOfBytes() const {
+    return size() * sizeof(T);
+}
+
+namespace detail {
+struct VolumeBrickedRamDispatcher {
+    template <typename Result, typename Format, typename Callable, typename... Args>
+    Result operator()(Callable&& obj, VolumeBrickedRAM* volume, Args... args) {
+        return obj(static_cast<VolumeBrickedRAMPrecision<typename Format::type>*>(volume),
+                   std::forward<Args>(args)...);
+    }
+};
+
+struct VolumeBrickedRamConstDispatcher {
+    template <typename Result, typename Format, typename Callable, typename... Args>
+    Result operator()(Callable&& obj, const VolumeBrickedRAM* volume, Args... args) {
+        return obj(static_cast<const VolumeBrickedRAMPrecision<typename Format::type>*>(volume),
+                   std::forward<Args>(args)...);
+    }
+};
+}  // namespace detail
+
+template <typename Result, template <class> class Predicate, typename Callable, typename... Args>
+auto VolumeBrickedRAM::dispatch(Callable&& callable, Args&&... args) -> Result {
+    detail::VolumeBrickedRamDispatcher dispatcher;
+    return dispatching::dispatch<Result, Predicate>(getDataFormatId(), dispatcher,
+                                                    std::forward<Callable>(callable), this,
+                                                    std::forward<Args>(args)...);
+}
+
+template <typename Result, template <class> class Predicate, typename Callable, typename... Args>
+auto VolumeBrickedRAM::dispatch(Callable&& callable, Args&&... args) const -> Result {
+    detail::VolumeBrickedRamConstDispatcher dispatcher;
+    return dispatching::dispatch<Result, Predicate>(getDataFormatId(), dispatcher,
+                                                    std::forward<Callable>(callable), this,
+                                                    std::forward<Args>(args)...);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,156 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+class VolumeRAM;
+
+/**
+ * \ingroup datastructures
+ * \brief A losslessly compressed RAM representation of a volume
+ *
+ * The volume is split into cubic bricks of `getBrickSize()` voxels along each axis, and each brick
+ * is compressed independently with util::compressBrick. Hence single bricks can be decompressed
+ * quickly without touching the rest of the volume. Label and segmentation volumes typically shrink
+ * by a factor of 10 to 50, smooth data by less, and noisy data is stored uncompressed.
+ *
+ * Converters to and from VolumeRAM are registered by the core module, and the
+ * IdleCompressionManager uses this representation to compress volumes that are not in use.
+ * The representation is immutable apart from its metadata, modify the voxels through a VolumeRAM.
+ * @see util::compressBrick, IdleCompressionManager
+ */
+class IVW_CORE_API VolumeCompressedRAM final : public VolumeRepresentation {
+public:
+    static constexpr size_t defaultBrickSize = 32;
+
+    /**
+     * Create a compressed volume where all voxels are zero
+     */
+    VolumeCompressedRAM(size3_t dimensions, const DataFormatBase* format,
+                        size_t brickSize = defaultBrickSize,
+                        const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+                        InterpolationType interpolation = InterpolationType::Linear,
+                        const Wrapping3D& wrapping = wrapping3d::clampAll);
+    /**
+     * Create a compressed copy of @p source
+     */
+    explicit VolumeCompressedRAM(const VolumeRAM& source, size_t brickSize = defaultBrickSize);
+    VolumeCompressedRAM(const VolumeCompressedRAM& rhs) = default;
+    VolumeCompressedRAM& operator=(const VolumeCompressedRAM& that) = default;
+    virtual VolumeCompressedRAM* clone() const override;
+    virtual ~VolumeCompressedRAM() = default;
+
+    virtual std::type_index getTypeIndex() const override;
+
+    /**
+     * Number of voxels of a brick along each axis
+     */
+    size_t getBrickSize() const { return brickSize_; }
+    /**
+     * Number of bricks along each axis
+     */
+    size3_t getBrickCount() const;
+    /**
+     * Position of the first voxel of @p brick in the volume
+     */
+    size3_t getBrickOffset(const size3_t& brick) const { return brick * brickSize_; }
+    /**
+     * Number of voxels of @p brick that are inside of the volume
+     */
+    size3_t getBrickExtent(const size3_t& brick) const;
+
+    /**
+     * Compress all the voxels of @p source, which has to have the same format and dimensions.
+     * The bricks are compressed in parallel.
+     */
+    void compress(const VolumeRAM& source);
+    /**
+     * Decompress all the voxels into @p dest, which has to have the same format and dimensions.
+     * The bricks are decompressed in parallel.
+     */
+    void decompress(VolumeRAM& dest) const;
+    /**
+     * Decompress the voxels of @p brick into @p dest, which has to have room for
+     * `glm::compMul(getBrickExtent(brick))` voxels. The voxels are linearized in x, then y, then z.
+     */
+    void decompressBrick(const size3_t& brick, void* dest) const;
+    /**
+     * The compressed data of @p brick as produced by util::compressBrick, empty if all the voxels
+     * of the brick are zero.
+     */
+    std::span<const std::byte> getCompressedBrick(const size3_t& brick) const;
+
+    /**
+     * Resize the representation to @p dimensions. This is destructive, all voxels will be zero.
+     */
+    virtual void setDimensions(size3_t dimensions) override;
+    virtual const size3_t& getDimensions() const override;
+
+    virtual void setSwizzleMask(const SwizzleMask& mask) override;
+    virtual SwizzleMask getSwizzleMask() const override;
+
+    virtual void setInterpolation(InterpolationType interpolation) override;
+    virtual InterpolationType getInterpolation() const override;
+
+    virtual void setWrapping(const Wrapping3D& wrapping) override;
+    virtual Wrapping3D getWrapping() const override;
+
+    /**
+     * The number of bytes used by the compressed voxels
+     */
+    size_t getNumberOfBytes() const;
+    /**
+     * The number of bytes the voxels would use uncompressed
+     */
+    size_t getUncompressedNumberOfBytes() const;
+
+private:
+    size_t brickIndex(const size3_t& brick) const;
+
+    size3_t dimensions_;
+    size_t brickSize_;
+    // One compressed brick per entry, empty for bricks that have never been written, i.e. zero
+    std::vector<std::vector<std::byte>> bricks_;
+    SwizzleMask swizzleMask_;
+    InterpolationType interpolation_;
+    Wrapping3D wrapping_;
+};
+
+}  // namespace inviwo
@@ -34,8 +34,30 @@
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 
+#include <memory>
+
 namespace inviwo {
 
+class VolumeRAM;
+
+/**
+ * \ingroup datastructures
+ * Interface for loaders of VolumeDisk representations that can read a subregion of the volume
+ * without reading all of it. Loaders implement this in addition to
+ * DiskRepresentationLoader<VolumeRepresentation>.
+ * @see VolumeDisk::readRegion
+ */
+class IVW_CORE_API VolumeRegionLoader {
+public:
+    virtual ~VolumeRegionLoader() = default;
+    /**
+     * Read the voxels of @p src in the box starting at @p offset with size @p extent into a
+     * new VolumeRAM of dimensions @p extent.
+     */
+    virtual std::shared_ptr<VolumeRAM> readRegion(const VolumeRepresentation& src, size3_t offset,
+                                                  size3_t extent) const = 0;
+};
+
 /**
  * \ingroup datastructures
  */
@@ -76,6 +98,17 @@ public:
     virtual void setWrapping(const Wrapping3D& wrapping) override;
     virtual Wrapping3D getWrapping() const override;
 
+    /**
+     * Returns true if the loader supports reading subregions, @see VolumeRegionLoader
+     */
+    bool canReadRegion() const;
+    /**
+     * Read the box starting at @p offset with size @p extent into a new VolumeRAM.
+     * @throws Exception if the loader does not support reading subregions or the box is not
+     * inside of the volume.
+     */
+    std::shared_ptr<VolumeRAM> readRegion(size3_t offset, size3_t extent) const;
+
 private:
     size3_t dimensions_;
     SwizzleMask swizzleMask_;
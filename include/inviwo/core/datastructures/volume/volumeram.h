@@ -35,8 +35,11 @@
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/util/formats.h>
 #include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/ramallocation.h>
 #include <inviwo/core/util/stdextensions.h>
 
+#include <memory>
+
 namespace inviwo {
 
 class HistogramCalculationState;
@@ -173,14 +176,40 @@ public:
                                 const SwizzleMask& swizzleMask = swizzlemasks::rgba,
                                 InterpolationType interpolation = InterpolationType::Linear,
                                 const Wrapping3D& wrapping = wrapping3d::clampAll);
+    /**
+     * Create a volume with memory allocated and initialized according to @p allocation, for
+     * example use RAMAllocation::uninitialized() when all the voxels will be overwritten.
+     */
+    VolumeRAMPrecision(size3_t dimensions, const RAMAllocation& allocation,
+                       const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+                       InterpolationType interpolation = InterpolationType::Linear,
+                       const Wrapping3D& wrapping = wrapping3d::clampAll);
     VolumeRAMPrecision(T* data, size3_t dimensions,
                        const SwizzleMask& swizzleMask = swizzlemasks::rgba,
                        InterpolationType interpolation = InterpolationType::Linear,
                        const Wrapping3D& wrapping = wrapping3d::clampAll);
-    VolumeRAMPrecision(const VolumeRAMPrecision<T>& rhs);
-    VolumeRAMPrecision<T>& operator=(const VolumeRAMPrecision<T>& that);
+    /**
+     * Create a volume that uses data owned by @p storage, for example a memory mapped file. The
+     * volume keeps @p storage alive until the data is replaced, but never takes ownership of
+     * @p data. Copies of the volume share @p storage until they are detached.
+     * @p data does not have to be aligned, such volumes are not covered by the alignment of
+     * RAMAllocation.
+     */
+    VolumeRAMPrecision(std::shared_ptr<void> storage, T* data, size3_t dimensions,
+                       const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+                       InterpolationType interpolation = InterpolationType::Linear,
+                       const Wrapping3D& wrapping = wrapping3d::clampAll);
+    /**
+     * Copies share the voxel data until one of them is written to. The non-const accessors, like
+     * getDataTyped() and setFromDouble(), first copy the data if it is shared. Pointers from them
+     * stay valid until the volume is copied.
+     */
+    VolumeRAMPrecision(const VolumeRAMPrecision<T>& rhs) = default;
+    VolumeRAMPrecision<T>& operator=(const VolumeRAMPrecision<T>& that) = default;
     virtual VolumeRAMPrecision<T>* clone() const override;
-    virtual ~VolumeRAMPrecision();
+    virtual ~VolumeRAMPrecision() = default;
+
+    virtual void detach() override;
 
     T* getDataTyped();
     const T* getDataTyped() const;
@@ -236,8 +265,7 @@ public:
 
 private:
     size3_t dimensions_;
-    bool ownsDataPtr_;
-    std::unique_ptr<T[]> data_;
+    RAMStorage<T> data_;
     SwizzleMask swizzleMask_;
     InterpolationType interpolation_;
     Wrapping3D wrapping_;
@@ -261,6 +289,43 @@ IVW_CORE_API std::shared_ptr<VolumeRAM> createVolumeRAM(
     InterpolationType interpolation = InterpolationType::Linear,
     const Wrapping3D& wrapping = wrapping3d::clampAll);
 
+/**
+ * Factory for volumes with memory allocated according to @p allocation.
+ * Use RAMAllocation::uninitialized() to skip zeroing the data when all of it will be overwritten.
+ *
+ * @param dimensions of volume to create.
+ * @param format of volume to create.
+ * @param allocation how the data is allocated and initialized.
+ * @param swizzleMask of volume to create.
+ * @param interpolation of volume to create.
+ * @param wrapping of volume to create.
+ * @return nullptr if no valid format was specified.
+ */
+IVW_CORE_API std::shared_ptr<VolumeRAM> createVolumeRAM(
+    const size3_t& dimensions, const DataFormatBase* format, const RAMAllocation& allocation,
+    const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+    InterpolationType interpolation = InterpolationType::Linear,
+    const Wrapping3D& wrapping = wrapping3d::clampAll);
+
+/**
+ * Factory for volumes using data owned by @p storage, see the corresponding VolumeRAMPrecision
+ * constructor.
+ *
+ * @param storage that owns the data, kept alive by the volume.
+ * @param dataPtr pointer to the data of the volume, must not be null.
+ * @param dimensions of volume to create.
+ * @param format of volume to create.
+ * @param swizzleMask of volume to create.
+ * @param interpolation of volume to create.
+ * @param wrapping of volume to create.
+ * @return nullptr if no valid format was specified.
+ */
+IVW_CORE_API std::shared_ptr<VolumeRAM> createVolumeRAM(
+    std::shared_ptr<void> storage, void* dataPtr, const size3_t& dimensions,
+    const DataFormatBase* format, const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+    InterpolationType interpolation = InterpolationType::Linear,
+    const Wrapping3D& wrapping = wrapping3d::clampAll);
+
 template <typename T>
 T VolumeRAM::posToIndex(const glm::tvec3<T, glm::defaultp>& pos,
                         const glm::tvec3<T, glm::defaultp>& dim) {
@@ -280,107 +345,96 @@ VolumeRAMPrecision<T>::VolumeRAMPrecision(size3_t dimensions, const SwizzleMask&
                                           const Wrapping3D& wrapping)
     : VolumeRAM(DataFormat<T>::get())
     , dimensions_(dimensions)
-    , ownsDataPtr_(true)
-    , data_(new T[dimensions_.x * dimensions_.y * dimensions_.z]())
+    , data_(util::makeRAMArray<T>(dimensions_.x * dimensions_.y * dimensions_.z))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
     , wrapping_{wrapping} {}
 
 template <typename T>
-VolumeRAMPrecision<T>::VolumeRAMPrecision(T* data, size3_t dimensions,
+VolumeRAMPrecision<T>::VolumeRAMPrecision(size3_t dimensions, const RAMAllocation& allocation,
                                           const SwizzleMask& swizzleMask,
                                           InterpolationType interpolation,
                                           const Wrapping3D& wrapping)
     : VolumeRAM(DataFormat<T>::get())
     , dimensions_(dimensions)
-    , ownsDataPtr_(true)
-    , data_(data ? data : new T[dimensions_.x * dimensions_.y * dimensions_.z]())
+    , data_(util::makeRAMArray<T>(dimensions_.x * dimensions_.y * dimensions_.z, allocation))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
     , wrapping_{wrapping} {}
 
 template <typename T>
-VolumeRAMPrecision<T>::VolumeRAMPrecision(const VolumeRAMPrecision<T>& rhs)
-    : VolumeRAM(rhs)
-    , dimensions_(rhs.dimensions_)
-    , ownsDataPtr_(true)
-    , data_(new T[dimensions_.x * dimensions_.y * dimensions_.z])
-    , swizzleMask_(rhs.swizzleMask_)
-    , interpolation_{rhs.interpolation_}
-    , wrapping_{rhs.wrapping_} {
-    std::memcpy(data_.get(), rhs.data_.get(),
-                dimensions_.x * dimensions_.y * dimensions_.z * sizeof(T));
-}
-
-template <typename T>
-VolumeRAMPrecision<T>& VolumeRAMPrecision<T>::operator=(const VolumeRAMPrecision<T>& that) {
-    if (this != &that) {
-        VolumeRAM::operator=(that);
-        auto dim = that.dimensions_;
-        auto data = std::make_unique<T[]>(dim.x * dim.y * dim.z);
-        std::memcpy(data.get(), that.data_.get(), dim.x * dim.y * dim.z * sizeof(T));
-        data_.swap(data);
-        std::swap(dim, dimensions_);
-        ownsDataPtr_ = true;
-        swizzleMask_ = that.swizzleMask_;
-        interpolation_ = that.interpolation_;
-        wrapping_ = that.wrapping_;
-    }
-    return *this;
-}
+VolumeRAMPrecision<T>::VolumeRAMPrecision(T* data, size3_t dimensions,
+                                          const SwizzleMask& swizzleMask,
+                                          InterpolationType interpolation,
+                                          const Wrapping3D& wrapping)
+    : VolumeRAM(DataFormat<T>::get())
+    , dimensions_(dimensions)
+    , data_(data ? RAMArray<T>{data}
+                 : util::makeRAMArray<T>(dimensions_.x * dimensions_.y * dimensions_.z))
+    , swizzleMask_(swizzleMask)
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {}
 
 template <typename T>
-VolumeRAMPrecision<T>::~VolumeRAMPrecision() {
-    if (!ownsDataPtr_) data_.release();
-}
+VolumeRAMPrecision<T>::VolumeRAMPrecision(std::shared_ptr<void> storage, T* data,
+                                          size3_t dimensions, const SwizzleMask& swizzleMask,
+                                          InterpolationType interpolation,
+                                          const Wrapping3D& wrapping)
+    : VolumeRAM(DataFormat<T>::get())
+    , dimensions_(dimensions)
+    , data_(std::move(storage), data)
+    , swizzleMask_(swizzleMask)
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {}
 
 template <typename T>
 VolumeRAMPrecision<T>* VolumeRAMPrecision<T>::clone() const {
     return new VolumeRAMPrecision<T>(*this);
 }
 
+template <typename T>
+void VolumeRAMPrecision<T>::detach() {
+    data_.detach(dimensions_.x * dimensions_.y * dimensions_.z);
+}
+
 template <typename T>
 const T* inviwo::VolumeRAMPrecision<T>::getDataTyped() const {
-    return data_.get();
+    return data_.data();
 }
 
 template <typename T>
 T* inviwo::VolumeRAMPrecision<T>::getDataTyped() {
-    return data_.get();
+    return data_.edit(dimensions_.x * dimensions_.y * dimensions_.z);
 }
 
 template <typename T>
 void* VolumeRAMPrecision<T>::getData() {
-    return data_.get();
+    return data_.edit(dimensions_.x * dimensions_.y * dimensions_.z);
 }
 template <typename T>
 const void* VolumeRAMPrecision<T>::getData() const {
-    return const_cast<const T*>(data_.get());
+    return data_.data();
 }
 
 template <typename T>
 void* VolumeRAMPrecision<T>::getData(size_t pos) {
-    return data_.get() + pos;
+    return getDataTyped() + pos;
 }
 
 template <typename T>
 const void* VolumeRAMPrecision<T>::getData(size_t pos) const {
-    return const_cast<const T*>(data_.get()) + pos;
+    return data_.data() + pos;
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setData(void* d, size3_t dimensions) {
-    std::unique_ptr<T[]> data(static_cast<T*>(d));
-    data_.swap(data);
-    std::swap(dimensions_, dimensions);
-
-    if (!ownsDataPtr_) data.release();
-    ownsDataPtr_ = true;
+    data_ = RAMStorage<T>{RAMArray<T>{static_cast<T*>(d)}};
+    dimensions_ = dimensions;
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::removeDataOwnership() {
-    ownsDataPtr_ = false;
+    data_.release(dimensions_.x * dimensions_.y * dimensions_.z);
 }
 
 template <typename T>
@@ -396,11 +450,8 @@ size_t VolumeRAMPrecision<T>::getNumberOfBytes() const {
 template <typename T>
 void VolumeRAMPrecision<T>::setDimensions(size3_t dimensions) {
     if (dimensions_ != dimensions) {
-        auto data = std::make_unique<T[]>(dimensions.x * dimensions.y * dimensions.z);
-        data_.swap(data);
+        data_ = RAMStorage<T>{util::makeRAMArray<T>(dimensions.x * dimensions.y * dimensions.z)};
         dimensions_ = dimensions;
-        if (!ownsDataPtr_) data.release();
-        ownsDataPtr_ = true;
     }
 }
 
@@ -436,82 +487,82 @@ Wrapping3D VolumeRAMPrecision<T>::getWrapping() const {
 
 template <typename T>
 double VolumeRAMPrecision<T>::getAsDouble(const size3_t& pos) const {
-    return util::glm_convert<double>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<double>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec2 VolumeRAMPrecision<T>::getAsDVec2(const size3_t& pos) const {
-    return util::glm_convert<dvec2>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<dvec2>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec3 VolumeRAMPrecision<T>::getAsDVec3(const size3_t& pos) const {
-    return util::glm_convert<dvec3>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<dvec3>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec4 VolumeRAMPrecision<T>::getAsDVec4(const size3_t& pos) const {
-    return util::glm_convert<dvec4>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<dvec4>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDouble(const size3_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDVec2(const size3_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDVec3(const size3_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDVec4(const size3_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 double VolumeRAMPrecision<T>::getAsNormalizedDouble(const size3_t& pos) const {
-    return util::glm_convert_normalized<double>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<double>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec2 VolumeRAMPrecision<T>::getAsNormalizedDVec2(const size3_t& pos) const {
-    return util::glm_convert_normalized<dvec2>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<dvec2>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec3 VolumeRAMPrecision<T>::getAsNormalizedDVec3(const size3_t& pos) const {
-    return util::glm_convert_normalized<dvec3>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<dvec3>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec4 VolumeRAMPrecision<T>::getAsNormalizedDVec4(const size3_t& pos) const {
-    return util::glm_convert_normalized<dvec4>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<dvec4>(data_.data()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDouble(const size3_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDVec2(const size3_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDVec3(const size3_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDVec4(const size3_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    getDataTyped()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 namespace detail {
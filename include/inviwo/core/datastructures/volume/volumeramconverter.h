@@ -32,6 +32,8 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/datastructures/representationconverter.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumebrickedram.h>
+#include <inviwo/core/datastructures/volume/volumecompressedram.h>
 #include <inviwo/core/datastructures/volume/volumedisk.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 
@@ -40,10 +42,47 @@ namespace inviwo {
 class IVW_CORE_API VolumeDisk2RAMConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeDisk, VolumeRAM> {
 public:
+    virtual double getCost() const override { return convertercost::disk; }
     virtual std::shared_ptr<VolumeRAM> createFrom(
         std::shared_ptr<const VolumeDisk> source) const override;
     virtual void update(std::shared_ptr<const VolumeDisk> source,
                         std::shared_ptr<VolumeRAM> destination) const override;
 };
 
+class IVW_CORE_API VolumeRAM2BrickedRAMConverter
+    : public RepresentationConverterType<VolumeRepresentation, VolumeRAM, VolumeBrickedRAM> {
+public:
+    virtual std::shared_ptr<VolumeBrickedRAM> createFrom(
+        std::shared_ptr<const VolumeRAM> source) const override;
+    virtual void update(std::shared_ptr<const VolumeRAM> source,
+                        std::shared_ptr<VolumeBrickedRAM> destination) const override;
+};
+
+class IVW_CORE_API VolumeBrickedRAM2RAMConverter
+    : public RepresentationConverterType<VolumeRepresentation, VolumeBrickedRAM, VolumeRAM> {
+public:
+    virtual std::shared_ptr<VolumeRAM> createFrom(
+        std::shared_ptr<const VolumeBrickedRAM> source) const override;
+    virtual void update(std::shared_ptr<const VolumeBrickedRAM> source,
+                        std::shared_ptr<VolumeRAM> destination) const override;
+};
+
+class IVW_CORE_API VolumeRAM2CompressedRAMConverter
+    : public RepresentationConverterType<VolumeRepresentation, VolumeRAM, VolumeCompressedRAM> {
+public:
+    virtual std::shared_ptr<VolumeCompressedRAM> createFrom(
+        std::shared_ptr<const VolumeRAM> source) const override;
+    virtual void update(std::shared_ptr<const VolumeRAM> source,
+                        std::shared_ptr<VolumeCompressedRAM> destination) const override;
+};
+
+class IVW_CORE_API VolumeCompressedRAM2RAMConverter
+    : public RepresentationConverterType<VolumeRepresentation, VolumeCompressedRAM, VolumeRAM> {
+public:
+    virtual std::shared_ptr<VolumeRAM> createFrom(
+        std::shared_ptr<const VolumeCompressedRAM> source) const override;
+    virtual void update(std::shared_ptr<const VolumeCompressedRAM> source,
+                        std::shared_ptr<VolumeRAM> destination) const override;
+};
+
 }  // namespace inviwo
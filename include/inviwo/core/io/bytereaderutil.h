@@ -30,14 +30,60 @@
 #pragma once
 
 #include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/cancellationtoken.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <cstddef>
+#include <functional>
 #include <string_view>
 
 namespace inviwo {
 
 namespace util {
 
-void IVW_CORE_API readBytesIntoBuffer(std::string_view file, size_t offset, size_t bytes,
-                                      bool littleEndian, size_t elementSize, void* dest);
+/**
+ * Called with the number of bytes read so far and the total number of bytes to read.
+ */
+using ReadProgress = std::function<void(size_t read, size_t total)>;
+
+/**
+ * Read @p bytes from @p file, starting at @p offset, into @p dest. If @p littleEndian is false
+ * the bytes of each element of @p elementSize bytes are reversed after reading.
+ *
+ * Large reads are split into chunks that are read with positional reads and byte swapped in
+ * parallel on the thread pool. @p progress is called after each chunk, possibly from a worker
+ * thread but never concurrently. If @p token is cancelled no more chunks are read and the
+ * content of @p dest is undefined.
+ * @return false if the read was cancelled, true otherwise
+ * @throws DataReaderException if the file could not be opened or read
+ */
+IVW_CORE_API bool readBytesIntoBuffer(std::string_view file, size_t offset, size_t bytes,
+                                      bool littleEndian, size_t elementSize, void* dest,
+                                      const ReadProgress& progress = {},
+                                      const CancellationToken& token = {});
+
+/**
+ * Read the box starting at @p boxOffset with size @p boxExtent out of a volume of dimensions
+ * @p dims stored in @p file at @p offset, into @p dest, which has room for
+ * `glm::compMul(boxExtent)` elements of @p elementSize bytes. Only the rows of the box are read,
+ * with one positional read per row, or per z-slice when the box spans the whole x-axis of the
+ * volume. The z-slices are read in parallel on the thread pool.
+ * @return false if the read was cancelled by @p token, true otherwise
+ * @throws DataReaderException if the file could not be opened or read
+ * @see readBytesIntoBuffer
+ */
+IVW_CORE_API bool readBoxIntoBuffer(std::string_view file, size_t offset, size3_t dims,
+                                    size3_t boxOffset, size3_t boxExtent, bool littleEndian,
+                                    size_t elementSize, void* dest,
+                                    const CancellationToken& token = {});
+
+/**
+ * Reverse the byte order of each element of @p elementSize bytes in @p data in place.
+ * @p bytes has to be a multiple of @p elementSize. Element sizes of 2, 4, and 8 bytes use SIMD
+ * kernels when available.
+ */
+IVW_CORE_API void swapBytes(void* data, size_t bytes, size_t elementSize);
+
 }  // namespace util
 
 }  // namespace inviwo
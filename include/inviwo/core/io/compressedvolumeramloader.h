@@ -0,0 +1,92 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+namespace inviwo {
+
+class VolumeCompressedRAM;
+
+/**
+ * \class CompressedVolumeRAMLoader
+ * \brief A loader of volumes stored as independently compressed bricks. Used to create VolumeRAM
+ * representations. This class is used by the IvfVolumeReader for version 2 ivf files.
+ *
+ * The data starts at @p offset in the file with an index of `n + 1` little endian 64 bit
+ * integers, where `n` is the number of bricks. Entry `i` is the position of brick `i` relative to
+ * the end of the index, and the last entry is the total size of the bricks. The bricks follow
+ * the index, ordered in x, then y, then z, each compressed with util::compressBrick. Bricks of
+ * size zero have all voxels zero. The bricks are cubes of @p brickSize voxels, except at the
+ * upper borders of the volume where they are cut off. @see util::writeCompressedBricks
+ *
+ * Subregions are read without reading or decompressing the bricks outside of the region,
+ * @see VolumeDisk::readRegion.
+ */
+class IVW_CORE_API CompressedVolumeRAMLoader
+    : public DiskRepresentationLoader<VolumeRepresentation>,
+      public VolumeRegionLoader {
+public:
+    CompressedVolumeRAMLoader(const std::string& file, size_t offset, size_t brickSize);
+    virtual CompressedVolumeRAMLoader* clone() const override;
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override;
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                      const VolumeRepresentation& src) const override;
+
+    virtual std::shared_ptr<VolumeRAM> readRegion(const VolumeRepresentation& src, size3_t offset,
+                                                  size3_t extent) const override;
+
+private:
+    void read(const VolumeRepresentation& src, size3_t offset, size3_t extent,
+              VolumeRAM& dest) const;
+
+    std::string file_;
+    size_t offset_;
+    size_t brickSize_;
+};
+
+namespace util {
+
+/**
+ * Write the bricks of @p volume to @p out in the layout read by CompressedVolumeRAMLoader.
+ */
+IVW_CORE_API void writeCompressedBricks(const VolumeCompressedRAM& volume, std::ostream& out);
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -33,6 +33,7 @@
 #include <inviwo/core/io/bytereaderutil.h>
 #include <inviwo/core/io/datareaderexception.h>
 #include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>
 
 #include <string>
@@ -44,21 +45,38 @@ namespace inviwo {
  * \class RawVolumeRAMLoader
  * \brief A loader of raw files. Used to create VolumeRAM representations.
  * This class us used by the DatVolumeSequenceReader, IvfVolumeReader and RawVolumeReader.
+ *
+ * If @p memoryMap is set and the layout of the file matches the layout in memory, i.e. no byte
+ * swapping is needed, the created VolumeRAM will use a copy-on-write memory mapping of the file
+ * instead of reading it. Data is then read lazily from the file as it is accessed, and changes are
+ * never written back. Mapping is off by default since the file then must not be modified or
+ * overwritten while the volume is alive: external edits show up in the volume, and truncating the
+ * file crashes on access. Mapped data is also not aligned to RAMAllocation::defaultAlignment.
+ *
+ * Subregions can be read without reading the whole file, @see VolumeDisk::readRegion.
  */
 
-class IVW_CORE_API RawVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+class IVW_CORE_API RawVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation>,
+                                        public VolumeRegionLoader {
 public:
-    RawVolumeRAMLoader(const std::string& rawFile, size_t offset, bool littleEndian);
+    RawVolumeRAMLoader(const std::string& rawFile, size_t offset, bool littleEndian,
+                       bool memoryMap = false);
     virtual RawVolumeRAMLoader* clone() const override;
     virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
         const VolumeRepresentation& src) const override;
     virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
                                       const VolumeRepresentation& src) const override;
 
+    virtual std::shared_ptr<VolumeRAM> readRegion(const VolumeRepresentation& src, size3_t offset,
+                                                  size3_t extent) const override;
+
 private:
+    bool canMap(const DataFormatBase* format, size_t bytes) const;
+
     std::string rawFile_;
     size_t offset_;
     bool littleEndian_;
+    bool memoryMap_;
 };
 
 }  // namespace inviwo
@@ -37,14 +37,19 @@
 #include <inviwo/core/io/datareader.h>
 #include <inviwo/core/io/volumedatareaderdialog.h>
 
+#include <any>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace inviwo {
 class MetaDataOwner;
 
 /**
  * \ingroup dataio
+ * Supported options:
+ *   * "MemoryMap" (bool): memory map the file instead of reading it, if possible. Off by default,
+ *     the file must not be modified while the volume is alive. @see RawVolumeRAMLoader
  */
 class IVW_CORE_API RawVolumeReader : public DataReaderType<Volume> {
 public:
@@ -61,6 +66,9 @@ public:
     virtual std::shared_ptr<Volume> readData(std::string_view filePath,
                                              MetaDataOwner* metadata) override;
 
+    virtual bool setOption(std::string_view key, std::any value) override;
+    virtual std::any getOption(std::string_view key) override;
+
     bool haveReadLittleEndian() const { return littleEndian_; }
     const DataFormatBase* getFormat() const { return format_; }
 
@@ -73,6 +81,7 @@ private:
     DataMapper dataMapper_;
     size_t byteOffset_;
     bool parametersSet_;
+    bool memoryMap_;
 };
 
 }  // namespace inviwo
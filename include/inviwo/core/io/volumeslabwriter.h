@@ -0,0 +1,98 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/image/imagetypes.h>
+#include <inviwo/core/util/formats.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace inviwo {
+
+class VolumeDisk;
+class VolumeRAM;
+
+/**
+ * \class VolumeSlabWriter
+ * \brief Writes a volume to a raw file one slab of z-layers at a time
+ *
+ * Used by algorithms that process volumes in slabs to write results that do not fit into memory,
+ * @see util::forEachVolumeSlab. The layers have to be written in order. The raw file is written in
+ * the native byte order and can be read back through the VolumeDisk returned by finish().
+ * ```{.cpp}
+ * VolumeSlabWriter writer{"result.raw", volume.getDimensions(), DataVec3Float32::get()};
+ * util::forEachVolumeSlab(volume, depth, 1, [&](const util::VolumeSlab& slab) {
+ *     auto result = ...; // slab.depth layers
+ *     writer.write(*result, 0, slab.depth);
+ * });
+ * auto output = std::make_shared<Volume>(writer.finish());
+ * ```
+ */
+class IVW_CORE_API VolumeSlabWriter {
+public:
+    /**
+     * @throws DataWriterException if the file could not be opened
+     */
+    VolumeSlabWriter(std::string_view rawFile, size3_t dimensions, const DataFormatBase* format);
+
+    /**
+     * Append @p count layers of @p slab, starting at layer @p first of the slab. The slab has to
+     * have the format and x and y dimensions of the written volume.
+     * @throws DataWriterException if writing fails or the volume is already complete
+     */
+    void write(const VolumeRAM& slab, size_t first, size_t count);
+
+    /**
+     * The number of layers written so far
+     */
+    size_t getWrittenLayers() const;
+
+    /**
+     * Close the file and create a VolumeDisk representation that loads the written file.
+     * @throws DataWriterException if not all layers have been written
+     */
+    std::shared_ptr<VolumeDisk> finish(const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+                                       InterpolationType interpolation = InterpolationType::Linear,
+                                       const Wrapping3D& wrapping = wrapping3d::clampAll);
+
+private:
+    std::string rawFile_;
+    size3_t dimensions_;
+    const DataFormatBase* format_;
+    size_t layers_ = 0;
+    std::ofstream out_;
+};
+
+}  // namespace inviwo
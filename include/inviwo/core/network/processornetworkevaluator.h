@@ -35,11 +35,34 @@
 #include <inviwo/core/network/processornetworkevaluationobserver.h>
 #include <inviwo/core/network/evaluationerrorhandler.h>
 
+#include <exception>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace inviwo {
 
 class Processor;
 class ProcessorNetwork;
 
+/**
+ * How the ProcessorNetworkEvaluator traverses the network.
+ */
+enum class EvaluationMode {
+    /// Process one processor at a time in topological order on the calling thread
+    Serial,
+    /**
+     * Process independent branches concurrently. A processor is scheduled as soon as all its
+     * predecessors are done. Processors with ProcessingThread::Any are processed in the thread
+     * pool, all others on the calling thread. Resource initialization, port callbacks, and
+     * observer notifications always happen on the calling thread.
+     * @note Processors running in the pool must not block on tasks dispatched to the front thread
+     * @see ProcessorInfo::processingThread
+     */
+    Parallel
+};
+
 class IVW_CORE_API ProcessorNetworkEvaluator : public ProcessorNetworkObserver,
                                                public ProcessorObserver,
                                                public ProcessorNetworkEvaluationObservable {
@@ -50,6 +73,9 @@ public:
     virtual ~ProcessorNetworkEvaluator() = default;
     void setExceptionHandler(EvaluationErrorHandler handler);
 
+    void setEvaluationMode(EvaluationMode mode);
+    EvaluationMode getEvaluationMode() const;
+
 private:
     // ProcessorNetworkObserver overrides
     virtual void onProcessorNetworkEvaluateRequest() override;
@@ -60,18 +86,71 @@ private:
     virtual void onProcessorNetworkDidRemoveConnection(const PortConnection& connection) override;
 
     // ProcessorObserver overrides
+    virtual void onProcessorInvalidationBegin(Processor*) override;
     virtual void onProcessorSinkChanged(Processor*) override;
     virtual void onProcessorActiveConnectionsChanged(Processor*) override;
 
     void requestEvaluate();
     void evaluate();
+    void evaluateSerial(const std::vector<Processor*>& worklist);
+    void evaluateParallel(const std::vector<Processor*>& worklist);
+
+    /**
+     * Sort the network and update the order and the consumed outports. Only needed when the set
+     * of evaluated processors might have changed, connection changes that keep the order valid
+     * are handled incrementally.
+     */
+    void sort();
+    void updateOrder();
+    /**
+     * Returns true if the processor is part of the sorted set, i.e. leads to a sink.
+     */
+    bool isEvaluated(Processor* processor) const;
+    /**
+     * Returns true if the processor is a sink or is connected to an evaluated processor through an
+     * active connection.
+     */
+    bool leadsToEvaluated(Processor* processor) const;
+    /**
+     * Update Outport::isConsumed for the outports of the processor. A processor with outports that
+     * become consumed is invalidated, since it might have skipped producing their data.
+     */
+    void updateConsumedOutports(Processor* processor);
+
+    void markDirty(Processor* processor);
+    /**
+     * Returns the invalid processors of the sorted set in topological order and removes them from
+     * the dirty set. Invalid processors that are not evaluated, or that are in @p skip, remain in
+     * the dirty set.
+     */
+    std::vector<Processor*> takeWorklist(const std::unordered_set<Processor*>& skip);
+
+    /**
+     * Handles everything up to Processor::process, i.e. doIfNotReady, initializeResources and
+     * inport callbacks. Returns true if the processor should be processed.
+     */
+    bool prepareProcessor(Processor* processor);
+    /**
+     * Calls Processor::process and returns any thrown exception. Safe to call from any thread.
+     */
+    static std::exception_ptr processProcessor(Processor* processor);
+    /**
+     * Reports errors from processing or sets the processor valid, then notifies observers.
+     */
+    void finishProcessor(Processor* processor, std::exception_ptr error);
 
     ProcessorNetwork* processorNetwork_;
     // the sorted list of processors obtained through topological sorting
     std::vector<Processor*> processorsSorted_;
+    // the position of each processor in processorsSorted_
+    std::unordered_map<Processor*, size_t> order_;
     bool needsSorting_;
     bool evaulationQueued_;
+    EvaluationMode evaluationMode_;
     EvaluationErrorHandler exceptionHandler_;
+    // processors that have been invalidated since they were last evaluated
+    std::mutex dirtyMutex_;
+    std::unordered_set<Processor*> dirty_;
 };
 
 }  // namespace inviwo
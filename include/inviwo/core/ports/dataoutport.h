@@ -89,6 +89,9 @@ public:
 
     virtual bool hasData() const override;
 
+    virtual std::shared_ptr<const void> getUntypedData() const override;
+    virtual bool setUntypedData(std::shared_ptr<const void> data) override;
+
 protected:
     std::shared_ptr<const T> data_;
 };
@@ -128,13 +131,18 @@ std::shared_ptr<const T> DataOutport<T>::getData() const {
 
 template <typename T>
 void DataOutport<T>::setData(std::shared_ptr<const T> data) {
+    if (data && data == data_) ++dataVersion_;
     data_ = data;
     isReady_.update();
 }
 
 template <typename T>
 void DataOutport<T>::setData(const T* data) {
-    data_.reset(data);
+    if (data && data == data_.get()) {
+        ++dataVersion_;
+    } else {
+        data_.reset(data);
+    }
     isReady_.update();
 }
 
@@ -157,6 +165,18 @@ bool DataOutport<T>::hasData() const {
     return data_.get() != nullptr;
 }
 
+template <typename T>
+std::shared_ptr<const void> DataOutport<T>::getUntypedData() const {
+    return data_;
+}
+
+template <typename T>
+bool DataOutport<T>::setUntypedData(std::shared_ptr<const void> data) {
+    data_ = std::static_pointer_cast<const T>(data);
+    isReady_.update();
+    return true;
+}
+
 template <typename T>
 void DataOutport<T>::clear() {
     data_.reset();
@@ -230,6 +230,16 @@ public:
      */
     virtual void clear() override;
 
+    /**
+     * Images are rendered into in place and resized on demand, hence they do not support
+     * memoization. Always returns nullptr.
+     */
+    virtual std::shared_ptr<const void> getUntypedData() const override;
+    /**
+     * Not supported, always returns false.
+     */
+    virtual bool setUntypedData(std::shared_ptr<const void> data) override;
+
     bool hasEditableData() const;
     std::shared_ptr<Image> getEditableData() const;
 
@@ -37,6 +37,7 @@
 
 #include <vector>
 #include <functional>
+#include <memory>
 
 namespace inviwo {
 
@@ -52,6 +53,7 @@ class Processor;
 class IVW_CORE_API Outport : public Port {
     friend class Inport;
     friend class Processor;
+    friend class ProcessorNetworkEvaluator;
 
 public:
     virtual ~Outport();
@@ -77,6 +79,19 @@ public:
      */
     virtual void propagateEvent(Event* event, Inport* source);
 
+    /**
+     * Query if the data of the outport is used by any processor that will be evaluated, i.e. if
+     * the port is connected through an active connection to a processor that leads to a sink.
+     * Processors with several outports can use this in process() to skip producing the data of
+     * ports that are not consumed. A skipped port keeps its last data, the processor is
+     * invalidated by the ProcessorNetworkEvaluator when the port gets consumed again.
+     * The state is updated by the ProcessorNetworkEvaluator when connections are added or removed
+     * and when the network is sorted, and is true for ports of processors that are not part of an
+     * evaluated network.
+     * @see Processor::isConnectionActive
+     */
+    bool isConsumed() const;
+
     bool isConnectedTo(const Inport* port) const;
     const std::vector<Inport*>& getConnectedInports() const;
 
@@ -105,6 +120,27 @@ public:
      */
     virtual void clear() = 0;
 
+    /**
+     * Type erased access to the current data of the port. Used to memoize processor results.
+     * Returns nullptr if the port does not support it.
+     * @see ProcessorMemoCache
+     */
+    virtual std::shared_ptr<const void> getUntypedData() const;
+
+    /**
+     * Set data previously returned by getUntypedData of this port. Returns false if the port does
+     * not support it.
+     * @see ProcessorMemoCache
+     */
+    virtual bool setUntypedData(std::shared_ptr<const void> data);
+
+    /**
+     * A counter that is incremented when the same data is set again on the port, i.e. when the
+     * data has been modified in place. Together with the identity of the data it identifies the
+     * content of the port.
+     */
+    size_t getDataVersion() const;
+
 protected:
     /**
      * @note The internal isReady_ lambda function must be set by derived class, e.g.,
@@ -119,9 +155,13 @@ protected:
     StateCoordinator<bool> isReady_;
     InvalidationLevel invalidationLevel_;
     std::vector<Inport*> connectedInports_;
+    size_t dataVersion_;
 
     CallBackList onConnectCallback_;
     CallBackList onDisconnectCallback_;
+
+private:
+    bool consumed_;
 };
 
 }  // namespace inviwo
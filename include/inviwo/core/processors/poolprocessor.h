@@ -39,6 +39,7 @@
 #include <inviwo/core/util/assertion.h>
 #include <inviwo/core/util/rendercontext.h>
 #include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/cancellationtoken.h>
 
 #include <atomic>
 #include <chrono>
@@ -62,6 +63,8 @@ struct StateTemplate;
 
 /**
  * A class to signal if a background calculation should stop or be aborted.
+ * The jobs are dispatched with the same cancellation token, hence nested parallel kernels that
+ * poll ThreadPool::currentToken(), like util::forEachVoxelParallel, will also stop early.
  * Generally used by the background jobs to abort a calculation early:
  * ```{.cpp}
  * auto calc = [mystate](pool::Stop stop) {
@@ -76,12 +79,12 @@ struct StateTemplate;
  */
 class IVW_CORE_API Stop {
 public:
-    operator bool() const noexcept { return stop_.load(); }
+    operator bool() const noexcept { return token_.isCancelled(); }
 
 private:
     friend detail::State;
-    Stop(const std::atomic<bool>& stop) : stop_{stop} {}
-    const std::atomic<bool>& stop_;
+    Stop(CancellationToken token) : token_{std::move(token)} {}
+    CancellationToken token_;
 };
 
 /**
@@ -175,6 +178,8 @@ public:
      * The second functor done is called with the result when the background job is finished. It
      * will be executed on the main thread, and only if the processor is still valid and the job has
      * not been stopped. Hence it is safe to refer to the processor in this functor.
+     * Representations that the job gets from its data are pinned until the job is done, hence raw
+     * representation pointers stay valid within the job, @see RepresentationPins.
      *
      * \code{.cpp}
      * const auto calc = [image = inport_.getData()]
@@ -326,16 +331,16 @@ struct IVW_CORE_API Wrapper {
 
 struct IVW_CORE_API State {
     State(std::weak_ptr<Wrapper> processor, size_t count)
-        : processor(processor), count{count}, stop{false}, progress(count), nJobs{count} {}
+        : processor(processor), count{count}, stop{}, progress(count), nJobs{count} {}
 
     std::weak_ptr<Wrapper> processor;
     std::atomic<size_t> count;
-    std::atomic<bool> stop;
+    CancellationSource stop;
     std::vector<std::atomic<float>> progress;
     std::future<void> progressUpdate;
     size_t nJobs;
 
-    Stop getStop() { return Stop(stop); }
+    Stop getStop() { return Stop(stop.getToken()); }
 
     void setProgress(size_t id, float progress);
 
@@ -418,7 +423,7 @@ inline void PoolProcessor::callDone(
 
                 p.notifyObserversFinishBackgroundWork(&p, state->nJobs);
 
-                if (state->stop) return;
+                if (state->stop.isCancelled()) return;
 
                 if (isLast || p.keepOldJobs()) {
                     done(p, state);
@@ -451,7 +456,7 @@ void PoolProcessor::dispatchMany(std::vector<Job> jobs, Done&& done) {
         auto task = makeTask<Result>(std::move(job), state->getStop(), state->getProgress(i++));
         state->futures.push_back(task->get_future());
         sub.tasks.emplace_back([state, task, app]() {
-            if (!state->stop) {
+            if (!state->stop.isCancelled()) {
                 // This code will run in a background thread, make sure the local context is active
                 RenderContext::getPtr()->activateLocalRenderContext();
                 (*task)();
@@ -500,7 +505,7 @@ void PoolProcessor::dispatchOne(Job&& job, Done&& done) {
 
     Submission sub{state,
                    {[state, task, app]() {
-                       if (!state->stop) {
+                       if (!state->stop.isCancelled()) {
                            RenderContext::getPtr()->activateLocalRenderContext();
                            (*task)();
                        }
@@ -51,6 +51,7 @@ class ProcessorWidget;
 class ProcessorNetwork;
 class NetworkVisitor;
 class InviwoApplication;
+class ProcessorMemoCache;
 
 /**
  * \defgroup processors Processors
@@ -304,6 +305,22 @@ public:
      */
     virtual void doIfNotReady() {}
 
+    /**
+     * Enable memoization of the results of the processor, keeping at most \p capacity results.
+     * Before calling process the ProcessorNetworkEvaluator will restore the outports from the
+     * cache if the inport data and the property state have been seen before. A capacity of zero
+     * disables memoization. Only enable this for processors where the outport data is a pure
+     * function of the inport data and the properties.
+     * @see ProcessorMemoCache
+     */
+    void setMemoizationCapacity(size_t capacity);
+
+    /**
+     * Returns the memoization cache, or nullptr if memoization has not been enabled.
+     * @see setMemoizationCapacity
+     */
+    ProcessorMemoCache* getMemoCache() const;
+
     /**
      * Called by the network after Processor::process has been called.
      * This will set the following to valid
@@ -459,6 +476,7 @@ private:
     std::unordered_map<Port*, std::string> portGroups_;
 
     ProcessorNetwork* network_;
+    std::unique_ptr<ProcessorMemoCache> memoCache_;
 
     NameDispatcher identifierDispatcher_;
     NameDispatcher displayNameDispatcher_;
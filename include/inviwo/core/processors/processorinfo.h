@@ -38,6 +38,16 @@
 
 namespace inviwo {
 
+/**
+ * Describes on which thread Processor::process may be called when the network is evaluated using
+ * EvaluationMode::Parallel.
+ * @see ProcessorNetworkEvaluator::setEvaluationMode
+ */
+enum class ProcessingThread {
+    Front,  ///< Always process on the front (main) thread, needed for GL, CL, and Python.
+    Any     ///< Process on any thread, i.e. concurrently with other processors in the thread pool
+};
+
 /**
  * \class ProcessorInfo
  * \brief Static information about a processor. Needed mostly for the processor list and factories
@@ -48,6 +58,9 @@ public:
                   CodeState aCodeState, Tags someTags);
     ProcessorInfo(std::string aClassIdentifier, std::string aDisplayName, std::string aCategory,
                   CodeState aCodeState, Tags someTags, Document help, bool visible = true);
+    ProcessorInfo(std::string aClassIdentifier, std::string aDisplayName, std::string aCategory,
+                  CodeState aCodeState, Tags someTags, Document help, bool visible,
+                  ProcessingThread aProcessingThread);
 
     /// Identifier must be unique for all processors, example org.inviwo.yourprocessor
     std::string classIdentifier;
@@ -57,6 +70,13 @@ public:
     Tags tags;      ///< Searchable tags, platform tags are shown in ProcessorTreeWidget
     Document help;  ///< Help text for the processor
     bool visible;   ///< Show in processor list (ProcessorTreeWidget), enabling drag&drop
+    /**
+     * Where the processor can be processed during parallel evaluation. Defaults to
+     * ProcessingThread::Front. Only processors that do not modify properties, or touch widgets or
+     * GL in Processor::process should pass ProcessingThread::Any, like the CPU volume operations
+     * in the base module.
+     */
+    ProcessingThread processingThread;
 
     IVW_CORE_API friend bool operator==(const ProcessorInfo& a, const ProcessorInfo& b);
     IVW_CORE_API friend bool operator!=(const ProcessorInfo& a, const ProcessorInfo& b);
@@ -0,0 +1,118 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+class Processor;
+
+/**
+ * \ingroup processors
+ * \brief A bounded least recently used cache of the outport data of a processor.
+ *
+ * The results are keyed on the identity and version of the data of all connected outports, see
+ * Outport::getUntypedData and Outport::getDataVersion, together with the serialized state of all
+ * the properties of the processor. The data of the inports is kept alive by the cache to make sure
+ * that the identity of the data can not be reused by other data.
+ *
+ * The cache is used by the ProcessorNetworkEvaluator, before calling Processor::process the
+ * evaluator will try to restore the outports from the cache and skip the processing on a hit.
+ * After processing the new results are stored. PoolProcessors store their results when calling
+ * PoolProcessor::newResults. Only processors where the result is a pure function of the inport
+ * data and the properties should enable memoization, see Processor::setMemoizationCapacity.
+ *
+ * The hits and misses are reported to the Profiler as the counters "ProcessorMemoCache::hits"
+ * and "ProcessorMemoCache::misses".
+ */
+class IVW_CORE_API ProcessorMemoCache {
+public:
+    explicit ProcessorMemoCache(size_t capacity = 4);
+
+    /**
+     * Look up the current state of the processor and on a hit set the data of all outports.
+     * The key of the current state is remembered for a subsequent call to store.
+     * @return true on a hit, false otherwise
+     */
+    bool restore(Processor& processor);
+
+    /**
+     * Store the current data of the outports of the processor using the key of the last call to
+     * restore. Nothing is stored if any outport lacks data or does not support memoization.
+     */
+    void store(Processor& processor);
+
+    void clear();
+    size_t size() const;
+
+    size_t getCapacity() const;
+    void setCapacity(size_t capacity);
+
+    size_t getHits() const;
+    size_t getMisses() const;
+    /**
+     * The fraction of calls to restore that resulted in a hit.
+     */
+    double getHitRate() const;
+
+private:
+    struct Key {
+        std::vector<std::pair<std::shared_ptr<const void>, size_t>> inputs;
+        std::string state;
+        size_t hash = 0;
+
+        bool operator==(const Key& that) const {
+            return hash == that.hash && inputs == that.inputs && state == that.state;
+        }
+    };
+    struct Entry {
+        Key key;
+        std::vector<std::shared_ptr<const void>> outputs;
+    };
+
+    static std::optional<Key> makeKey(Processor& processor);
+
+    size_t capacity_;
+    std::list<Entry> entries_;
+    std::optional<Key> pending_;
+    size_t hits_;
+    size_t misses_;
+};
+
+}  // namespace inviwo
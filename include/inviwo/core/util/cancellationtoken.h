@@ -0,0 +1,94 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <atomic>
+#include <memory>
+
+namespace inviwo {
+
+class CancellationSource;
+
+/**
+ * A token that long running tasks can poll to check whether their result is still needed.
+ * Tokens are created by a CancellationSource and all copies share the state of their source.
+ * A default constructed token is never cancelled.
+ * ```{.cpp}
+ * CancellationSource source;
+ * pool.enqueue(TaskPriority::Background, source.getToken(), []() {
+ *     for (...) {
+ *         if (ThreadPool::currentToken().isCancelled()) return;
+ *         // do work
+ *     }
+ * });
+ * source.cancel();
+ * ```
+ * @see ThreadPool::currentToken
+ */
+class IVW_CORE_API CancellationToken {
+public:
+    CancellationToken() = default;
+
+    bool isCancelled() const noexcept {
+        return state_ && state_->load(std::memory_order_relaxed);
+    }
+    /**
+     * Returns false for default constructed tokens that can never be cancelled.
+     */
+    bool canBeCancelled() const noexcept { return state_ != nullptr; }
+
+private:
+    friend CancellationSource;
+    explicit CancellationToken(std::shared_ptr<const std::atomic<bool>> state)
+        : state_{std::move(state)} {}
+
+    std::shared_ptr<const std::atomic<bool>> state_;
+};
+
+/**
+ * Owner side of a CancellationToken. Calling cancel will cancel all tokens obtained from the
+ * source. Copies of a source share the same state.
+ */
+class IVW_CORE_API CancellationSource {
+public:
+    CancellationSource() : state_{std::make_shared<std::atomic<bool>>(false)} {}
+
+    void cancel() noexcept { state_->store(true, std::memory_order_relaxed); }
+    bool isCancelled() const noexcept { return state_->load(std::memory_order_relaxed); }
+
+    CancellationToken getToken() const { return CancellationToken{state_}; }
+
+private:
+    std::shared_ptr<std::atomic<bool>> state_;
+};
+
+}  // namespace inviwo
@@ -33,6 +33,7 @@
 #include <inviwo/core/util/chronoutils.h>
 #include <inviwo/core/util/demangle.h>
 #include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/profiler.h>
 
 #include <sstream>
 #include <string>
@@ -200,74 +201,59 @@ using ScopedClockCPU = ScopedClock<Clock>;
 
 /**
  * \def IVW_CPU_PROFILING(message)
- * creates a scoped CPU clock with the given message.
+ * Times the current scope into a Profiler probe named after the enclosing class and function.
+ * Does nothing unless IVW_PROFILING is defined. The message is not formatted or logged, the
+ * aggregated timings can be inspected with Profiler::dump.
  *
- * @param message  log message
+ * @param message  ignored, kept to document the timed section
  */
 
 /**
  * \def IVW_CPU_PROFILING_CUSTOM(src, message)
- * creates a scoped CPU clock with the given source and message.
- * Does nothing unless IVW_PROFILING is defined.
+ * Times the current scope into a Profiler probe named after \p src and the enclosing function.
+ * \p src is evaluated on every call, so a function can record into different probes, but only
+ * while the Profiler is enabled. Does nothing unless IVW_PROFILING is defined.
  *
- * @param src      source of the log message
- * @param message  log message
+ * @param src      source of the probe name
+ * @param message  ignored, kept to document the timed section
  */
 
 /**
  * \def IVW_CPU_PROFILING_IF(time, message)
- * creates a scoped CPU clock with the given message and minimum duration.
+ * Same as IVW_CPU_PROFILING(message), all durations are recorded into the probe and the
+ * percentiles are available from Profiler::collect.
  * Does nothing unless IVW_PROFILING is defined.
  *
- * @param time     either a std::chrono::duration or a double value (milliseconds)
- * @param message  log message
+ * @param time     ignored
+ * @param message  ignored, kept to document the timed section
  */
 
 /**
  * \def IVW_CPU_PROFILING_IF_CUSTOM(time, src, message)
- * creates a scoped CPU clock with the given source, message, and minimum duration.
+ * Same as IVW_CPU_PROFILING_CUSTOM(src, message).
  * Does nothing unless IVW_PROFILING is defined.
  *
- * @param time     either a std::chrono::duration or a double value (milliseconds)
- * @param src      source of the log message
- * @param message  log message
+ * @param time     ignored
+ * @param src      source of the probe name
+ * @param message  ignored, kept to document the timed section
  */
 
 #if IVW_PROFILING
-#define IVW_CPU_PROFILING(message)                                                  \
-    std::ostringstream IVW_ADDLINE(__stream);                                       \
-    IVW_ADDLINE(__stream) << message;                                               \
-    ScopedClockCPU IVW_ADDLINE(__clock)(util::parseTypeIdName(typeid(this).name()), \
-                                        IVW_ADDLINE(__stream).str());
+#define IVW_CPU_PROFILING_CUSTOM(src, message)                            \
+    const ProfilerTimer IVW_ADDLINE(__timer) {                            \
+        Profiler::isEnabled()                                             \
+            ? Profiler::registerProbe(std::string{src} + "::" + __func__, \
+                                      Profiler::Kind::Timer)              \
+            : Profiler::noProbe                                           \
+    }
+#define IVW_CPU_PROFILING(message) \
+    IVW_CPU_PROFILING_CUSTOM(util::parseTypeIdName(typeid(this).name()), message)
+#define IVW_CPU_PROFILING_IF(time, message) IVW_CPU_PROFILING(message)
+#define IVW_CPU_PROFILING_IF_CUSTOM(time, src, message) IVW_CPU_PROFILING_CUSTOM(src, message)
 #else
 #define IVW_CPU_PROFILING(message)
-#endif
-
-#if IVW_PROFILING
-#define IVW_CPU_PROFILING_CUSTOM(src, message) \
-    std::ostringstream IVW_ADDLINE(__stream);  \
-    IVW_ADDLINE(__stream) << message;          \
-    ScopedClockCPU IVW_ADDLINE(__clock)(src, IVW_ADDLINE(__stream).str());
-#else
 #define IVW_CPU_PROFILING_CUSTOM(src, message)
-#endif
-
-#if IVW_PROFILING
-#define IVW_CPU_PROFILING_IF(time, message)                                         \
-    std::ostringstream IVW_ADDLINE(__stream);                                       \
-    IVW_ADDLINE(__stream) << message;                                               \
-    ScopedClockCPU IVW_ADDLINE(__clock)(util::parseTypeIdName(typeid(this).name()), \
-                                        IVW_ADDLINE(__stream).str(), time);
-#else
 #define IVW_CPU_PROFILING_IF(time, message)
-#endif
-
-#if IVW_PROFILING
-#define IVW_CPU_PROFILING_IF_CUSTOM(time, src, message) \
-    std::ostringstream IVW_ADDLINE(__stream);           \
-    IVW_ADDLINE(__stream) << message;                   \
-    ScopedClockCPU IVW_ADDLINE(__clock)(src, IVW_ADDLINE(__stream).str(), time);
-#else
 #define IVW_CPU_PROFILING_IF_CUSTOM(time, src, message)
 #endif
 
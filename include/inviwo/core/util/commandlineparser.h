@@ -100,6 +100,15 @@ public:
     bool getLogToFile() const;
     bool getLogToConsole() const;
     bool getDisableResourceManager() const;
+    /**
+     * Returns true if a trace should be recorded, see TraceRecorder.
+     */
+    bool getTrace() const;
+    const std::string getTraceFileName() const;
+    /**
+     * Returns true if the Profiler should be enabled, the aggregates are logged on exit.
+     */
+    bool getProfile() const;
 
     int getARGC() const;
     char** getARGV() const;
@@ -126,6 +135,8 @@ private:
     TCLAP::SwitchArg helpQuiet_;
     TCLAP::SwitchArg versionQuiet_;
     TCLAP::SwitchArg disableResourceManager_;
+    TCLAP::ValueArg<std::string> traceFile_;
+    TCLAP::SwitchArg profile_;
 
     std::vector<std::tuple<int, TCLAP::Arg*, std::function<void()>>> callbacks_;
 };
@@ -34,6 +34,7 @@
 #include <inviwo/core/datastructures/image/image.h>
 #include <inviwo/core/datastructures/image/layer.h>
 #include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/util/threadutil.h>
 
 #include <memory>
 #include <vector>
@@ -72,25 +73,24 @@ void forEachPixelParallel(const size2_t dims, C callback, size_t jobs = 0) {
         }
     }
 
-    std::vector<std::future<void>> futures;
-    for (size_t job = 0; job < jobs; ++job) {
-        size2_t start = size2_t(0, job * dims.y / jobs);
-        size2_t stop = size2_t(dims.x, std::min(dims.y, (job + 1) * dims.y / jobs));
-
-        futures.push_back(dispatchPool([&callback, start, stop]() {
-            size2_t pos{0};
-
-            for (pos.y = start.y; pos.y < stop.y; ++pos.y) {
-                for (pos.x = start.x; pos.x < stop.x; ++pos.x) {
-                    callback(pos);
-                }
+    auto& pool = getThreadPool();
+    // Split along y, all bands are submitted at once and share a single latch
+    auto latch = pool.enqueueRange(dims.y, jobs, [&callback, dims](size_t yBegin, size_t yEnd) {
+        // Stop early if the task we are part of has been cancelled
+        const auto& token = ThreadPool::currentToken();
+        size2_t pos{0};
+
+        for (pos.y = yBegin; pos.y < yEnd; ++pos.y) {
+            if (token.isCancelled()) return;
+            for (pos.x = 0; pos.x < dims.x; ++pos.x) {
+                callback(pos);
             }
-        }));
-    }
+        }
+    });
 
-    for (const auto& e : futures) {
-        e.wait();
-    }
+    // Execute other queued tasks while waiting if we are called from within the pool
+    pool.wait(*latch);
+    latch->get();
 }
 
 template <typename C>
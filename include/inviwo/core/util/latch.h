@@ -0,0 +1,79 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+
+namespace inviwo {
+
+/**
+ * A single use count down latch shared by a group of tasks, see ThreadPool::enqueueRange.
+ * Each task calls countDown when it is done, and anyone waiting is released when the count
+ * reaches zero. The first exception reported by a task is kept and can be rethrown by the waiter.
+ * Use ThreadPool::wait(const Latch&) to execute other tasks while waiting from within the pool.
+ */
+class IVW_CORE_API Latch {
+public:
+    explicit Latch(size_t count);
+    Latch(const Latch&) = delete;
+    Latch& operator=(const Latch&) = delete;
+
+    void countDown(size_t n = 1);
+    /**
+     * Store the exception of a failed task, only the first exception is kept.
+     * Should be called before countDown.
+     */
+    void setException(std::exception_ptr exception);
+
+    bool isReady() const;
+    void wait() const;
+    /**
+     * Wait for at most \p duration, returns true if the latch is ready.
+     */
+    bool waitFor(std::chrono::milliseconds duration) const;
+
+    /**
+     * Wait for the latch and rethrow the first exception thrown by any of the tasks.
+     */
+    void get() const;
+
+private:
+    size_t count_;
+    std::exception_ptr exception_;
+    mutable std::mutex mutex_;
+    mutable std::condition_variable condition_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,77 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <inviwo/core/network/processornetworkevaluationobserver.h>
+#include <inviwo/core/network/processornetworkobserver.h>
+#include <inviwo/core/processors/processorobserver.h>
+#include <inviwo/core/util/tracerecorder.h>
+
+namespace inviwo {
+
+class ProcessorNetwork;
+class ProcessorNetworkEvaluator;
+
+/**
+ * \brief Records the network evaluation into the TraceRecorder
+ *
+ * Records a span for each evaluation of the network, and an asynchronous span from when a
+ * processor is about to process until it has finished. Together with the thread pool tasks and
+ * representation conversions that are recorded by the TraceRecorder this gives a timeline of the
+ * full evaluation across all threads. Nothing is recorded unless the TraceRecorder is enabled.
+ * @see TraceRecorder
+ */
+class IVW_CORE_API NetworkTraceObserver : public ProcessorNetworkObserver,
+                                          public ProcessorNetworkEvaluationObserver,
+                                          public ProcessorObserver {
+public:
+    NetworkTraceObserver(ProcessorNetwork* network, ProcessorNetworkEvaluator* evaluator);
+    NetworkTraceObserver(const NetworkTraceObserver&) = delete;
+    NetworkTraceObserver& operator=(const NetworkTraceObserver&) = delete;
+    virtual ~NetworkTraceObserver() = default;
+
+    // ProcessorNetworkObserver
+    virtual void onProcessorNetworkDidAddProcessor(Processor* p) override;
+
+    // ProcessorNetworkEvaluationObserver
+    virtual void onProcessorNetworkEvaluationBegin() override;
+    virtual void onProcessorNetworkEvaluationEnd() override;
+
+    // ProcessorObserver
+    virtual void onProcessorAboutToProcess(Processor* p) override;
+    virtual void onProcessorFinishedProcess(Processor* p) override;
+
+private:
+    TraceRecorder::Clock::time_point evaluationStart_;
+};
+
+}  // namespace inviwo
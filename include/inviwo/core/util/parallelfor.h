@@ -0,0 +1,322 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace util {
+
+/**
+ * Settings for util::parallelFor and util::parallelReduce
+ */
+struct ParallelSettings {
+    /**
+     * The size of the bricks the range is tiled into, the grain size. Components that are zero
+     * are chosen automatically, see defaultBrickSize.
+     */
+    size3_t brickSize{0};
+    /**
+     * The number of tasks to use, each task processes a contiguous sequence of bricks. Zero means
+     * 4 times the pool size.
+     */
+    size_t jobs = 0;
+    TaskPriority priority = TaskPriority::Normal;
+};
+
+/**
+ * Brick size used when the ParallelSettings::brickSize is zero. Bricks span whole rows along x up
+ * to 256 voxels and hold about 32k voxels, which keeps the working set of a task in the cache
+ * while reading memory in x order.
+ */
+inline size3_t defaultBrickSize(const size3_t& dims, const size3_t& brickSize = size3_t{0}) {
+    size3_t brick{brickSize};
+    if (brick.x == 0) brick.x = std::min<size_t>(dims.x, 256);
+    brick.x = std::max<size_t>(brick.x, 1);
+    if (brick.y == 0) brick.y = std::min<size_t>(dims.y, std::max<size_t>(4096 / brick.x, 1));
+    brick.y = std::max<size_t>(brick.y, 1);
+    if (brick.z == 0) {
+        brick.z = std::min<size_t>(dims.z, std::max<size_t>(32768 / (brick.x * brick.y), 1));
+    }
+    brick.z = std::max<size_t>(brick.z, 1);
+    return brick;
+}
+
+namespace detail {
+
+struct Bricks {
+    Bricks(const size3_t& dims, const size3_t& brickSize)
+        : dims{dims}, size{defaultBrickSize(dims, brickSize)}, count{(dims + size - size3_t{1}) /
+                                                                     size} {}
+
+    size_t total() const { return count.x * count.y * count.z; }
+
+    /**
+     * Calls func(begin, end) for the bricks [first, last) in x, y, z order. Returns false if it
+     * stopped early because the current task was cancelled.
+     */
+    template <typename F>
+    bool forEach(size_t first, size_t last, F& func) const {
+        const auto& token = ThreadPool::currentToken();
+        for (size_t i = first; i < last; ++i) {
+            // Stop early if the task we are part of has been cancelled
+            if (token.isCancelled()) return false;
+            const size3_t brick{i % count.x, (i / count.x) % count.y, i / (count.x * count.y)};
+            const size3_t begin = brick * size;
+            func(begin, glm::min(begin + size, dims));
+        }
+        return true;
+    }
+
+    size3_t dims;
+    size3_t size;
+    size3_t count;
+};
+
+template <typename F>
+void forEachInBrick(const size3_t& begin, const size3_t& end, F& func) {
+    size3_t pos;
+    for (pos.z = begin.z; pos.z < end.z; ++pos.z) {
+        for (pos.y = begin.y; pos.y < end.y; ++pos.y) {
+            for (pos.x = begin.x; pos.x < end.x; ++pos.x) {
+                func(pos);
+            }
+        }
+    }
+}
+
+inline size_t parallelJobs(ThreadPool* pool, const ParallelSettings& settings, size_t bricks) {
+    if (!pool || bricks < 2) return 1;
+    const auto jobs = settings.jobs != 0 ? settings.jobs : 4 * pool->getSize();
+    return std::min(std::max<size_t>(jobs, 1), bricks);
+}
+
+inline ThreadPool* defaultPool() { return util::getPoolSize() != 0 ? &getThreadPool() : nullptr; }
+
+}  // namespace detail
+
+/**
+ * Tile the range [0, dims) into bricks and call `func(begin, end)` for each brick in parallel,
+ * where [begin, end) is the extent of the brick. Blocks until all bricks are processed, when
+ * called from a task in \p pool other tasks are executed while waiting. Exceptions thrown by
+ * \p func are rethrown. Tasks stop early if the current task has been cancelled, see
+ * ThreadPool::currentToken.
+ * If \p pool is null or has no workers all bricks are processed serially in the calling thread.
+ * @see parallelFor, parallelReduce
+ */
+template <typename F>
+void parallelForBricks(ThreadPool* pool, const size3_t& dims, F&& func,
+                       const ParallelSettings& settings = {}) {
+    static_assert(std::is_invocable_v<F&, const size3_t&, const size3_t&>,
+                  "func should be callable with (const size3_t& begin, const size3_t& end)");
+    if (dims.x == 0 || dims.y == 0 || dims.z == 0) return;
+
+    const detail::Bricks bricks{dims, settings.brickSize};
+    const auto jobs = detail::parallelJobs(pool, settings, bricks.total());
+    if (jobs == 1) {
+        bricks.forEach(0, bricks.total(), func);
+        return;
+    }
+
+    auto latch = pool->enqueueRange(
+        bricks.total(), jobs,
+        [&func, &bricks](size_t first, size_t last) { bricks.forEach(first, last, func); },
+        settings.priority);
+    pool->wait(*latch);
+    latch->get();
+}
+
+/**
+ * Uses the application thread pool
+ * @see parallelForBricks(ThreadPool*, const size3_t&, F&&, const ParallelSettings&)
+ */
+template <typename F>
+void parallelForBricks(const size3_t& dims, F&& func, const ParallelSettings& settings = {}) {
+    parallelForBricks(detail::defaultPool(), dims, std::forward<F>(func), settings);
+}
+
+/**
+ * Call `func(pos)` for each position in [0, dims) in parallel. The range is tiled into cache
+ * friendly bricks, that are distributed over the tasks.
+ * @see parallelForBricks
+ */
+template <typename F>
+void parallelFor(ThreadPool* pool, const size3_t& dims, F&& func,
+                 const ParallelSettings& settings = {}) {
+    static_assert(std::is_invocable_v<F&, const size3_t&>,
+                  "func should be callable with (const size3_t& pos)");
+    parallelForBricks(
+        pool, dims,
+        [&func](const size3_t& begin, const size3_t& end) {
+            detail::forEachInBrick(begin, end, func);
+        },
+        settings);
+}
+
+/**
+ * Uses the application thread pool
+ * @see parallelFor(ThreadPool*, const size3_t&, F&&, const ParallelSettings&)
+ */
+template <typename F>
+void parallelFor(const size3_t& dims, F&& func, const ParallelSettings& settings = {}) {
+    parallelFor(detail::defaultPool(), dims, std::forward<F>(func), settings);
+}
+
+/**
+ * Reduce over all positions in [0, dims) in parallel. Each task gets its own state, initialized
+ * to \p identity, and calls `accumulate(state, pos)` for every position of its bricks. The states
+ * of the tasks are then combined with `combine(a, b)` in the calling thread, in a deterministic
+ * order. Hence, no synchronization is needed in \p accumulate.
+ * ```{.cpp}
+ * const std::optional<float> max = util::parallelReduce(
+ *     dims, std::numeric_limits<float>::lowest(),
+ *     [&](float& state, const size3_t& pos) { state = std::max(state, data[im(pos)]); },
+ *     [](float a, float b) { return std::max(a, b); });
+ * ```
+ * If the current task is cancelled before all positions are processed, std::nullopt is returned
+ * instead of a partial result.
+ * @see parallelReduceBricks, parallelFor
+ */
+template <typename T, typename Accumulate, typename Combine>
+std::optional<T> parallelReduce(ThreadPool* pool, const size3_t& dims, T identity,
+                                Accumulate&& accumulate, Combine&& combine,
+                                const ParallelSettings& settings = {});
+
+/**
+ * Like parallelReduce but calls `accumulate(state, begin, end)` once for each brick.
+ * @see parallelReduce
+ */
+template <typename T, typename Accumulate, typename Combine>
+std::optional<T> parallelReduceBricks(ThreadPool* pool, const size3_t& dims, T identity,
+                                      Accumulate&& accumulate, Combine&& combine,
+                                      const ParallelSettings& settings = {}) {
+    static_assert(std::is_invocable_v<Accumulate&, T&, const size3_t&, const size3_t&>,
+                  "accumulate should be callable with (T& state, const size3_t& begin, const "
+                  "size3_t& end)");
+    static_assert(std::is_invocable_r_v<T, Combine&, T, T>,
+                  "combine should be callable with (T a, T b) and return a T");
+    if (dims.x == 0 || dims.y == 0 || dims.z == 0) return identity;
+
+    const detail::Bricks bricks{dims, settings.brickSize};
+    const auto jobs = detail::parallelJobs(pool, settings, bricks.total());
+
+    // One state per task, each task only touches its own element. The states are wrapped in
+    // optionals to keep them separate objects even for std::vector<bool>.
+    std::vector<std::optional<T>> states(jobs);
+    const auto reduceJob = [&](size_t job) {
+        auto state = identity;
+        auto func = [&state, &accumulate](const size3_t& begin, const size3_t& end) {
+            accumulate(state, begin, end);
+        };
+        if (bricks.forEach((bricks.total() * job) / jobs, (bricks.total() * (job + 1)) / jobs,
+                           func)) {
+            states[job] = std::move(state);
+        }
+    };
+
+    if (jobs == 1) {
+        reduceJob(0);
+    } else {
+        auto latch = pool->enqueueRange(
+            jobs, jobs,
+            [&reduceJob](size_t first, size_t last) {
+                for (auto job = first; job < last; ++job) reduceJob(job);
+            },
+            settings.priority);
+        pool->wait(*latch);
+        latch->get();
+    }
+
+    // Tasks that were cancelled left their state empty, don't return a partial result
+    if (!std::all_of(states.begin(), states.end(), [](const auto& state) { return state; })) {
+        return std::nullopt;
+    }
+
+    auto result = std::move(*states.front());
+    for (auto it = std::next(states.begin()); it != states.end(); ++it) {
+        result = combine(std::move(result), std::move(**it));
+    }
+    return result;
+}
+
+/**
+ * Uses the application thread pool
+ * @see parallelReduceBricks(ThreadPool*, const size3_t&, T, Accumulate&&, Combine&&,
+ *      const ParallelSettings&)
+ */
+template <typename T, typename Accumulate, typename Combine>
+std::optional<T> parallelReduceBricks(const size3_t& dims, T identity, Accumulate&& accumulate,
+                                      Combine&& combine, const ParallelSettings& settings = {}) {
+    return parallelReduceBricks(detail::defaultPool(), dims, std::move(identity),
+                                std::forward<Accumulate>(accumulate),
+                                std::forward<Combine>(combine), settings);
+}
+
+template <typename T, typename Accumulate, typename Combine>
+std::optional<T> parallelReduce(ThreadPool* pool, const size3_t& dims, T identity,
+                                Accumulate&& accumulate, Combine&& combine,
+                                const ParallelSettings& settings) {
+    static_assert(std::is_invocable_v<Accumulate&, T&, const size3_t&>,
+                  "accumulate should be callable with (T& state, const size3_t& pos)");
+    return parallelReduceBricks(
+        pool, dims, std::move(identity),
+        [&accumulate](T& state, const size3_t& begin, const size3_t& end) {
+            auto func = [&](const size3_t& pos) { accumulate(state, pos); };
+            detail::forEachInBrick(begin, end, func);
+        },
+        std::forward<Combine>(combine), settings);
+}
+
+/**
+ * Uses the application thread pool
+ * @see parallelReduce(ThreadPool*, const size3_t&, T, Accumulate&&, Combine&&,
+ *      const ParallelSettings&)
+ */
+template <typename T, typename Accumulate, typename Combine>
+std::optional<T> parallelReduce(const size3_t& dims, T identity, Accumulate&& accumulate,
+                                Combine&& combine, const ParallelSettings& settings = {}) {
+    return parallelReduce(detail::defaultPool(), dims, std::move(identity),
+                          std::forward<Accumulate>(accumulate), std::forward<Combine>(combine),
+                          settings);
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -0,0 +1,201 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * \brief A low overhead profiler for timers and counters on hot paths
+ *
+ * Measurements are recorded against named probes. Each thread writes its samples into its own
+ * lock free ring buffer, and no strings are formatted and no locks are taken while recording.
+ * The samples are aggregated into a histogram per probe when collect() is called, or by the
+ * recording thread itself when its buffer is full and the aggregation is not busy. If neither is
+ * possible the sample is dropped and counted, see getDropped().
+ *
+ * Probes are usually declared as static locals using the IVW_PROFILE_SCOPE and IVW_PROFILE_COUNT
+ * macros, which means the name is only registered once:
+ * ```{.cpp}
+ * void MyProcessor::process() {
+ *     IVW_PROFILE_SCOPE("MyProcessor::process");
+ *     ...
+ *     IVW_PROFILE_COUNT("MyProcessor::voxels", voxelCount);
+ * }
+ * // later
+ * Profiler::dump(std::cout);
+ * ```
+ * Recording is disabled by default, then a probe only costs a relaxed atomic load.
+ */
+class IVW_CORE_API Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+    enum class Kind { Timer, Counter };
+    /// A probe id that is never registered, samples for it are not recorded
+    static constexpr std::uint32_t noProbe = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * Aggregated values of a probe. For timers all values are in nanoseconds.
+     * The percentiles are approximate, with a relative error of at most 1/16.
+     */
+    struct Stats {
+        std::string name;
+        Kind kind;
+        size_t count;
+        std::int64_t total;
+        std::int64_t min;
+        std::int64_t max;
+        double mean;
+        std::int64_t p50;
+        std::int64_t p95;
+        std::int64_t p99;
+    };
+
+    static bool isEnabled() noexcept { return enabled_.load(std::memory_order_relaxed); }
+    static void setEnabled(bool enabled);
+
+    /**
+     * Register a probe and return its id. Registering the same name and kind again returns the
+     * same id.
+     */
+    static std::uint32_t registerProbe(std::string_view name, Kind kind);
+
+    /**
+     * Record \p value for \p probe on the calling thread. Does nothing if not enabled.
+     */
+    static void record(std::uint32_t probe, std::int64_t value) noexcept;
+
+    /**
+     * Aggregate the samples of all threads and return the statistics of all probes with at
+     * least one sample.
+     */
+    static std::vector<Stats> collect();
+
+    /**
+     * Write a table of the statistics of all probes to \p os.
+     * @see collect
+     */
+    static void dump(std::ostream& os);
+
+    /**
+     * Discard all samples and aggregated values. The probes stay registered.
+     */
+    static void reset();
+
+    /**
+     * The number of samples dropped since the last reset because a ring buffer was full
+     */
+    static size_t getDropped();
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+/**
+ * A named probe for the Profiler, usually declared as a static local
+ * @see IVW_PROFILE_SCOPE, IVW_PROFILE_COUNT
+ */
+class ProfilerProbe {
+public:
+    explicit ProfilerProbe(std::string_view name, Profiler::Kind kind = Profiler::Kind::Timer)
+        : id_{Profiler::registerProbe(name, kind)} {}
+
+    std::uint32_t id() const { return id_; }
+    void record(std::int64_t value) const noexcept { Profiler::record(id_, value); }
+
+private:
+    std::uint32_t id_;
+};
+
+/**
+ * Records the time from construction to destruction into a probe. Nothing is recorded for
+ * Profiler::noProbe.
+ */
+class ProfilerTimer {
+public:
+    explicit ProfilerTimer(const ProfilerProbe& probe) : ProfilerTimer{probe.id()} {}
+    explicit ProfilerTimer(std::uint32_t probe)
+        : probe_{probe}
+        , start_{probe != Profiler::noProbe && Profiler::isEnabled()
+                     ? Profiler::Clock::now()
+                     : Profiler::Clock::time_point{}} {}
+    ProfilerTimer(const ProfilerTimer&) = delete;
+    ProfilerTimer& operator=(const ProfilerTimer&) = delete;
+    ~ProfilerTimer() {
+        if (start_ != Profiler::Clock::time_point{}) {
+            Profiler::record(probe_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         Profiler::Clock::now() - start_)
+                                         .count());
+        }
+    }
+
+private:
+    std::uint32_t probe_;
+    Profiler::Clock::time_point start_;
+};
+
+}  // namespace inviwo
+
+#define IVW_PROFILE_CONCAT_IMPL(x, y) x##y
+#define IVW_PROFILE_CONCAT(x, y) IVW_PROFILE_CONCAT_IMPL(x, y)
+
+/**
+ * \def IVW_PROFILE_SCOPE(name)
+ * Time the current scope into a static probe called \p name.
+ * @see Profiler
+ */
+#define IVW_PROFILE_SCOPE(name)                                                         \
+    static const ::inviwo::ProfilerProbe IVW_PROFILE_CONCAT(ivwProfilerProbe, __LINE__){ \
+        name, ::inviwo::Profiler::Kind::Timer};                                         \
+    const ::inviwo::ProfilerTimer IVW_PROFILE_CONCAT(ivwProfilerTimer, __LINE__) {      \
+        IVW_PROFILE_CONCAT(ivwProfilerProbe, __LINE__)                                  \
+    }
+
+/**
+ * \def IVW_PROFILE_COUNT(name, value)
+ * Add \p value to a static counter probe called \p name.
+ * @see Profiler
+ */
+#define IVW_PROFILE_COUNT(name, value)                                                  \
+    do {                                                                                \
+        static const ::inviwo::ProfilerProbe ivwProfilerProbe{                          \
+            name, ::inviwo::Profiler::Kind::Counter};                                   \
+        ivwProfilerProbe.record(value);                                                 \
+    } while (false)
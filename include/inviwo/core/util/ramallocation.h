@@ -0,0 +1,234 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+namespace inviwo {
+
+/**
+ * Describes how the data of a RAM representation is allocated and initialized.
+ * @see VolumeRAMPrecision, LayerRAMPrecision, createVolumeRAM, createLayerRAM
+ */
+struct RAMAllocation {
+    enum class Init {
+        /// All elements are zero. Large allocations are zeroed in parallel on the thread pool,
+        /// such that the pages are first touched by the threads that will process them.
+        Zero,
+        /// The memory is left uninitialized. Use when the data is overwritten right away, for
+        /// example by a reader or an algorithm that writes every element.
+        Uninitialized
+    };
+
+    static constexpr size_t defaultAlignment = 64;
+
+    static constexpr RAMAllocation uninitialized() { return {Init::Uninitialized}; }
+
+    Init init = Init::Zero;
+    /// The alignment of the data in bytes, has to be a power of two. Representations created from
+    /// external storage, like memory mapped files, are not covered.
+    size_t alignment = defaultAlignment;
+    /// Ask the operating system to back large allocations with huge pages where supported,
+    /// currently transparent huge pages on Linux
+    bool hugePages = false;
+};
+
+/**
+ * \brief Allocates the memory of RAM representations
+ *
+ * The allocator used for new RAM representations can be replaced with util::setRAMAllocator,
+ * for example to allocate from a pool or from memory shared with another process. Allocations
+ * keep the allocator alive until they are deallocated.
+ */
+class IVW_CORE_API RAMAllocator {
+public:
+    virtual ~RAMAllocator() = default;
+    /**
+     * Allocate @p bytes of memory with the alignment of @p allocation. The memory does not have
+     * to be initialized.
+     * @throws std::bad_alloc if the allocation fails
+     */
+    virtual void* allocate(size_t bytes, const RAMAllocation& allocation) = 0;
+    /**
+     * Deallocate memory returned by allocate with the same @p bytes and @p allocation
+     */
+    virtual void deallocate(void* ptr, size_t bytes, const RAMAllocation& allocation) noexcept = 0;
+};
+
+/**
+ * The default RAMAllocator, uses aligned operator new. Allocations of huge pages are aligned to
+ * the huge page size.
+ */
+class IVW_CORE_API AlignedRAMAllocator : public RAMAllocator {
+public:
+    virtual void* allocate(size_t bytes, const RAMAllocation& allocation) override;
+    virtual void deallocate(void* ptr, size_t bytes,
+                            const RAMAllocation& allocation) noexcept override;
+};
+
+/**
+ * Deleter for the data of RAM representations. A default constructed deleter uses `delete[]`,
+ * for data passed in by the user, otherwise the memory is returned to the allocator.
+ */
+template <typename T>
+class RAMDeleter {
+public:
+    RAMDeleter() = default;
+    RAMDeleter(std::shared_ptr<RAMAllocator> allocator, size_t bytes, RAMAllocation allocation)
+        : allocator_{std::move(allocator)}, bytes_{bytes}, allocation_{allocation} {}
+
+    void operator()(T* ptr) const noexcept {
+        if (allocator_) {
+            allocator_->deallocate(ptr, bytes_, allocation_);
+        } else {
+            delete[] ptr;
+        }
+    }
+
+private:
+    std::shared_ptr<RAMAllocator> allocator_;
+    size_t bytes_ = 0;
+    RAMAllocation allocation_;
+};
+
+/// The storage of the data of RAM representations
+template <typename T>
+using RAMArray = std::unique_ptr<T[], RAMDeleter<T>>;
+
+namespace util {
+
+/**
+ * The allocator used for new RAM representations, an AlignedRAMAllocator by default
+ */
+IVW_CORE_API std::shared_ptr<RAMAllocator> getRAMAllocator();
+
+/**
+ * Replace the allocator used for new RAM representations, nullptr restores the default.
+ * Existing representations keep using the allocator they were allocated with.
+ */
+IVW_CORE_API void setRAMAllocator(std::shared_ptr<RAMAllocator> allocator);
+
+/**
+ * Allocate @p bytes using @p allocator and initialize them according to @p allocation
+ */
+IVW_CORE_API void* allocateRAM(RAMAllocator& allocator, size_t bytes,
+                               const RAMAllocation& allocation);
+
+/**
+ * Allocate an array of @p size elements using the current RAMAllocator
+ * @see getRAMAllocator
+ */
+template <typename T>
+RAMArray<T> makeRAMArray(size_t size, RAMAllocation allocation = {}) {
+    allocation.alignment = std::max(allocation.alignment, alignof(T));
+    auto allocator = getRAMAllocator();
+    const auto bytes = size * sizeof(T);
+    auto* data = static_cast<T*>(allocateRAM(*allocator, bytes, allocation));
+    return RAMArray<T>{data, RAMDeleter<T>{std::move(allocator), bytes, allocation}};
+}
+
+}  // namespace util
+
+/**
+ * \brief Copy-on-write storage of the data of RAM representations
+ *
+ * Copies share the data until one of them is written to through edit(), which first copies the
+ * data if it is shared. Hence copying a representation is cheap, and the cost of the copy is only
+ * paid if the copy is modified. Pointers returned by edit() stay valid until the storage is
+ * copied, since a later edit() then gives this storage a copy of its own.
+ * Sharing is thread safe, but write access to the same storage object has to be synchronized by
+ * the user as for any other object.
+ */
+template <typename T>
+class RAMStorage {
+public:
+    RAMStorage() = default;
+    explicit RAMStorage(RAMArray<T> array)
+        : data_{array.get()}
+        , owner_{array.release(), Owner{std::move(array.get_deleter()), true}} {}
+    /**
+     * Use @p data owned by @p owner, for example a memory mapped file
+     */
+    RAMStorage(std::shared_ptr<void> owner, T* data) : data_{data}, owner_{std::move(owner)} {}
+
+    const T* data() const { return data_; }
+
+    /**
+     * Detach the @p size elements of the storage and return them for writing
+     */
+    T* edit(size_t size) {
+        detach(size);
+        return data_;
+    }
+
+    /**
+     * Copy the @p size elements of the storage if they are shared with another storage, such that
+     * the data can be written without affecting the copies.
+     */
+    void detach(size_t size) {
+        if (owner_.use_count() > 1) {
+            auto copy = util::makeRAMArray<T>(size, RAMAllocation::uninitialized());
+            if (size > 0) std::memcpy(copy.get(), data_, size * sizeof(T));
+            *this = RAMStorage{std::move(copy)};
+        }
+    }
+
+    /**
+     * True if the data is shared with another storage
+     */
+    bool isShared() const { return owner_.use_count() > 1; }
+
+    /**
+     * Stop managing the data, it will not be deallocated by the storage.
+     */
+    void release(size_t size) {
+        detach(size);
+        if (auto* owner = std::get_deleter<Owner>(owner_)) owner->owns = false;
+    }
+
+private:
+    struct Owner {
+        RAMDeleter<T> deleter;
+        bool owns;
+        void operator()(T* ptr) const noexcept {
+            if (owns) deleter(ptr);
+        }
+    };
+
+    T* data_ = nullptr;
+    std::shared_ptr<void> owner_;
+};
+
+}  // namespace inviwo
@@ -60,6 +60,9 @@ public:
     BoolProperty logStackTraceProperty_;
     BoolProperty runtimeModuleReloading_;
     BoolProperty enableResourceManager_;
+    BoolProperty parallelEvaluation_;
+    IntSizeTProperty memoryBudget_;
+    IntSizeTProperty idleCompression_;
     OptionProperty<MessageBreakLevel> breakOnMessage_;
     BoolProperty breakOnException_;
     BoolProperty stackTraceInException_;
@@ -0,0 +1,134 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace inviwo {
+
+/**
+ * A move only type erased `void()` callable with a small buffer optimization. Callables that fit
+ * in the internal buffer, i.e. lambdas capturing a few pointers, a std::packaged_task, or a
+ * std::function, are stored inline without any heap allocation. Larger callables fall back to
+ * the heap. Used for the tasks in the ThreadPool, where a std::function would require copyable
+ * callables and an extra allocation for anything but the smallest lambdas.
+ */
+class TaskFunction {
+public:
+    static constexpr size_t bufferSize = 6 * sizeof(void*);
+
+    TaskFunction() noexcept = default;
+
+    template <typename F, typename = std::enable_if_t<
+                              !std::is_same_v<std::decay_t<F>, TaskFunction> &&
+                              std::is_invocable_v<std::decay_t<F>&>>>
+    TaskFunction(F&& f) {
+        using Func = std::decay_t<F>;
+        if constexpr (fitsInBuffer<Func>) {
+            ::new (static_cast<void*>(buffer_)) Func(std::forward<F>(f));
+            vtable_ = &inlineVTable<Func>;
+        } else {
+            ::new (static_cast<void*>(buffer_)) Func*(new Func(std::forward<F>(f)));
+            vtable_ = &heapVTable<Func>;
+        }
+    }
+
+    TaskFunction(const TaskFunction&) = delete;
+    TaskFunction& operator=(const TaskFunction&) = delete;
+
+    TaskFunction(TaskFunction&& rhs) noexcept : vtable_{rhs.vtable_} {
+        if (vtable_) {
+            vtable_->move(buffer_, rhs.buffer_);
+            rhs.vtable_ = nullptr;
+        }
+    }
+    TaskFunction& operator=(TaskFunction&& rhs) noexcept {
+        if (this != &rhs) {
+            reset();
+            vtable_ = rhs.vtable_;
+            if (vtable_) {
+                vtable_->move(buffer_, rhs.buffer_);
+                rhs.vtable_ = nullptr;
+            }
+        }
+        return *this;
+    }
+    ~TaskFunction() { reset(); }
+
+    void operator()() { vtable_->invoke(buffer_); }
+    explicit operator bool() const noexcept { return vtable_ != nullptr; }
+
+    void reset() noexcept {
+        if (vtable_) {
+            vtable_->destroy(buffer_);
+            vtable_ = nullptr;
+        }
+    }
+
+private:
+    struct VTable {
+        void (*invoke)(void* buffer);
+        void (*move)(void* dst, void* src) noexcept;  //< move construct dst and destroy src
+        void (*destroy)(void* buffer) noexcept;
+    };
+
+    template <typename Func>
+    static constexpr bool fitsInBuffer = sizeof(Func) <= bufferSize &&
+                                         alignof(Func) <= alignof(std::max_align_t) &&
+                                         std::is_nothrow_move_constructible_v<Func>;
+
+    template <typename Func>
+    static constexpr VTable inlineVTable{
+        [](void* buffer) { std::invoke(*static_cast<Func*>(buffer)); },
+        [](void* dst, void* src) noexcept {
+            ::new (dst) Func(std::move(*static_cast<Func*>(src)));
+            static_cast<Func*>(src)->~Func();
+        },
+        [](void* buffer) noexcept { static_cast<Func*>(buffer)->~Func(); }};
+
+    template <typename Func>
+    static constexpr VTable heapVTable{
+        [](void* buffer) { std::invoke(**static_cast<Func**>(buffer)); },
+        [](void* dst, void* src) noexcept {
+            ::new (dst) Func*(*static_cast<Func**>(src));
+        },
+        [](void* buffer) noexcept { delete *static_cast<Func**>(buffer); }};
+
+    alignas(std::max_align_t) std::byte buffer_[bufferSize];
+    const VTable* vtable_ = nullptr;
+};
+
+}  // namespace inviwo
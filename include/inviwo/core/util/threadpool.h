@@ -57,23 +57,60 @@
 #pragma once
 
 #include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/cancellationtoken.h>
+#include <inviwo/core/util/latch.h>
+#include <inviwo/core/util/taskfunction.h>
 
 #include <warn/push>
 #include <warn/ignore/all>
+#include <array>
 #include <vector>
-#include <queue>
+#include <deque>
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
 #include <future>
 #include <functional>
 #include <stdexcept>
 #include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <utility>
 #include <warn/pop>
 
 namespace inviwo {
 
+/**
+ * Scheduling priority of tasks in the ThreadPool. Workers will always pick up queued tasks with a
+ * higher priority first. Running tasks are never preempted.
+ */
+enum class TaskPriority {
+    Interactive,  ///< Work the user is waiting for, i.e. network evaluation
+    Normal,       ///< The default, i.e. PoolProcessor jobs
+    Background    ///< Work that nobody is waiting for, i.e. histogram calculations
+};
+
+/**
+ * A work stealing thread pool.
+ * Each worker has its own task deque. Tasks enqueued from a worker thread are put on the back of
+ * the worker's own deque and are taken from the back again (LIFO) for cache locality. Tasks
+ * enqueued from any other thread go into one of three shared queues depending on their
+ * TaskPriority. Idle workers look for tasks in the following order: the shared interactive queue,
+ * their own deque, the shared normal queue, the shared background queue, and finally they steal
+ * from the front of the other workers' deques. Tasks enqueued from within a task are considered
+ * part of the parent task and end up in the worker's own deque regardless of priority.
+ *
+ * Every task carries a CancellationToken, that the task can poll using
+ * ThreadPool::currentToken(). By default a task inherits the token of the task that enqueued it.
+ * Cancelled tasks are still called, such that any bookkeeping in them is done, but should return
+ * as soon as possible.
+ *
+ * A worker thread waiting for a future using ThreadPool::wait will execute queued tasks while
+ * waiting, this makes it safe to do nested parallelism, i.e. enqueue tasks and wait for them from
+ * within a task.
+ */
 class IVW_CORE_API ThreadPool {
 public:
     ThreadPool(
@@ -83,15 +120,80 @@ public:
 
     /**
      * Enqueue function f with arguments args. The function f may throw exceptions.
+     * The task will have TaskPriority::Normal and inherit the current CancellationToken.
      * @return a future to the result of f
      */
     template <class F, class... Args>
     auto enqueue(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>;
 
+    /**
+     * Enqueue function f with arguments args using the given \p priority. The function f may
+     * throw exceptions. The task will inherit the current CancellationToken.
+     * @return a future to the result of f
+     */
+    template <class F, class... Args>
+    auto enqueue(TaskPriority priority, F&& f, Args&&... args)
+        -> std::future<std::invoke_result_t<F, Args...>>;
+
+    /**
+     * Enqueue function f with arguments args using the given \p priority and cancellation
+     * \p token. The function f may throw exceptions.
+     * @return a future to the result of f
+     */
+    template <class F, class... Args>
+    auto enqueue(TaskPriority priority, CancellationToken token, F&& f, Args&&... args)
+        -> std::future<std::invoke_result_t<F, Args...>>;
+
     /**
      * Enqueue a plain functor. The functor may not throw exceptions.
      */
-    void enqueueRaw(std::function<void()> f);
+    void enqueueRaw(TaskFunction f, TaskPriority priority = TaskPriority::Normal,
+                    CancellationToken token = currentToken());
+
+    /**
+     * Split the index range [0, size) into \p jobs contiguous sub ranges and enqueue a call to
+     * `func(begin, end)` for each of them. All the tasks are enqueued with a single lock and share
+     * one Latch for completion instead of one future each. The tasks inherit the current
+     * CancellationToken. Exceptions thrown by \p func are rethrown by Latch::get.
+     * ```{.cpp}
+     * auto latch = pool.enqueueRange(data.size(), 4 * pool.getSize(),
+     *                                [&](size_t begin, size_t end) {
+     *                                    for (size_t i = begin; i < end; ++i) data[i] *= 2;
+     *                                });
+     * pool.wait(*latch);
+     * latch->get();
+     * ```
+     * @return a latch that is ready once all sub ranges are done.
+     */
+    template <typename F>
+    std::shared_ptr<Latch> enqueueRange(size_t size, size_t jobs, F&& func,
+                                        TaskPriority priority = TaskPriority::Normal);
+
+    /**
+     * The CancellationToken of the task running on the calling thread. Returns a token that is
+     * never cancelled if the calling thread is not running a pool task.
+     */
+    static const CancellationToken& currentToken();
+
+    /**
+     * Wait for \p future to become ready. When called from one of the pool's worker threads,
+     * queued tasks are executed while waiting, such that a task can wait for tasks it enqueued
+     * itself without starving the pool. On any other thread this is equivalent to future.wait().
+     */
+    template <typename Future>
+    void wait(const Future& future);
+
+    /**
+     * Wait for \p latch to become ready, executing queued tasks while waiting if called from one
+     * of the pool's worker threads.
+     * @see wait(const Future&)
+     */
+    void wait(const Latch& latch);
+
+    /**
+     * Returns true if the calling thread is one of the worker threads of this pool.
+     */
+    bool isWorkerThread() const;
 
     size_t trySetSize(size_t size);
     size_t getSize() const;
@@ -107,6 +209,11 @@ private:
         Done      //< Worker is waiting to be joined.
     };
 
+    struct Task {
+        TaskFunction func;
+        CancellationToken token;
+    };
+
     struct Worker {
         Worker(ThreadPool& pool);
         Worker(const Worker&) = delete;
@@ -116,16 +223,56 @@ private:
         ~Worker();
 
         std::atomic<State> state;  //< State of the worker
+        ThreadPool* pool;
+        // Local tasks, the owning worker pushes and pops at the back, thieves take from the front
+        std::deque<Task> tasks;
+        std::mutex mutex;
         std::thread thread;
     };
+
+    void push(Task task, TaskPriority priority);
+    /**
+     * Push \p count tasks created by \p makeTask(i) while only locking the queue once.
+     */
+    template <typename MakeTask>
+    void pushBulk(size_t count, TaskPriority priority, MakeTask&& makeTask);
+    /**
+     * Lock and return the queue that tasks of \p priority enqueued from the calling thread go to.
+     */
+    std::pair<std::deque<Task>*, std::unique_lock<std::mutex>> lockQueue(TaskPriority priority);
+    /**
+     * Find a task in the shared queues, the calling worker's own deque, or steal one from another
+     * worker, in the order described in the class documentation.
+     */
+    bool pop(Worker* self, Task& task);
+    bool popShared(TaskPriority priority, Task& task);
+    /**
+     * Run the task with its cancellation token set as the current token.
+     */
+    static void run(Task& task);
+    /**
+     * Execute one queued task on the calling worker thread. Returns false if there was nothing to
+     * do or if the calling thread is not a worker of this pool.
+     */
+    bool runPendingTask();
+    void notify(bool all);
+
+    // The worker that is running on the calling thread, or nullptr.
+    static Worker*& currentWorker();
+    static CancellationToken& currentTokenRef();
+
     // need to keep track of threads so we can join them
     std::vector<std::unique_ptr<Worker>> workers;
+    // guards the workers vector, exclusive when adding or removing workers, shared when stealing
+    mutable std::shared_mutex workers_mutex;
 
-    // the task queue
-    std::queue<std::function<void()>> tasks;
-
-    // synchronization
+    // the shared task queues for tasks enqueued from outside the pool, one per TaskPriority
+    std::array<std::deque<Task>, 3> tasks;
     std::mutex queue_mutex;
+
+    // synchronization, queued counts the tasks in all queues, sleeping the number of idle workers
+    std::atomic<size_t> queued;
+    std::atomic<size_t> sleeping;
     std::condition_variable condition;
 
     // Thread start end exit actions
@@ -136,21 +283,103 @@ private:
 // add new work item to the pool
 template <class F, class... Args>
 auto ThreadPool::enqueue(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
+    return enqueue(TaskPriority::Normal, currentToken(), std::forward<F>(f),
+                   std::forward<Args>(args)...);
+}
+
+template <class F, class... Args>
+auto ThreadPool::enqueue(TaskPriority priority, F&& f, Args&&... args)
+    -> std::future<std::invoke_result_t<F, Args...>> {
+    return enqueue(priority, currentToken(), std::forward<F>(f), std::forward<Args>(args)...);
+}
+
+template <class F, class... Args>
+auto ThreadPool::enqueue(TaskPriority priority, CancellationToken token, F&& f, Args&&... args)
+    -> std::future<std::invoke_result_t<F, Args...>> {
     using return_type = std::invoke_result_t<F, Args...>;
 
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
-        std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+    // The packaged task is move only and fits in the TaskFunction buffer, hence the only allocation
+    // is the shared state of the future.
+    std::packaged_task<return_type()> task{
+        [f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable -> return_type {
+            return std::invoke(f, args...);
+        }};
 
-    std::future<return_type> res = task->get_future();
+    std::future<return_type> res = task.get_future();
 
+    Task item{std::move(task), std::move(token)};
     if (workers.empty()) {
-        (*task)();  // No worker threads, just run the task.
+        run(item);  // No worker threads, just run the task.
     } else {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace([task]() { (*task)(); });
+        push(std::move(item), priority);
     }
-    condition.notify_one();
     return res;
 }
 
+template <typename F>
+std::shared_ptr<Latch> ThreadPool::enqueueRange(size_t size, size_t jobs, F&& func,
+                                                TaskPriority priority) {
+    static_assert(std::is_invocable_v<std::decay_t<F>&, size_t, size_t>,
+                  "func should be callable with (size_t begin, size_t end)");
+
+    jobs = std::min(std::max(jobs, size_t{1}), size);
+
+    // The latch and the functor share one allocation
+    struct RangeState {
+        RangeState(size_t count, F&& f) : latch{count}, func{std::forward<F>(f)} {}
+        Latch latch;
+        std::decay_t<F> func;
+    };
+    auto state = std::make_shared<RangeState>(jobs, std::forward<F>(func));
+
+    const auto makeTask = [&](size_t job) {
+        const auto begin = (size * job) / jobs;
+        const auto end = (size * (job + 1)) / jobs;
+        return Task{[state, begin, end]() {
+                        try {
+                            state->func(begin, end);
+                        } catch (...) {
+                            state->latch.setException(std::current_exception());
+                        }
+                        state->latch.countDown();
+                    },
+                    currentToken()};
+    };
+
+    if (workers.empty()) {
+        for (size_t job = 0; job < jobs; ++job) {
+            auto task = makeTask(job);
+            run(task);  // No worker threads, just run the task.
+        }
+    } else {
+        pushBulk(jobs, priority, makeTask);
+    }
+    return std::shared_ptr<Latch>(state, &state->latch);
+}
+
+template <typename MakeTask>
+void ThreadPool::pushBulk(size_t count, TaskPriority priority, MakeTask&& makeTask) {
+    // Count the tasks before they are visible, pop will then never decrement below zero
+    queued += count;
+    {
+        auto [queue, lock] = lockQueue(priority);
+        for (size_t i = 0; i < count; ++i) {
+            queue->push_back(makeTask(i));
+        }
+    }
+    notify(count > 1);
+}
+
+template <typename Future>
+void ThreadPool::wait(const Future& future) {
+    if (!isWorkerThread()) {
+        future.wait();
+        return;
+    }
+    while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+        // Nothing to help with, block for a while but wake up regularly to look for new tasks
+        if (!runPendingTask()) future.wait_for(std::chrono::milliseconds{1});
+    }
+}
+
 }  // namespace inviwo
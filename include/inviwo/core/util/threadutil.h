@@ -70,6 +70,29 @@ auto dispatchPool(InviwoApplication* app, F&& f, Args&&... args)
     return getThreadPool(app).enqueue(std::forward<F>(f), std::forward<Args>(args)...);
 }
 
+/**
+ * Dispatch f to the thread pool using the given \p priority, the task inherits the current
+ * CancellationToken.
+ * @see TaskPriority, ThreadPool::currentToken
+ */
+template <class F, class... Args>
+auto dispatchPool(TaskPriority priority, F&& f, Args&&... args)
+    -> std::future<std::invoke_result_t<F, Args...>> {
+    return getThreadPool().enqueue(priority, std::forward<F>(f), std::forward<Args>(args)...);
+}
+
+/**
+ * Dispatch f to the thread pool using the given \p priority and cancellation \p token. The task
+ * can poll the token using ThreadPool::currentToken().
+ * @see TaskPriority, CancellationSource
+ */
+template <class F, class... Args>
+auto dispatchPool(TaskPriority priority, CancellationToken token, F&& f, Args&&... args)
+    -> std::future<std::invoke_result_t<F, Args...>> {
+    return getThreadPool().enqueue(priority, std::move(token), std::forward<F>(f),
+                                   std::forward<Args>(args)...);
+}
+
 IVW_CORE_API void dispatchFrontAndForget(std::function<void()> fun);
 IVW_CORE_API void dispatchFrontAndForget(InviwoApplication* app, std::function<void()> fun);
 
@@ -0,0 +1,162 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace inviwo {
+
+/**
+ * \brief Records a timeline of events in the trace event format
+ *
+ * The recorded events can be written as a JSON file that can be opened in a trace viewer like
+ * chrome://tracing or https://ui.perfetto.dev. Each thread records its events into its own buffer,
+ * hence recording from different threads does not contend. When recording is disabled, which is
+ * the default, the cost of a trace point is a single relaxed atomic load.
+ *
+ * Events are added using the IVW_TRACE_SCOPE macro
+ * ```{.cpp}
+ * void MyProcessor::process() {
+ *     IVW_TRACE_SCOPE("processor", getIdentifier());
+ *     ...
+ * }
+ * ```
+ * The name argument is only evaluated when recording is enabled.
+ * Recording can be enabled from the command line using `--trace <file>`, the trace is then
+ * written to the file when the application exits.
+ * @see NetworkTraceObserver
+ */
+class IVW_CORE_API TraceRecorder {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static bool isEnabled() noexcept { return enabled_.load(std::memory_order_relaxed); }
+    static void setEnabled(bool enabled);
+
+    /**
+     * Record an event on the calling thread spanning [start, end).
+     * The category has to be a string literal.
+     */
+    static void complete(const char* category, std::string name, Clock::time_point start,
+                         Clock::time_point end);
+    /**
+     * Record the beginning of an asynchronous span identified by \p id. Asynchronous spans may
+     * overlap other spans on the same thread, and are shown on separate tracks.
+     * The category has to be a string literal.
+     */
+    static void asyncBegin(const char* category, std::string name, const void* id);
+    /**
+     * Record the end of an asynchronous span started with asyncBegin
+     */
+    static void asyncEnd(const char* category, std::string name, const void* id);
+
+    /**
+     * Set the name of the calling thread in the trace. While recording is disabled the name is
+     * only remembered, and used once the thread records its first event.
+     */
+    static void setThreadName(std::string_view name);
+
+    /**
+     * The number of recorded events
+     */
+    static size_t size();
+    /**
+     * Remove all recorded events
+     */
+    static void clear();
+
+    /**
+     * Write all recorded events as trace event JSON.
+     */
+    static void write(std::ostream& os);
+    /**
+     * Write all recorded events as trace event JSON to \p filename.
+     * @throw FileException if the file could not be opened
+     */
+    static void write(std::string_view filename);
+
+    /**
+     * Records a complete event spanning its lifetime. When constructed with a callable the name
+     * is only created, and the event only recorded, if recording is enabled at construction.
+     */
+    class IVW_CORE_API Scope {
+    public:
+        Scope(const char* category, std::string name)
+            : category_{category}, name_{std::move(name)}, start_{Clock::now()} {}
+        template <typename Name,
+                  typename = std::enable_if_t<std::is_invocable_r_v<std::string, Name>>>
+        Scope(const char* category, Name&& name) : category_{category} {
+            if (isEnabled()) {
+                name_ = std::invoke(std::forward<Name>(name));
+                start_ = Clock::now();
+            }
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope() {
+            if (start_ != Clock::time_point{}) {
+                TraceRecorder::complete(category_, std::move(name_), start_, Clock::now());
+            }
+        }
+
+    private:
+        const char* category_;
+        std::string name_;
+        Clock::time_point start_{};
+    };
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+}  // namespace inviwo
+
+#define IVW_TRACE_CONCAT_IMPL(x, y) x##y
+#define IVW_TRACE_CONCAT(x, y) IVW_TRACE_CONCAT_IMPL(x, y)
+
+/**
+ * \def IVW_TRACE_SCOPE(category, name)
+ * Records a trace event spanning from here to the end of the current scope if tracing is enabled.
+ * \p name is only evaluated if tracing is enabled. Expands to a single declaration.
+ * @see TraceRecorder
+ */
+#define IVW_TRACE_SCOPE(category, name)                                            \
+    const ::inviwo::TraceRecorder::Scope IVW_TRACE_CONCAT(ivwTraceScope, __LINE__) { \
+        category, [&]() { return std::string(name); }                             \
+    }
@@ -31,11 +31,9 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/parallelfor.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
 
-#include <vector>
-#include <future>
-
 namespace inviwo {
 
 namespace util {
@@ -57,39 +55,16 @@ void forEachVoxel(const VolumeRAM& v, C callback) {
     forEachVoxel(v.getDimensions(), callback);
 }
 
+/**
+ * Call \p callback for each voxel in parallel, the volume is tiled into bricks which are
+ * distributed over \p jobs tasks, 4 times the pool size if \p jobs is zero.
+ * @see util::parallelFor
+ */
 template <typename C>
 void forEachVoxelParallel(const size3_t dims, C callback, size_t jobs = 0) {
-    const size_t poolSize = util::getPoolSize();
-    if (jobs == 0) {
-        jobs = 4 * poolSize;
-    }
-    if ((jobs == 0) || (poolSize == 0)) {
-        // fallback to serial version
-        forEachVoxel(dims, callback);
-        return;
-    }
-
-    std::vector<std::future<void>> futures;
-    for (size_t job = 0; job < jobs; ++job) {
-        size3_t start = size3_t(0, 0, job * dims.z / jobs);
-        size3_t stop = size3_t(dims.x, dims.y, std::min(dims.z, (job + 1) * dims.z / jobs));
-
-        futures.push_back(util::dispatchPool([&callback, start, stop]() {
-            size3_t pos{0};
-
-            for (pos.z = start.z; pos.z < stop.z; ++pos.z) {
-                for (pos.y = start.y; pos.y < stop.y; ++pos.y) {
-                    for (pos.x = start.x; pos.x < stop.x; ++pos.x) {
-                        callback(pos);
-                    }
-                }
-            }
-        }));
-    }
-
-    for (const auto& e : futures) {
-        e.wait();
-    }
+    ParallelSettings settings;
+    settings.jobs = jobs;
+    parallelFor(dims, callback, settings);
 }
 template <typename C>
 void forEachVoxelParallel(const VolumeRAM& v, C callback, size_t jobs = 0) {
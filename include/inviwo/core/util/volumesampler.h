@@ -60,7 +60,7 @@ protected:
     Vector<DataDims, double> getVoxel(const size3_t& pos) const;
 
     std::shared_ptr<const Volume> volume_;
-    const VolumeRAM* ram_;
+    std::shared_ptr<const VolumeRAM> ram_;
     size3_t dims_;
 };
 
@@ -76,7 +76,7 @@ VolumeDoubleSampler<DataDims>::VolumeDoubleSampler(std::shared_ptr<const Volume>
 template <unsigned int DataDims>
 VolumeDoubleSampler<DataDims>::VolumeDoubleSampler(const Volume& vol, CoordinateSpace space)
     : SpatialSampler<3, DataDims, double>(vol, space)
-    , ram_(vol.getRepresentation<VolumeRAM>())
+    , ram_(vol.getRepresentationShared<VolumeRAM>())
     , dims_(vol.getDimensions()) {}
 
 template <unsigned int DataDims>
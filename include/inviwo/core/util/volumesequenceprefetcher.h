@@ -0,0 +1,109 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/cancellationtoken.h>
+#include <inviwo/core/util/volumesequenceutils.h>
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * \class VolumeSequencePrefetcher
+ * \brief Loads the VolumeRAM of the upcoming steps of a volume sequence in the background.
+ *
+ * Steps of sequences read lazily from disk, e.g. by the DatVolumeSequenceReader, are otherwise
+ * loaded when they are shown, which stalls playback. Call update() each time a step is shown.
+ * The prefetcher extrapolates the next steps from the change of the index since the previous
+ * call, i.e. from the direction and the stride of the playback, and loads the VolumeRAM of up to
+ * getAhead() of them on the thread pool with TaskPriority::Background. The sequence wraps around
+ * at its ends, like the SequenceTimerProperty.
+ *
+ * The prefetched representations are held through Data::getRepresentationShared, which keeps
+ * the ResidencyManager from evicting them, until their step is shown or falls out of the window.
+ * The steps ahead are limited to getBudget() bytes in total, a budget of zero means no limit.
+ */
+class IVW_CORE_API VolumeSequencePrefetcher {
+public:
+    explicit VolumeSequencePrefetcher(size_t ahead = 4, size_t budget = 0);
+    VolumeSequencePrefetcher(const VolumeSequencePrefetcher&) = delete;
+    VolumeSequencePrefetcher& operator=(const VolumeSequencePrefetcher&) = delete;
+    ~VolumeSequencePrefetcher();
+
+    void setAhead(size_t steps);
+    size_t getAhead() const { return ahead_; }
+    void setBudget(size_t bytes);
+    size_t getBudget() const { return budget_; }
+
+    /**
+     * Prefetch from @p sequence, releasing everything prefetched from the previous one.
+     */
+    void setSequence(std::shared_ptr<const VolumeSequence> sequence);
+
+    /**
+     * Notify that step @p index, counting from zero, is shown and prefetch the steps after it.
+     */
+    void update(size_t index);
+
+    /**
+     * Cancel the pending loads and release all prefetched representations.
+     */
+    void clear();
+
+    /**
+     * Wait for the pending loads to finish.
+     */
+    void wait();
+
+    /**
+     * The steps for which a VolumeRAM is currently held.
+     */
+    std::vector<size_t> getPrefetched() const;
+
+private:
+    struct State;
+
+    size_t ahead_;
+    size_t budget_;
+    std::shared_ptr<const VolumeSequence> sequence_;
+    std::optional<size_t> last_;
+    std::ptrdiff_t stride_ = 1;
+    CancellationSource cancel_;
+    std::shared_ptr<State> state_;
+    std::vector<std::future<void>> pending_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,99 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/cancellationtoken.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace inviwo {
+
+class Volume;
+class VolumeRAM;
+
+namespace util {
+
+/**
+ * A set of consecutive z-layers of a volume, extended with halo layers before and after where
+ * available. @see forEachVolumeSlab
+ */
+struct VolumeSlab {
+    /// The voxels of the slab, including the halo layers
+    std::shared_ptr<const VolumeRAM> ram;
+    /// The first layer of the slab in the volume, excluding the halo
+    size_t z;
+    /// The number of layers of the slab, excluding the halo
+    size_t depth;
+    /// The number of halo layers before the slab, i.e. layer `z` of the volume is layer
+    /// `haloBefore` of `ram`
+    size_t haloBefore;
+};
+
+/// The default size of a slab in bytes, @see slabDepth
+constexpr size_t defaultSlabBytes = 256 * 1024 * 1024;
+
+/**
+ * Returns true if the volume can be read in slabs without loading all of it, i.e. if it has a
+ * valid VolumeDisk representation with a loader that supports reading subregions.
+ * @see VolumeDisk::canReadRegion
+ */
+IVW_CORE_API bool canStreamSlabs(const Volume& volume);
+
+/**
+ * Returns true if algorithms should stream the volume in slabs instead of loading it. That is
+ * the case when the volume can be streamed, is not already in RAM, and is larger than the memory
+ * budget of the ResidencyManager. Without a memory budget volumes are never streamed implicitly.
+ */
+IVW_CORE_API bool shouldStreamSlabs(const Volume& volume);
+
+/**
+ * The number of z-layers of @p volume that fit into @p bytes, at least one.
+ */
+IVW_CORE_API size_t slabDepth(const Volume& volume, size_t bytes = defaultSlabBytes);
+
+/**
+ * Call @p callback for consecutive slabs of @p depth z-layers of @p volume, in order. Each slab
+ * is extended with up to @p halo layers before and after, fewer at the borders of the volume.
+ * The next slab is read from disk in a thread pool task while the callback processes the current
+ * one, hence the memory used is about two slabs.
+ *
+ * If the volume can not be streamed, @see canStreamSlabs, the callback is called once with the
+ * whole VolumeRAM representation. Stops early if @p token is cancelled.
+ */
+IVW_CORE_API void forEachVolumeSlab(const Volume& volume, size_t depth, size_t halo,
+                                    const std::function<void(const VolumeSlab&)>& callback,
+                                    const CancellationToken& token = {});
+
+}  // namespace util
+
+}  // namespace inviwo
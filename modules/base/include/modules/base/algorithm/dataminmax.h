@@ -67,6 +67,10 @@ IVW_MODULE_BASE_API std::pair<dvec4, dvec4> layerMinMax(
 IVW_MODULE_BASE_API std::pair<dvec4, dvec4> bufferMinMax(
     const BufferRAM* layer, IgnoreSpecialValues ignore = IgnoreSpecialValues::No);
 
+/**
+ * Compute the component-wise minimum and maximum of @p volume. Large volumes are streamed from
+ * disk in slabs instead of being loaded, @see util::shouldStreamSlabs
+ */
 IVW_MODULE_BASE_API std::pair<dvec4, dvec4> volumeMinMax(
     const Volume* volume, IgnoreSpecialValues ignore = IgnoreSpecialValues::No);
 
@@ -38,8 +38,10 @@ class Volume;
 
 namespace util {
 
+/**
+ * Returns nullptr if the calling task is cancelled, see ThreadPool::currentToken.
+ */
 IVW_MODULE_BASE_API std::unique_ptr<Volume> curlVolume(std::shared_ptr<const Volume> volume);
-
 IVW_MODULE_BASE_API std::unique_ptr<Volume> curlVolume(const Volume& volume);
 
 }  // namespace util
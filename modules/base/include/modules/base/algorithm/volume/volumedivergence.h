@@ -38,6 +38,9 @@ class Volume;
 
 namespace util {
 
+/**
+ * Returns nullptr if the calling task is cancelled, see ThreadPool::currentToken.
+ */
 IVW_MODULE_BASE_API std::unique_ptr<Volume> divergenceVolume(const Volume& volume);
 IVW_MODULE_BASE_API std::unique_ptr<Volume> divergenceVolume(std::shared_ptr<const Volume> volume);
 
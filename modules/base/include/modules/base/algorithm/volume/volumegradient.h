@@ -32,6 +32,7 @@
 #include <modules/base/basemoduledefine.h>
 
 #include <memory>
+#include <string_view>
 
 namespace inviwo {
 
@@ -39,9 +40,34 @@ class Volume;
 
 namespace util {
 
+/**
+ * Calculate the world space gradient of @p channel of @p volume. The gradient with respect to the
+ * voxel indices is computed using central differences of neighboring voxels, one-sided at the
+ * borders, and mapped to world space with the inverse transposed index to world basis. Hence it
+ * is exact for linear functions, also in sheared or rotated volumes.
+ * If @p volume already has a VolumeBrickedRAM with an apron of at least one voxel, the gradient is
+ * computed brick by brick from it instead of from the VolumeRAM.
+ * Returns nullptr if the calling task is cancelled, see ThreadPool::currentToken.
+ */
 IVW_MODULE_BASE_API std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume,
                                                            int channel);
 
+/**
+ * Calculate the gradient of @p channel of @p volume and write it to @p outputFile, without
+ * loading all of the input or output into memory. The volume is processed in slabs of z-layers,
+ * @see util::forEachVolumeSlab. The gradient is computed in the same way as by the in-memory
+ * version, and the results are the same.
+ *
+ * If @p outputFile has the extension ".ivf" an ivf header is written with the voxel data next to
+ * it in a ".raw" file, otherwise the raw voxel data is written to @p outputFile directly.
+ * Existing files are overwritten.
+ * @return a volume that loads the gradient from the written file when needed, or nullptr if the
+ *         calling task is cancelled
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume,
+                                                           int channel,
+                                                           std::string_view outputFile);
+
 }  // namespace util
 
 }  // namespace inviwo
@@ -43,6 +43,7 @@
 #include <inviwo/core/util/glmutils.h>                                  // for same_extent
 #include <inviwo/core/util/glmvec.h>                                    // for dvec3, dvec2, siz...
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper3D
+#include <inviwo/core/util/parallelfor.h>                               // for parallelReduce
 #include <inviwo/core/util/templatesampler.h>                           // for TemplateVolumeSam...
 #include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxelParallel
 
@@ -68,6 +69,9 @@ namespace util {
 
 enum class VolumeLaplacianPostProcessing { None, Normalized, SignNormalized, Scaled };
 
+/**
+ * Returns nullptr if the calling task is cancelled, see ThreadPool::currentToken.
+ */
 IVW_MODULE_BASE_API std::shared_ptr<Volume> volumeLaplacian(
     std::shared_ptr<const Volume> volume, VolumeLaplacianPostProcessing postProcessing,
     double scale);
@@ -111,10 +115,8 @@ std::shared_ptr<Volume> VolumeLaplacianDispatcher::operator()(
     const auto resDim = dvec3(1.0) / dvec3(volume->getDimensions() - size3_t(1));
     const auto resSpace2 = dvec3(1.0) / (spacing * spacing);
 
-    auto minval(std::numeric_limits<double>::max());
-    auto maxval(std::numeric_limits<double>::lowest());
-
-    auto func = [&](const size3_t& pos) {
+    // Each task tracks its own range, which are combined once all voxels are done
+    auto func = [&](dvec2& range, const size3_t& pos) {
         const dvec3 world{m * dvec4((dvec3(pos) + dvec3(0.5)) * resDim, 1.0)};
 
         const auto center = 2.0 * s.sample(world);
@@ -124,16 +126,23 @@ std::shared_ptr<Volume> VolumeLaplacianDispatcher::operator()(
         const auto laplacian = center + D2x + D2y + D2z;
 
         for (size_t i = 0; i < comp; ++i) {
-            minval = glm::min(minval, util::glmcomp(laplacian, i));
-            maxval = glm::max(maxval, util::glmcomp(laplacian, i));
+            range.x = glm::min(range.x, util::glmcomp(laplacian, i));
+            range.y = glm::max(range.y, util::glmcomp(laplacian, i));
         }
         newData[index(pos)] = static_cast<R>(laplacian);
     };
 
-    util::forEachVoxelParallel(*volume->getRepresentation<VolumeRAM>(), func);
+    const auto range = util::parallelReduce(
+        volume->getDimensions(),
+        dvec2{std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()}, func,
+        [](const dvec2& a, const dvec2& b) {
+            return dvec2{glm::min(a.x, b.x), glm::max(a.y, b.y)};
+        });
+    // The calling task was cancelled
+    if (!range) return nullptr;
 
     // Make range symmetric
-    auto rangemax = std::max(std::abs(minval), std::abs(maxval));
+    auto rangemax = std::max(std::abs(range->x), std::abs(range->y));
 
     switch (postProcessing) {
         case VolumeLaplacianPostProcessing::Normalized:
@@ -37,6 +37,7 @@
 
 namespace inviwo {
 
+class Volume;
 class VolumeRAM;
 
 namespace util {
@@ -44,6 +45,13 @@ namespace util {
 IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeSubSample(const VolumeRAM* in,
                                                                size3_t factors);
 
+/**
+ * Subsample @p volume by averaging blocks of @p factors voxels. Large volumes are streamed from
+ * disk in slabs instead of being loaded, @see util::shouldStreamSlabs
+ */
+IVW_MODULE_BASE_API std::shared_ptr<VolumeRAM> volumeSubSample(const Volume& volume,
+                                                               size3_t factors);
+
 }  // namespace util
 
 }  // namespace inviwo
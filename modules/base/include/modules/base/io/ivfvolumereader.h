@@ -34,12 +34,21 @@
 #include <inviwo/core/datastructures/volume/volume.h>  // for DataReaderType
 #include <inviwo/core/io/datareader.h>                 // for DataReaderType
 
+#include <any>          // for any
+#include <cstddef>      // for size_t
 #include <memory>       // for shared_ptr
 #include <string_view>  // for string_view
 
 namespace inviwo {
 /**
  * \ingroup dataio
+ * Reads version 1 and 2 ivf files. Supported options:
+ *   * "Level" (size_t): the resolution level to read from a version 2 file with a pyramid of
+ *     downsampled levels, 0 being the full resolution. Larger levels than available read the
+ *     coarsest one. @see util::writeCompressedIvfVolume
+ *   * "MemoryMap" (bool): memory map uncompressed files instead of reading them, if possible.
+ *     Off by default, the file must not be modified while the volume is alive.
+ *     @see RawVolumeRAMLoader
  */
 class IVW_MODULE_BASE_API IvfVolumeReader : public DataReaderType<Volume> {
 public:
@@ -50,6 +59,26 @@ public:
     virtual ~IvfVolumeReader() = default;
 
     virtual std::shared_ptr<Volume> readData(std::string_view filePath) override;
+
+    virtual bool setOption(std::string_view key, std::any value) override;
+    virtual std::any getOption(std::string_view key) override;
+
+private:
+    size_t level_ = 0;
+    bool memoryMap_ = false;
 };
 
+namespace util {
+
+/**
+ * Read @p level of the ivf file @p filePath, where level 0 is the full resolution. The level
+ * covers the same space as the full resolution volume, with fewer voxels. Files without
+ * downsampled levels always read the full resolution.
+ * @see IvfVolumeReader, writeCompressedIvfVolume
+ */
+IVW_MODULE_BASE_API std::shared_ptr<Volume> readIvfVolumeLevel(std::string_view filePath,
+                                                               size_t level);
+
+}  // namespace util
+
 }  // namespace inviwo
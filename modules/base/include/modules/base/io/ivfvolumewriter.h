@@ -31,15 +31,24 @@
 
 #include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
 
-#include <inviwo/core/datastructures/volume/volume.h>  // for DataWriterType
-#include <inviwo/core/io/datawriter.h>                 // for Overwrite, Overwrite::No, DataWrit...
+#include <inviwo/core/datastructures/volume/volume.h>               // for DataWriterType
+#include <inviwo/core/datastructures/volume/volumecompressedram.h>  // for VolumeCompressedRAM
+#include <inviwo/core/io/datawriter.h>                              // for Overwrite, Overwrite::No
 
+#include <any>          // for any
+#include <cstddef>      // for size_t
 #include <string_view>  // for string_view
 
 namespace inviwo {
 
 /**
  * \ingroup dataio
+ * Writes volumes as ivf files. By default the voxels are written uncompressed to a raw file next
+ * to the header. Supported options:
+ *   * "Compression" (bool): write a version 2 ivf file with compressed bricks instead,
+ *     @see util::writeCompressedIvfVolume
+ *   * "BrickSize" (size_t): the number of voxels along each axis of the compressed bricks
+ *   * "Levels" (size_t): the number of resolution levels to store in a compressed file
  */
 class IVW_MODULE_BASE_API IvfVolumeWriter : public DataWriterType<Volume> {
 public:
@@ -50,11 +59,44 @@ public:
     virtual ~IvfVolumeWriter() = default;
 
     virtual void writeData(const Volume* data, std::string_view filePath) const;
+
+    virtual bool setOption(std::string_view key, std::any value) override;
+    virtual std::any getOption(std::string_view key) const override;
+
+private:
+    bool compression_ = false;
+    size_t brickSize_ = VolumeCompressedRAM::defaultBrickSize;
+    size_t levels_ = 1;
 };
 
 namespace util {
 IVW_MODULE_BASE_API void writeIvfVolume(const Volume& data, std::string_view filePath,
                                         Overwrite overwrite = Overwrite::No);
+
+/**
+ * Write only the ivf header of @p data to @p filePath, referring to the already written
+ * @p rawFile. The raw file has to be placed next to the header and contain the voxels of @p data
+ * in native byte order. Used for volumes that are written in parts, @see VolumeSlabWriter
+ */
+IVW_MODULE_BASE_API void writeIvfVolumeHeader(const Volume& data, std::string_view filePath,
+                                              std::string_view rawFile,
+                                              Overwrite overwrite = Overwrite::No);
+
+/**
+ * Write @p data as a version 2 ivf file. The voxels are split into cubic bricks of @p brickSize
+ * voxels that are compressed independently with util::compressBrick and written to an ivb file
+ * next to the header, together with an index of the bricks, @see CompressedVolumeRAMLoader.
+ * Subregions of the volume can then be read without decompressing the whole volume. If @p data
+ * already has a valid VolumeCompressedRAM with the same brick size, its bricks are written as is.
+ *
+ * With @p levels larger than one, a pyramid of downsampled versions of the volume is appended,
+ * each level having half the dimensions of the previous one, until all dimensions are one.
+ * Read a level with util::readIvfVolumeLevel.
+ */
+IVW_MODULE_BASE_API void writeCompressedIvfVolume(
+    const Volume& data, std::string_view filePath,
+    size_t brickSize = VolumeCompressedRAM::defaultBrickSize, size_t levels = 1,
+    Overwrite overwrite = Overwrite::No);
 }
 
 }  // namespace inviwo
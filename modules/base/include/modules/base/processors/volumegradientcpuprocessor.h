@@ -34,22 +34,23 @@
 #include <inviwo/core/ports/volumeport.h>          // for VolumeInport, VolumeOutport
 #include <inviwo/core/processors/processor.h>      // for Processor
 #include <inviwo/core/processors/processorinfo.h>  // for ProcessorInfo
+#include <inviwo/core/properties/fileproperty.h>   // for FileProperty
 
 namespace inviwo {
 
 /** \docpage{org.inviwo.VolumeGradientCPUProcessor, Volume Gradient CPUProcessor}
  * ![](org.inviwo.VolumeGradientCPUProcessor.png?classIdentifier=org.inviwo.VolumeGradientCPUProcessor)
- * Explanation of how to use the processor.
+ * Computes the gradient of the first channel of the input volume.
  *
  * ### Inports
- *   * __<Inport1>__ <description>.
+ *   * __inport__ Input volume.
  *
  * ### Outports
- *   * __<Outport1>__ <description>.
+ *   * __outport__ The gradient volume.
  *
  * ### Properties
- *   * __<Prop1>__ <description>.
- *   * __<Prop2>__ <description>
+ *   * __Output File__ If set, the gradient is computed in slabs and written to this file instead
+ *     of being kept in memory. Used for volumes that do not fit into memory.
  */
 class IVW_MODULE_BASE_API VolumeGradientCPUProcessor : public Processor {
 public:
@@ -64,6 +65,7 @@ public:
 private:
     VolumeInport inport_;
     VolumeOutport outport_;
+    FileProperty outputFile_;
 };
 
 }  // namespace inviwo
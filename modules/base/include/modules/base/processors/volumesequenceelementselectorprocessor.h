@@ -33,7 +33,9 @@
 
 #include <inviwo/core/datastructures/volume/volume.h>                // for DataInport
 #include <inviwo/core/processors/processorinfo.h>                    // for ProcessorInfo
+#include <inviwo/core/properties/ordinalproperty.h>                  // for SizeTProperty
 #include <inviwo/core/util/glmvec.h>                                 // for uvec3
+#include <inviwo/core/util/volumesequenceprefetcher.h>               // for VolumeSequencePre...
 #include <modules/base/processors/vectorelementselectorprocessor.h>  // for VectorElementSelecto...
 
 #include <string>  // for string
@@ -52,6 +54,9 @@ namespace inviwo {
  *
  * ### Properties
  *   * __Step__ The volume sequence index to extract
+ *   * __Prefetch Steps__ Number of upcoming steps, in the direction of the playback, whose
+ *     data is loaded in the background
+ *   * __Prefetch Budget__ Maximum amount of memory, in MB, to use for the prefetched steps
  */
 class IVW_MODULE_BASE_API VolumeSequenceElementSelectorProcessor
     : public VectorElementSelectorProcessor<Volume> {
@@ -61,6 +66,11 @@ public:
 
     virtual const ProcessorInfo getProcessorInfo() const override;
     static const ProcessorInfo processorInfo_;
+
+private:
+    SizeTProperty prefetchSteps_;
+    SizeTProperty prefetchBudget_;
+    VolumeSequencePrefetcher prefetcher_;
 };
 
 }  // namespace inviwo
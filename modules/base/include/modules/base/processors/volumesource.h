@@ -37,6 +37,7 @@
 #include <inviwo/core/properties/buttonproperty.h>              // for ButtonProperty
 #include <inviwo/core/properties/fileproperty.h>                // for FileProperty
 #include <inviwo/core/properties/optionproperty.h>              // for OptionProperty
+#include <inviwo/core/properties/ordinalproperty.h>             // for SizeTProperty
 #include <inviwo/core/util/fileextension.h>                     // for FileExtension, operator==
 #include <modules/base/properties/basisproperty.h>              // for BasisProperty
 #include <modules/base/properties/sequencetimerproperty.h>      // for SequenceTimerProperty
@@ -76,6 +77,7 @@ private:
     FileProperty file_;
     OptionProperty<FileExtension> reader_;
     ButtonProperty reload_;
+    SizeTProperty level_;
 
     BasisProperty basis_;
     VolumeInformationProperty information_;
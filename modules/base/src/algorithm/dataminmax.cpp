@@ -38,8 +38,10 @@
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
 #include <inviwo/core/util/glmvec.h>                                    // for dvec4
+#include <inviwo/core/util/volumeslabs.h>                               // for forEachVolumeSlab
 #include <modules/base/algorithm/algorithmoptions.h>                    // for IgnoreSpecialValues
 
+#include <limits>         // for numeric_limits
 #include <memory>         // for unique_ptr
 #include <unordered_set>  // for unordered_set
 
@@ -68,6 +70,18 @@ std::pair<dvec4, dvec4> util::bufferMinMax(const BufferRAM* buffer, IgnoreSpecia
 }
 
 std::pair<dvec4, dvec4> util::volumeMinMax(const Volume* volume, IgnoreSpecialValues ignore) {
+    if (util::shouldStreamSlabs(*volume)) {
+        std::pair<dvec4, dvec4> minmax{dvec4{std::numeric_limits<double>::max()},
+                                       dvec4{std::numeric_limits<double>::lowest()}};
+        // Slabs without halo, the whole slab belongs to the volume
+        util::forEachVolumeSlab(
+            *volume, util::slabDepth(*volume), 0, [&](const util::VolumeSlab& slab) {
+                const auto [min, max] = util::volumeMinMax(slab.ram.get(), ignore);
+                minmax.first = glm::min(minmax.first, min);
+                minmax.second = glm::max(minmax.second, max);
+            });
+        return minmax;
+    }
     return util::volumeMinMax(volume->getRepresentation<VolumeRAM>(), ignore);
 }
 
@@ -40,8 +40,8 @@
 #include <inviwo/core/util/glmutils.h>                                  // for Vector
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, dvec2
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
+#include <inviwo/core/util/parallelfor.h>                               // for parallelReduce
 #include <inviwo/core/util/templatesampler.h>                           // for TemplateVolumeSam...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxel
 
 #include <stdlib.h>       // for abs
 #include <algorithm>      // for max, min
@@ -49,6 +49,7 @@
 #include <limits>         // for numeric_limits
 #include <type_traits>    // for conditional_t
 #include <unordered_set>  // for unordered_set
+#include <utility>        // for pair
 
 #include <glm/common.hpp>  // for mix
 #include <glm/mat4x4.hpp>  // for operator*, mat
@@ -87,33 +88,45 @@ std::unique_ptr<Volume> curlVolume(const Volume& volume) {
 
         util::IndexMapper3D index(volume.getDimensions());
         auto data = newVolumeRep->getDataTyped();
-        float minV = std::numeric_limits<float>::max();
-        float maxV = std::numeric_limits<float>::lowest();
 
         const auto worldSpace = Sampler::Space::World;
         const Sampler sampler(volume, worldSpace);
 
-        util::forEachVoxel(*vol, [&](const size3_t& pos) {
-            const vec3 world{m * vec4(vec3(pos) / vec3(volume.getDimensions() - size3_t(1)), 1)};
-
-            const auto Fxp = static_cast<vec3>(sampler.sample(world + ox));
-            const auto Fxm = static_cast<vec3>(sampler.sample(world - ox));
-            const auto Fyp = static_cast<vec3>(sampler.sample(world + oy));
-            const auto Fym = static_cast<vec3>(sampler.sample(world - oy));
-            const auto Fzp = static_cast<vec3>(sampler.sample(world + oz));
-            const auto Fzm = static_cast<vec3>(sampler.sample(world - oz));
-
-            const vec3 Fx = (Fxp - Fxm) / (2.0f * spacing.x);
-            const vec3 Fy = (Fyp - Fym) / (2.0f * spacing.y);
-            const vec3 Fz = (Fzp - Fzm) / (2.0f * spacing.z);
-
-            const vec3 c{Fy.z - Fz.y, Fz.x - Fx.z, Fx.y - Fy.x};
-
-            minV = std::min({minV, c.x, c.y, c.z});
-            maxV = std::max({maxV, c.x, c.y, c.z});
-
-            data[index(pos)] = c;
-        });
+        // Each task tracks its own min and max, which are combined once all voxels are done
+        const auto minMax = util::parallelReduce(
+            vol->getDimensions(),
+            std::pair{std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()},
+            [&](std::pair<float, float>& minMax, const size3_t& pos) {
+                const vec3 world{
+                    m * vec4(vec3(pos) / vec3(volume.getDimensions() - size3_t(1)), 1)};
+
+                const auto Fxp = static_cast<vec3>(sampler.sample(world + ox));
+                const auto Fxm = static_cast<vec3>(sampler.sample(world - ox));
+                const auto Fyp = static_cast<vec3>(sampler.sample(world + oy));
+                const auto Fym = static_cast<vec3>(sampler.sample(world - oy));
+                const auto Fzp = static_cast<vec3>(sampler.sample(world + oz));
+                const auto Fzm = static_cast<vec3>(sampler.sample(world - oz));
+
+                const vec3 Fx = (Fxp - Fxm) / (2.0f * spacing.x);
+                const vec3 Fy = (Fyp - Fym) / (2.0f * spacing.y);
+                const vec3 Fz = (Fzp - Fzm) / (2.0f * spacing.z);
+
+                const vec3 c{Fy.z - Fz.y, Fz.x - Fx.z, Fx.y - Fy.x};
+
+                minMax.first = std::min({minMax.first, c.x, c.y, c.z});
+                minMax.second = std::max({minMax.second, c.x, c.y, c.z});
+
+                data[index(pos)] = c;
+            },
+            [](std::pair<float, float> a, std::pair<float, float> b) {
+                return std::pair{std::min(a.first, b.first), std::max(a.second, b.second)};
+            });
+        if (!minMax) {
+            // The calling task was cancelled
+            newVolume.reset();
+            return;
+        }
+        const auto [minV, maxV] = *minMax;
 
         auto range = std::max(std::abs(minV), std::abs(maxV));
         newVolume->dataMap_.dataRange = dvec2(-range, range);
@@ -36,23 +36,33 @@
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/unitsystem.h>                      // for Axis, Unit
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
+#include <inviwo/core/datastructures/volume/volumebrickedram.h>         // for VolumeBrickedRAM
+#include <inviwo/core/datastructures/volume/volumedisk.h>               // for VolumeDisk
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAMPrecision
+#include <inviwo/core/io/datawriter.h>                                  // for Overwrite
+#include <inviwo/core/io/volumeslabwriter.h>                            // for VolumeSlabWriter
+#include <inviwo/core/util/filesystem.h>                                // for getFileExtension
+#include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
+#include <inviwo/core/util/glmcomp.h>                                   // for glmcomp
 #include <inviwo/core/util/glmutils.h>                                  // for Vector
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, dvec2
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper3D
-#include <inviwo/core/util/spatialsampler.h>                            // for SpatialSampler<>:...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxelParallel
-#include <inviwo/core/util/volumesampler.h>                             // for VolumeDoubleSampler
+#include <inviwo/core/util/parallelfor.h>                               // for parallelReduce
+#include <inviwo/core/util/volumeslabs.h>                               // for forEachVolumeSlab
+#include <modules/base/io/ivfvolumewriter.h>                            // for writeIvfVolumeHeader
 
 #include <array>          // for array
 #include <functional>     // for __base
 #include <limits>         // for numeric_limits
+#include <optional>       // for optional
 #include <string>         // for string
+#include <string_view>    // for string_view
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
 #include <vector>         // for vector
 
 #include <glm/common.hpp>              // for mix, max, abs
+#include <glm/gtc/matrix_inverse.hpp>  // for inverseTranspose
 #include <glm/gtx/component_wise.hpp>  // for compMax
 #include <glm/mat4x4.hpp>              // for operator*, mat
 #include <glm/vec3.hpp>                // for operator-, operator/
@@ -61,54 +71,181 @@
 namespace inviwo {
 namespace util {
 
+namespace {
+
+/*
+ * The inverse transposed basis of the index to world transformation. Maps a gradient with respect
+ * to the voxel indices to a gradient in world space, for sheared and rotated bases alike.
+ */
+dmat3 gradientBasis(const Volume& volume) {
+    const dmat3 indexToWorld{dmat4{volume.getCoordinateTransformer().getIndexToWorldMatrix()}};
+    return glm::inverseTranspose(indexToWorld);
+}
+
+/*
+ * Compute the world space gradient of channel @p channel of @p src for the voxels
+ * [zOffset, zOffset + result depth) into @p result, and return the largest absolute component,
+ * or std::nullopt if the calling task was cancelled.
+ * The gradient with respect to the voxel indices is given by central differences of the
+ * neighboring voxels, one-sided at the borders of @p src.
+ */
+std::optional<float> computeGradients(const VolumeRAM& src, size_t zOffset, const dmat3& basis,
+                                      int channel, const size3_t& resultDims, vec3* result) {
+    return src.dispatch<std::optional<float>>([&](auto vr) {
+        using T = util::PrecisionValueType<decltype(vr)>;
+        const auto data = vr->getDataTyped();
+        const auto srcDims = vr->getDimensions();
+        const util::IndexMapper3D srcIndex(srcDims);
+        const util::IndexMapper3D index(resultDims);
+        const bool hasChannel = static_cast<size_t>(channel) < util::extent<T>::value;
+
+        const auto value = [&](const size3_t& pos) -> double {
+            return static_cast<double>(util::glmcomp(data[srcIndex(pos)], channel));
+        };
+        const auto gradient = [&](const size3_t& pos) {
+            dvec3 g{0.0};
+            if (!hasChannel) return vec3{g};
+            for (int axis = 0; axis < 3; ++axis) {
+                auto lo = pos;
+                auto hi = pos;
+                if (lo[axis] > 0) --lo[axis];
+                if (hi[axis] + 1 < srcDims[axis]) ++hi[axis];
+                if (hi[axis] == lo[axis]) continue;
+                g[axis] = (value(hi) - value(lo)) / static_cast<double>(hi[axis] - lo[axis]);
+            }
+            return vec3{basis * g};
+        };
+
+        // Each task tracks its own max, which are combined once all voxels are done
+        return util::parallelReduce(
+            resultDims, std::numeric_limits<float>::lowest(),
+            [&](float& max, const size3_t& pos) {
+                const auto g = gradient(size3_t{pos.x, pos.y, pos.z + zOffset});
+                result[index(pos)] = g;
+                max = glm::max(max, glm::compMax(glm::abs(g)));
+            },
+            [](float a, float b) { return glm::max(a, b); });
+    });
+}
+
+/*
+ * Same as computeGradients for all voxels of @p src, evaluated brick by brick. The neighbors are
+ * read from the brick's apron, which has to be at least one voxel, and each task writes the
+ * results of whole bricks.
+ */
+std::optional<float> computeBrickedGradients(const VolumeBrickedRAM& src, const dmat3& basis,
+                                             int channel, vec3* result) {
+    return src.dispatch<std::optional<float>>([&](auto vr) {
+        using T = util::PrecisionValueType<decltype(vr)>;
+        const auto dims = vr->getDimensions();
+        const auto brickSize = vr->getBrickSize();
+        const util::IndexMapper3D brickIndex(size3_t{vr->getPaddedBrickSize()});
+        const util::IndexMapper3D index(dims);
+        const bool hasChannel = static_cast<size_t>(channel) < util::extent<T>::value;
+
+        util::ParallelSettings settings;
+        settings.brickSize = size3_t{brickSize};
+        return util::parallelReduceBricks(
+            dims, std::numeric_limits<float>::lowest(),
+            [&](float& max, const size3_t& begin, const size3_t&) {
+                const auto brick = begin / brickSize;
+                const T* data = vr->getBrickDataTyped(brick);
+                const auto value = [&](const size3_t& p) -> double {
+                    return static_cast<double>(util::glmcomp(data[brickIndex(p)], channel));
+                };
+                for (auto it = vr->brickIterator(brick); it != it.end(); ++it) {
+                    // p is the position in the padded brick and pos the one in the volume
+                    const auto p = it.globalPos();
+                    const auto pos = begin + it.blockPos();
+                    dvec3 g{0.0};
+                    for (int axis = 0; hasChannel && axis < 3; ++axis) {
+                        auto lo = p;
+                        auto hi = p;
+                        if (pos[axis] > 0) --lo[axis];
+                        if (pos[axis] + 1 < dims[axis]) ++hi[axis];
+                        if (hi[axis] == lo[axis]) continue;
+                        g[axis] =
+                            (value(hi) - value(lo)) / static_cast<double>(hi[axis] - lo[axis]);
+                    }
+                    const vec3 res{basis * g};
+                    result[index(pos)] = res;
+                    max = glm::max(max, glm::compMax(glm::abs(res)));
+                }
+            },
+            [](float a, float b) { return glm::max(a, b); }, settings);
+    });
+}
+
+}  // namespace
+
 std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume, int channel) {
 
     auto newVolume = std::make_unique<Volume>(*volume, noData);
-    auto newVolumeRep = std::make_shared<VolumeRAMPrecision<vec3>>(volume->getDimensions());
+    auto newVolumeRep = std::make_shared<VolumeRAMPrecision<vec3>>(
+        volume->getDimensions(), RAMAllocation::uninitialized());
     newVolume->addRepresentation(newVolumeRep);
     newVolume->dataMap_.valueAxis.name = "gradient";
     newVolume->dataMap_.valueAxis.unit = volume->dataMap_.valueAxis.unit / volume->axes[0].unit;
 
-    auto m = newVolume->getCoordinateTransformer().getDataToWorldMatrix();
+    // Use the bricked layout if it is already available, it avoids the strided access along z
+    const auto basis = gradientBasis(*volume);
+    const auto max = [&]() {
+        if (volume->hasRepresentation<VolumeBrickedRAM>()) {
+            const auto* bricked = volume->getRepresentation<VolumeBrickedRAM>();
+            if (bricked->getApron() >= 1) {
+                return computeBrickedGradients(*bricked, basis, channel,
+                                               newVolumeRep->getDataTyped());
+            }
+        }
+        return computeGradients(*volume->getRepresentation<VolumeRAM>(), 0, basis, channel,
+                                volume->getDimensions(), newVolumeRep->getDataTyped());
+    }();
+    if (!max) return nullptr;
+
+    newVolume->dataMap_.dataRange = dvec2(-*max, *max);
+    newVolume->dataMap_.valueRange = dvec2(-*max, *max);
 
-    const auto a = m * vec4(0, 0, 0, 1);
-    const auto b = m * vec4(1.0f / vec3(volume->getDimensions() - size3_t(1)), 1);
-    const auto spacing = b - a;
-
-    const vec3 ox(spacing.x, 0, 0);
-    const vec3 oy(0, spacing.y, 0);
-    const vec3 oz(0, 0, spacing.z);
+    return newVolume;
+}
 
-    VolumeDoubleSampler<4> sampler(volume);
-    const auto worldSpace = VolumeDoubleSampler<3>::Space::World;
+std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume, int channel,
+                                       std::string_view outputFile) {
+    const auto dims = volume->getDimensions();
+    const bool ivf = filesystem::getFileExtension(outputFile) == "ivf";
+    const auto rawFile =
+        ivf ? filesystem::replaceFileExtension(outputFile, "raw") : std::string{outputFile};
 
-    util::IndexMapper3D index(volume->getDimensions());
-    auto data = newVolumeRep->getDataTyped();
+    VolumeSlabWriter writer{rawFile, dims, DataVec3Float32::get()};
 
+    const auto basis = gradientBasis(*volume);
     float max = std::numeric_limits<float>::lowest();
-    auto func = [&](const size3_t& pos) {
-        const vec3 world{m * vec4(vec3(pos) / vec3(volume->getDimensions() - size3_t(1)), 1)};
-
-        vec3 g;
-        g.x = static_cast<float>((sampler.sample(world + ox, worldSpace) -
-                                  sampler.sample(world - ox, worldSpace))[channel] /
-                                 (2.0 * spacing.x));
-        g.y = static_cast<float>((sampler.sample(world + oy, worldSpace) -
-                                  sampler.sample(world - oy, worldSpace))[channel] /
-                                 (2.0 * spacing.y));
-        g.z = static_cast<float>((sampler.sample(world + oz, worldSpace) -
-                                  sampler.sample(world - oz, worldSpace))[channel] /
-                                 (2.0 * spacing.z));
-        data[index(pos)] = g;
-
-        max = glm::max(max, glm::compMax(glm::abs(g)));
-    };
-
-    util::forEachVoxelParallel(*volume->getRepresentation<VolumeRAM>(), func);
-
+    bool cancelled = false;
+    util::forEachVolumeSlab(*volume, util::slabDepth(*volume), 1, [&](const VolumeSlab& slab) {
+        if (cancelled) return;
+        const size3_t resultDims{dims.x, dims.y, slab.depth};
+        auto result = std::make_shared<VolumeRAMPrecision<vec3>>(
+            resultDims, RAMAllocation::uninitialized());
+        if (const auto slabMax = computeGradients(*slab.ram, slab.haloBefore, basis, channel,
+                                                  resultDims, result->getDataTyped())) {
+            max = glm::max(max, *slabMax);
+            writer.write(*result, 0, slab.depth);
+        } else {
+            cancelled = true;
+        }
+    });
+    if (cancelled) return nullptr;
+
+    auto newVolume = std::make_shared<Volume>(*volume, noData);
+    newVolume->addRepresentation(writer.finish());
+    newVolume->dataMap_.valueAxis.name = "gradient";
+    newVolume->dataMap_.valueAxis.unit = volume->dataMap_.valueAxis.unit / volume->axes[0].unit;
     newVolume->dataMap_.dataRange = dvec2(-max, max);
     newVolume->dataMap_.valueRange = dvec2(-max, max);
 
+    if (ivf) {
+        util::writeIvfVolumeHeader(*newVolume, outputFile, rawFile, Overwrite::Yes);
+    }
+
     return newVolume;
 }
 
@@ -29,13 +29,16 @@
 
 #include <modules/base/algorithm/volume/volumeramsubsample.h>
 
+#include <inviwo/core/datastructures/volume/volume.h>     // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>  // for VolumeRAM
 #include <inviwo/core/util/formatdispatching.h>           // for PrecisionValueType
 #include <inviwo/core/util/glmutils.h>                    // for same_extent
 #include <inviwo/core/util/glmvec.h>                      // for size3_t
 #include <inviwo/core/util/indexmapper.h>                 // for IndexMapper, IndexMapper3D
+#include <inviwo/core/util/volumeslabs.h>                 // for forEachVolumeSlab
 
-#include <cstddef>  // for size_t
+#include <algorithm>  // for max, min
+#include <cstddef>    // for size_t
 
 #include <glm/vec2.hpp>  // for operator*
 #include <glm/vec3.hpp>  // for operator*, vec<>::(anonymous)
@@ -47,60 +50,102 @@
 
 namespace inviwo {
 
-std::shared_ptr<VolumeRAM> util::volumeSubSample(const VolumeRAM* volume, size3_t f) {
-    return volume->dispatch<std::shared_ptr<VolumeRAM>>(
-        [&f](auto srcVol) -> std::shared_ptr<VolumeRAM> {
-            using ValueType = util::PrecisionValueType<decltype(srcVol)>;
+namespace {
 
-            // use a double type to perform the summation
-            using P = typename util::same_extent<ValueType, double>::type;
+/**
+ * Average blocks of f voxels of src into dst. All of dst is written, src has to contain at least
+ * destDims * f voxels.
+ */
+template <typename ValueType>
+void subSample(const ValueType* src, size3_t srcDims, ValueType* dst, size3_t destDims,
+               size3_t f) {
+    // use a double type to perform the summation
+    using P = typename util::same_extent<ValueType, double>::type;
 
-            // calculate new size
-            const size3_t srcDims{srcVol->getDimensions()};
-            const size3_t destDims{srcDims / f};
-
-            // allocate space
-            auto destVol = std::make_shared<VolumeRAMPrecision<ValueType>>(destDims);
+    util::IndexMapper3D o(srcDims);
+    util::IndexMapper3D n(destDims);
 
-            // get data pointers
-            const auto src = srcVol->getDataTyped();
-            auto dst = destVol->getDataTyped();
-
-            util::IndexMapper3D o(srcDims);
-            util::IndexMapper3D n(destDims);
-
-            const double samplesInv = 1.0 / (f.x * f.y * f.z);
+    const double samplesInv = 1.0 / (f.x * f.y * f.z);
 
 #ifdef IVW_USE_OPENMP
 #pragma omp parallel for
 #endif
-            for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
-                const size_t z = static_cast<size_t>(z_);  // OpenMP need signed integral type.
-                for (size_t y = 0; y < destDims.y; ++y) {
-                    for (size_t x = 0; x < destDims.x; ++x) {
-                        const size_t px{x * f.x};
-                        const size_t py{y * f.y};
-                        const size_t pz{z * f.z};
-                        P val{0.0};
-
-                        for (size_t oz = 0; oz < f.z; ++oz) {
-                            for (size_t oy = 0; oy < f.y; ++oy) {
-                                for (size_t ox = 0; ox < f.x; ++ox) {
-                                    val += src[o(px + ox, py + oy, pz + oz)];
-                                }
-                            }
+    for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
+        const size_t z = static_cast<size_t>(z_);  // OpenMP need signed integral type.
+        for (size_t y = 0; y < destDims.y; ++y) {
+            for (size_t x = 0; x < destDims.x; ++x) {
+                const size_t px{x * f.x};
+                const size_t py{y * f.y};
+                const size_t pz{z * f.z};
+                P val{0.0};
+
+                for (size_t oz = 0; oz < f.z; ++oz) {
+                    for (size_t oy = 0; oy < f.y; ++oy) {
+                        for (size_t ox = 0; ox < f.x; ++ox) {
+                            val += src[o(px + ox, py + oy, pz + oz)];
                         }
+                    }
+                }
 
 #include <warn/push>
 #include <warn/ignore/conversion>
-                        dst[n(x, y, z)] = static_cast<ValueType>(val * samplesInv);
+                dst[n(x, y, z)] = static_cast<ValueType>(val * samplesInv);
 #include <warn/pop>
-                    }
-                }
             }
+        }
+    }
+}
+
+}  // namespace
+
+std::shared_ptr<VolumeRAM> util::volumeSubSample(const VolumeRAM* volume, size3_t f) {
+    return volume->dispatch<std::shared_ptr<VolumeRAM>>(
+        [&f](auto srcVol) -> std::shared_ptr<VolumeRAM> {
+            using ValueType = util::PrecisionValueType<decltype(srcVol)>;
+
+            // calculate new size
+            const size3_t srcDims{srcVol->getDimensions()};
+            const size3_t destDims{srcDims / f};
+
+            // allocate space
+            auto destVol = std::make_shared<VolumeRAMPrecision<ValueType>>(
+                destDims, RAMAllocation::uninitialized());
+
+            subSample(srcVol->getDataTyped(), srcDims, destVol->getDataTyped(), destDims, f);
 
             return destVol;
         });
 }
 
+std::shared_ptr<VolumeRAM> util::volumeSubSample(const Volume& volume, size3_t f) {
+    if (!util::shouldStreamSlabs(volume)) {
+        const auto ram = volume.getRepresentationShared<VolumeRAM>();
+        return volumeSubSample(ram.get(), f);
+    }
+
+    const size3_t srcDims{volume.getDimensions()};
+    const size3_t destDims{srcDims / f};
+    auto destVol =
+        createVolumeRAM(destDims, volume.getDataFormat(), RAMAllocation::uninitialized());
+    if (destDims.z == 0) return destVol;
+
+    // Slabs are a multiple of f.z layers such that no block is split between slabs
+    const auto depth = std::max(size_t{1}, util::slabDepth(volume) / f.z) * f.z;
+    util::forEachVolumeSlab(volume, depth, 0, [&](const util::VolumeSlab& slab) {
+        const auto z = slab.z / f.z;
+        if (z >= destDims.z) return;
+        const size3_t slabDestDims{destDims.x, destDims.y,
+                                   std::min(slab.depth / f.z, destDims.z - z)};
+
+        slab.ram->dispatch<void>([&](auto srcVol) {
+            using ValueType = util::PrecisionValueType<decltype(srcVol)>;
+            auto* dst = static_cast<VolumeRAMPrecision<ValueType>*>(destVol.get())->getDataTyped();
+            subSample(srcVol->getDataTyped(), srcVol->getDimensions(),
+                      dst + z * destDims.x * destDims.y, slabDestDims, f);
+        });
+    });
+
+    return destVol;
+}
+
 }  // namespace inviwo
@@ -36,7 +36,9 @@
 #include <inviwo/core/datastructures/unitsystem.h>                // for Axis, Unit
 #include <inviwo/core/datastructures/volume/volume.h>             // for Volume, DataReaderType
 #include <inviwo/core/datastructures/volume/volumedisk.h>         // for VolumeDisk
+#include <inviwo/core/io/compressedvolumeramloader.h>             // for CompressedVolumeRA...
 #include <inviwo/core/io/datareader.h>                            // for DataReaderType
+#include <inviwo/core/io/datareaderexception.h>                   // for DataReaderException
 #include <inviwo/core/io/rawvolumeramloader.h>                    // for RawVolumeRAMLoader
 #include <inviwo/core/io/serialization/deserializer.h>            // for Deserializer
 #include <inviwo/core/io/serialization/serializationexception.h>  // for SerializationException
@@ -47,12 +49,15 @@
 #include <inviwo/core/util/filesystem.h>                          // for getFileDirectory
 #include <inviwo/core/util/formats.h>                             // for DataFormatBase
 #include <inviwo/core/util/glmvec.h>                              // for size3_t
+#include <inviwo/core/util/sourcecontext.h>                       // for IVW_CONTEXT
 
+#include <algorithm>    // for min
 #include <array>        // for array
 #include <cstddef>      // for size_t
 #include <functional>   // for __base
 #include <string>       // for string, basic_string<>:...
 #include <type_traits>  // for remove_extent_t
+#include <vector>       // for vector
 
 #include <units/units.hpp>  // for unit_from_string
 
@@ -64,6 +69,27 @@ IvfVolumeReader::IvfVolumeReader() : DataReaderType<Volume>() {
 
 IvfVolumeReader* IvfVolumeReader::clone() const { return new IvfVolumeReader(*this); }
 
+bool IvfVolumeReader::setOption(std::string_view key, std::any value) {
+    if (key == "Level") {
+        if (auto* level = std::any_cast<size_t>(&value)) {
+            level_ = *level;
+            return true;
+        }
+    } else if (key == "MemoryMap") {
+        if (auto* memoryMap = std::any_cast<bool>(&value)) {
+            memoryMap_ = *memoryMap;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::any IvfVolumeReader::getOption(std::string_view key) {
+    if (key == "Level") return level_;
+    if (key == "MemoryMap") return memoryMap_;
+    return {};
+}
+
 std::shared_ptr<Volume> IvfVolumeReader::readData(std::string_view filePath) {
     checkExists(filePath);
     const std::string fileDirectory = filesystem::getFileDirectory(filePath);
@@ -77,6 +103,14 @@ std::shared_ptr<Volume> IvfVolumeReader::readData(std::string_view filePath) {
     bool littleEndian = true;
 
     d.registerFactory(util::getMetaDataFactory());
+
+    int version = 1;
+    d.deserialize("Version", version);
+    if (version != 1 && version != 2) {
+        throw DataReaderException(IVW_CONTEXT, "Unsupported ivf version {} in file: {}", version,
+                                  filePath);
+    }
+
     d.deserialize("RawFile", rawFile);
     rawFile = fileDirectory + "/" + rawFile;
     d.deserialize("ByteOffset", byteOffset);
@@ -85,6 +119,22 @@ std::shared_ptr<Volume> IvfVolumeReader::readData(std::string_view filePath) {
     format = DataFormatBase::get(formatFlag);
     d.deserialize("Dimension", dimensions);
 
+    if (version == 2 && level_ > 0) {
+        std::vector<size3_t> levelDimensions;
+        std::vector<size_t> levelOffsets;
+        d.deserialize("LevelDimensions", levelDimensions, "Dimension");
+        d.deserialize("LevelOffsets", levelOffsets, "Offset");
+        if (levelDimensions.size() != levelOffsets.size()) {
+            throw DataReaderException(IVW_CONTEXT, "Invalid resolution levels in file: {}",
+                                      filePath);
+        }
+        if (!levelDimensions.empty()) {
+            const auto level = std::min(level_, levelDimensions.size() - 1);
+            dimensions = levelDimensions[level];
+            byteOffset = levelOffsets[level];
+        }
+    }
+
     SwizzleMask swizzleMask{swizzlemasks::rgba};
     InterpolationType interpolation{InterpolationType::Linear};
     Wrapping3D wrapping{wrapping3d::clampAll};
@@ -139,11 +189,30 @@ std::shared_ptr<Volume> IvfVolumeReader::readData(std::string_view filePath) {
     auto vd = std::make_shared<VolumeDisk>(filePath, dimensions, format, swizzleMask, interpolation,
                                            wrapping);
 
-    auto loader = std::make_unique<RawVolumeRAMLoader>(rawFile, byteOffset, littleEndian);
-    vd->setLoader(loader.release());
+    if (version == 2) {
+        size_t brickSize = 0;
+        std::string compression;
+        d.deserialize("BrickSize", brickSize);
+        d.deserialize("Compression", compression);
+        if (compression != "DeltaLZ" || brickSize == 0) {
+            throw DataReaderException(IVW_CONTEXT, "Unsupported brick compression in file: {}",
+                                      filePath);
+        }
+        vd->setLoader(new CompressedVolumeRAMLoader(rawFile, byteOffset, brickSize));
+    } else {
+        auto loader = std::make_unique<RawVolumeRAMLoader>(rawFile, byteOffset, littleEndian,
+                                                           memoryMap_);
+        vd->setLoader(loader.release());
+    }
 
     volume->addRepresentation(vd);
     return volume;
 }
 
+std::shared_ptr<Volume> util::readIvfVolumeLevel(std::string_view filePath, size_t level) {
+    IvfVolumeReader reader;
+    reader.setOption("Level", level);
+    return reader.readData(filePath);
+}
+
 }  // namespace inviwo
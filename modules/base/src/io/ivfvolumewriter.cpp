@@ -34,7 +34,9 @@
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/unitsystem.h>                      // for Axis
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume, DataWrite...
+#include <inviwo/core/datastructures/volume/volumecompressedram.h>      // for VolumeCompressedRAM
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
+#include <inviwo/core/io/compressedvolumeramloader.h>                   // for writeCompressedBr...
 #include <inviwo/core/io/datawriter.h>                                  // for DataWriterType
 #include <inviwo/core/io/datawriterexception.h>                         // for DataWriterException
 #include <inviwo/core/io/serialization/serializer.h>                    // for Serializer
@@ -43,12 +45,15 @@
 #include <inviwo/core/util/filesystem.h>                                // for getFileNameWithou...
 #include <inviwo/core/util/formats.h>                                   // for DataFormatBase
 #include <inviwo/core/util/sourcecontext.h>                             // for IVW_CONTEXT_CUSTOM
+#include <modules/base/algorithm/volume/volumeramsubsample.h>           // for volumeSubSample
 
 #include <array>          // for array
 #include <fstream>        // for basic_ofstream, ios
 #include <memory>         // for unique_ptr
+#include <optional>       // for optional
 #include <string>         // for basic_string, string
 #include <unordered_set>  // for unordered_set
+#include <vector>         // for vector
 
 #include <glm/gtx/component_wise.hpp>  // for compMul
 #include <units/units.hpp>             // for to_string
@@ -66,21 +71,45 @@ IvfVolumeWriter& IvfVolumeWriter::operator=(const IvfVolumeWriter& that) = defau
 IvfVolumeWriter* IvfVolumeWriter::clone() const { return new IvfVolumeWriter(*this); }
 
 void IvfVolumeWriter::writeData(const Volume* volume, std::string_view filePath) const {
-    util::writeIvfVolume(*volume, filePath, getOverwrite());
+    if (compression_) {
+        util::writeCompressedIvfVolume(*volume, filePath, brickSize_, levels_, getOverwrite());
+    } else {
+        util::writeIvfVolume(*volume, filePath, getOverwrite());
+    }
 }
 
-namespace util {
-void writeIvfVolume(const Volume& data, std::string_view filePath, Overwrite overwrite) {
-    const auto rawPath = filesystem::replaceFileExtension(filePath, "raw");
+bool IvfVolumeWriter::setOption(std::string_view key, std::any value) {
+    if (key == "Compression") {
+        if (auto* compression = std::any_cast<bool>(&value)) {
+            compression_ = *compression;
+            return true;
+        }
+    } else if (key == "BrickSize") {
+        if (auto* brickSize = std::any_cast<size_t>(&value); brickSize && *brickSize > 0) {
+            brickSize_ = *brickSize;
+            return true;
+        }
+    } else if (key == "Levels") {
+        if (auto* levels = std::any_cast<size_t>(&value); levels && *levels > 0) {
+            levels_ = *levels;
+            return true;
+        }
+    }
+    return false;
+}
 
-    DataWriter::checkOverwrite(filePath, overwrite);
-    DataWriter::checkOverwrite(rawPath, overwrite);
+std::any IvfVolumeWriter::getOption(std::string_view key) const {
+    if (key == "Compression") return compression_;
+    if (key == "BrickSize") return brickSize_;
+    if (key == "Levels") return levels_;
+    return {};
+}
 
-    const std::string fileName = filesystem::getFileNameWithoutExtension(filePath);
-    const VolumeRAM* vr = data.getRepresentation<VolumeRAM>();
-    Serializer s(filePath);
-    s.serialize("RawFile", fileName + ".raw");
-    s.serialize("Format", vr->getDataFormatString());
+namespace {
+
+void serializeHeader(Serializer& s, const Volume& data, std::string_view rawFile) {
+    s.serialize("RawFile", filesystem::getFileNameWithExtension(rawFile));
+    s.serialize("Format", data.getDataFormat()->getString());
     s.serialize("ByteOffset", 0u);
     s.serialize("BasisAndOffset", data.getModelMatrix());
     s.serialize("WorldTransform", data.getWorldMatrix());
@@ -99,13 +128,24 @@ void writeIvfVolume(const Volume& data, std::string_view filePath, Overwrite ove
     s.serialize("Axis3Name", data.axes[2].name);
     s.serialize("Axis3Unit", units::to_string(data.axes[2].unit));
 
-    s.serialize("SwizzleMask", vr->getSwizzleMask());
-    s.serialize("Interpolation", vr->getInterpolation());
-    s.serialize("Wrapping", vr->getWrapping());
+    s.serialize("SwizzleMask", data.getSwizzleMask());
+    s.serialize("Interpolation", data.getInterpolation());
+    s.serialize("Wrapping", data.getWrapping());
 
     data.getMetaDataMap()->serialize(s);
-    s.writeFile();
+}
+
+}  // namespace
+
+namespace util {
+
+void writeIvfVolume(const Volume& data, std::string_view filePath, Overwrite overwrite) {
+    const auto rawPath = filesystem::replaceFileExtension(filePath, "raw");
+
+    DataWriter::checkOverwrite(rawPath, overwrite);
+    writeIvfVolumeHeader(data, filePath, rawPath, overwrite);
 
+    const VolumeRAM* vr = data.getRepresentation<VolumeRAM>();
     if (auto fout = filesystem::ofstream(rawPath, std::ios::out | std::ios::binary)) {
         fout.write(static_cast<const char*>(vr->getData()),
                    glm::compMul(vr->getDimensions()) * vr->getDataFormat()->getSize());
@@ -114,6 +154,63 @@ void writeIvfVolume(const Volume& data, std::string_view filePath, Overwrite ove
                                   IVW_CONTEXT_CUSTOM("util::writeIvfVolume"));
     }
 }
+
+void writeIvfVolumeHeader(const Volume& data, std::string_view filePath,
+                          std::string_view rawFile, Overwrite overwrite) {
+    DataWriter::checkOverwrite(filePath, overwrite);
+
+    Serializer s(filePath);
+    serializeHeader(s, data, rawFile);
+    s.writeFile();
+}
+
+void writeCompressedIvfVolume(const Volume& data, std::string_view filePath, size_t brickSize,
+                              size_t levels, Overwrite overwrite) {
+    const auto brickPath = filesystem::replaceFileExtension(filePath, "ivb");
+
+    DataWriter::checkOverwrite(filePath, overwrite);
+    DataWriter::checkOverwrite(brickPath, overwrite);
+
+    std::optional<VolumeCompressedRAM> rebricked;
+    const VolumeCompressedRAM* compressed = nullptr;
+    if (data.hasValidRepresentation<VolumeCompressedRAM>()) {
+        compressed = data.getRepresentation<VolumeCompressedRAM>();
+    }
+    if (!compressed || compressed->getBrickSize() != brickSize) {
+        compressed = &rebricked.emplace(*data.getRepresentation<VolumeRAM>(), brickSize);
+    }
+
+    std::vector<size3_t> levelDimensions{data.getDimensions()};
+    std::vector<size_t> levelOffsets{0};
+    if (auto fout = filesystem::ofstream(brickPath, std::ios::out | std::ios::binary)) {
+        writeCompressedBricks(*compressed, fout);
+
+        // Each level is downsampled from the previous one, only the first one reads the volume
+        std::shared_ptr<VolumeRAM> level;
+        while (levelDimensions.size() < levels && levelDimensions.back() != size3_t{1}) {
+            const auto factors = glm::clamp(levelDimensions.back(), size3_t{1}, size3_t{2});
+            level = level ? volumeSubSample(level.get(), factors) : volumeSubSample(data, factors);
+            levelDimensions.push_back(level->getDimensions());
+            levelOffsets.push_back(static_cast<size_t>(fout.tellp()));
+            writeCompressedBricks(VolumeCompressedRAM{*level, brickSize}, fout);
+        }
+    } else {
+        throw DataWriterException("Could not write to brick file: " + brickPath,
+                                  IVW_CONTEXT_CUSTOM("util::writeCompressedIvfVolume"));
+    }
+
+    Serializer s(filePath);
+    s.serialize("Version", 2);
+    serializeHeader(s, data, brickPath);
+    s.serialize("Compression", std::string{"DeltaLZ"});
+    s.serialize("BrickSize", brickSize);
+    if (levelDimensions.size() > 1) {
+        s.serialize("LevelDimensions", levelDimensions, "Dimension");
+        s.serialize("LevelOffsets", levelOffsets, "Offset");
+    }
+    s.writeFile();
+}
+
 }  // namespace util
 
 }  // namespace inviwo
@@ -170,8 +170,10 @@ void MeshClipping::process() {
             }
             previousPointPlaneMove_ = pointPlaneMove_.get();
         }
-        if (auto clippedPlaneGeom =
-                meshutil::clipMeshAgainstPlane(*inport_.getData(), *plane, capClippedHoles_)) {
+        if (!outport_.isConsumed()) {
+            // Only the clipping plane is used, skip the clipping and keep the last mesh
+        } else if (auto clippedPlaneGeom = meshutil::clipMeshAgainstPlane(
+                       *inport_.getData(), *plane, capClippedHoles_)) {
             clippedPlaneGeom->setModelMatrix(inport_.getData()->getModelMatrix());
             clippedPlaneGeom->setWorldMatrix(inport_.getData()->getWorldMatrix());
             outport_.setData(clippedPlaneGeom);
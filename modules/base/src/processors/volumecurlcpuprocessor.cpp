@@ -49,6 +49,9 @@ const ProcessorInfo VolumeCurlCPUProcessor::processorInfo_{
     "Volume Operation",                   // Category
     CodeState::Stable,                    // Code state
     Tags::CPU,                            // Tags
+    Document{},                           // Help
+    true,                                 // Visible
+    ProcessingThread::Any,                // Processing thread
 };
 const ProcessorInfo VolumeCurlCPUProcessor::getProcessorInfo() const { return processorInfo_; }
 
@@ -49,6 +49,9 @@ const ProcessorInfo VolumeDivergenceCPUProcessor::processorInfo_{
     "Volume Operation",                         // Category
     CodeState::Stable,                          // Code state
     Tags::CPU,                                  // Tags
+    Document{},                                 // Help
+    true,                                       // Visible
+    ProcessingThread::Any,                      // Processing thread
 };
 const ProcessorInfo VolumeDivergenceCPUProcessor::getProcessorInfo() const {
     return processorInfo_;
@@ -29,11 +29,15 @@
 
 #include <modules/base/processors/volumegradientcpuprocessor.h>
 
+#include <inviwo/core/algorithm/markdown.h>                // for operator""_help
 #include <inviwo/core/ports/volumeport.h>                  // for VolumeInport, VolumeOutport
 #include <inviwo/core/processors/processor.h>              // for Processor
 #include <inviwo/core/processors/processorinfo.h>          // for ProcessorInfo
 #include <inviwo/core/processors/processorstate.h>         // for CodeState, CodeState::Experime...
 #include <inviwo/core/processors/processortags.h>          // for Tags, Tags::CPU
+#include <inviwo/core/properties/fileproperty.h>           // for FileProperty
+#include <inviwo/core/util/filedialogstate.h>              // for AcceptMode
+#include <inviwo/core/util/fileextension.h>                // for FileExtension
 #include <modules/base/algorithm/volume/volumegradient.h>  // for gradientVolume
 
 #include <string>       // for string
@@ -48,18 +52,35 @@ const ProcessorInfo VolumeGradientCPUProcessor::processorInfo_{
     "Volume Operation",                       // Category
     CodeState::Experimental,                  // Code state
     Tags::CPU,                                // Tags
+    Document{},                               // Help
+    true,                                     // Visible
+    ProcessingThread::Any,                    // Processing thread
 };
 const ProcessorInfo VolumeGradientCPUProcessor::getProcessorInfo() const { return processorInfo_; }
 
 VolumeGradientCPUProcessor::VolumeGradientCPUProcessor()
-    : Processor(), inport_("inport"), outport_("outport") {
+    : Processor()
+    , inport_("inport")
+    , outport_("outport")
+    , outputFile_("outputFile", "Output File",
+                  "If set, the gradient is computed in slabs and written to this file (.ivf or "
+                  ".raw) instead of being kept in memory"_help,
+                  "", "volume") {
 
     addPort(inport_);
     addPort(outport_);
+    outputFile_.setAcceptMode(AcceptMode::Save);
+    outputFile_.addNameFilter(FileExtension("ivf", "Inviwo ivf file format"));
+    outputFile_.addNameFilter(FileExtension("raw", "Raw binary file"));
+    addProperty(outputFile_);
 }
 
 void VolumeGradientCPUProcessor::process() {
-    outport_.setData(util::gradientVolume(inport_.getData(), 0));
+    if (outputFile_.get().empty()) {
+        outport_.setData(util::gradientVolume(inport_.getData(), 0));
+    } else {
+        outport_.setData(util::gradientVolume(inport_.getData(), 0, outputFile_.get()));
+    }
 }
 
 }  // namespace inviwo
@@ -53,9 +53,32 @@ const ProcessorInfo VolumeSequenceElementSelectorProcessor::getProcessorInfo() c
     return processorInfo_;
 }
 VolumeSequenceElementSelectorProcessor::VolumeSequenceElementSelectorProcessor()
-    : VectorElementSelectorProcessor<Volume>() {
+    : VectorElementSelectorProcessor<Volume>()
+    , prefetchSteps_("prefetchSteps", "Prefetch Steps",
+                     "Number of upcoming steps, in the direction of the playback, whose data is "
+                     "loaded in the background. Zero disables prefetching"_help,
+                     4, {0, ConstraintBehavior::Immutable}, {16, ConstraintBehavior::Ignore})
+    , prefetchBudget_("prefetchBudget", "Prefetch Budget (MB)",
+                      "Maximum amount of memory to use for the prefetched steps. Zero means no "
+                      "limit"_help,
+                      1024, {0, ConstraintBehavior::Immutable}, {16384, ConstraintBehavior::Ignore})
+    , prefetcher_(prefetchSteps_.get(), prefetchBudget_.get() * 1024 * 1024) {
     timeStep_.index_.autoLinkToProperty<VolumeSequenceElementSelectorProcessor>(
         "timeStep.selectedSequenceIndex");
+
+    addProperties(prefetchSteps_, prefetchBudget_);
+
+    prefetchSteps_.onChange([this]() { prefetcher_.setAhead(prefetchSteps_.get()); });
+    prefetchBudget_.onChange(
+        [this]() { prefetcher_.setBudget(prefetchBudget_.get() * 1024 * 1024); });
+
+    // The animation module drives the same index, so sequences animated there are prefetched too
+    inport_.onChange([this]() {
+        prefetcher_.setSequence(inport_.getData());
+        prefetcher_.update(static_cast<size_t>(timeStep_.index_.get() - 1));
+    });
+    timeStep_.index_.onChange(
+        [this]() { prefetcher_.update(static_cast<size_t>(timeStep_.index_.get() - 1)); });
 }
 
 }  // namespace inviwo
@@ -65,6 +65,9 @@ const ProcessorInfo VolumeShifter::processorInfo_{
     "Volume Operation",          // Category
     CodeState::Experimental,     // Code state
     Tags::CPU,                   // Tags
+    Document{},                  // Help
+    true,                        // Visible
+    ProcessingThread::Any,       // Processing thread
 };
 const ProcessorInfo VolumeShifter::getProcessorInfo() const { return processorInfo_; }
 
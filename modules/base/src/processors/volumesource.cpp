@@ -44,7 +44,7 @@
 #include <inviwo/core/properties/buttonproperty.h>              // for ButtonProperty
 #include <inviwo/core/properties/fileproperty.h>                // for FileProperty
 #include <inviwo/core/properties/optionproperty.h>              // for OptionProperty
-#include <inviwo/core/properties/ordinalproperty.h>             // for IntSizeTProperty
+#include <inviwo/core/properties/ordinalproperty.h>             // for SizeTProperty
 #include <inviwo/core/properties/property.h>                    // for OverwriteState, Overwrite...
 #include <inviwo/core/resourcemanager/resourcemanager.h>        // for ResourceManager
 #include <inviwo/core/util/fileextension.h>                     // for FileExtension, operator==
@@ -90,12 +90,17 @@ VolumeSource::VolumeSource(InviwoApplication* app, std::string_view filePath)
     , reader_("reader", "Data Reader", "The selected reader used for loading the Volume"_help)
     , reload_("reload", "Reload data",
               "Reload the date from disk, will not use the resource manager"_help)
+    , level_("level", "Resolution Level",
+             "The resolution level to load from files that store several, like compressed ivf "
+             "files. 0 is the full resolution, larger levels than available load the coarsest "
+             "one. Ignored by other readers"_help,
+             0, {0, ConstraintBehavior::Immutable}, {8, ConstraintBehavior::Ignore})
     , basis_("Basis", "Basis and offset")
     , information_("Information", "Data information")
     , volumeSequence_("Sequence", "Sequence") {
 
     addPort(outport_);
-    addProperties(file_, reader_, reload_, information_, basis_, volumeSequence_);
+    addProperties(file_, reader_, reload_, level_, information_, basis_, volumeSequence_);
     volumeSequence_.setVisible(false);
 
     util::updateFilenameFilters<Volume, VolumeSequence>(*util::getDataReaderFactory(app), file_,
@@ -128,26 +133,31 @@ void VolumeSource::load(bool deserialize) {
     auto rm = util::getResourceManager(app_);
 
     const auto sext = reader_.getSelectedValue();
+    // Different levels of the same file are different resources
+    const auto resource =
+        level_.get() == 0 ? file_.get() : fmt::format("{}?level={}", file_.get(), level_.get());
 
     // use resource unless the "Reload data"-button (reload_) was pressed,
     // Note: reload_ will be marked as modified when deserializing.
     bool checkResource = deserialized_ || !reload_.isModified();
-    if (checkResource && rm->hasResource<VolumeSequence>(file_.get())) {
-        volumes_ = rm->getResource<VolumeSequence>(file_.get());
+    if (checkResource && rm->hasResource<VolumeSequence>(resource)) {
+        volumes_ = rm->getResource<VolumeSequence>(resource);
     } else {
         try {
             if (auto volVecReader =
                     rf->getReaderForTypeAndExtension<VolumeSequence>(sext, file_.get())) {
+                volVecReader->setOption("Level", level_.get());
                 auto volumes = volVecReader->readData(file_.get(), this);
                 std::swap(volumes, volumes_);
-                rm->addResource(file_.get(), volumes_, reload_.isModified());
+                rm->addResource(resource, volumes_, reload_.isModified());
             } else if (auto volreader =
                            rf->getReaderForTypeAndExtension<Volume>(sext, file_.get())) {
+                volreader->setOption("Level", level_.get());
                 auto volume = volreader->readData(file_.get(), this);
                 auto volumes = std::make_shared<VolumeSequence>();
                 volumes->push_back(volume);
                 std::swap(volumes, volumes_);
-                rm->addResource(file_.get(), volumes_, reload_.isModified());
+                rm->addResource(resource, volumes_, reload_.isModified());
             } else {
                 LogProcessorError("Could not find a data reader for file: " << file_.get());
                 volumes_.reset();
@@ -179,7 +189,8 @@ void VolumeSource::load(bool deserialize) {
 }
 
 void VolumeSource::process() {
-    if (file_.isModified() || reload_.isModified() || reader_.isModified()) {
+    if (file_.isModified() || reload_.isModified() || reader_.isModified() ||
+        level_.isModified()) {
         load(deserialized_);
         deserialized_ = false;
     }
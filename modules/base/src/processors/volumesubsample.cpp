@@ -76,6 +76,10 @@ VolumeSubsample::VolumeSubsample()
 
     addProperty(enabled_);
     addProperty(subSampleFactors_);
+
+    // The result only depends on the input volume and the properties, keep a few results around
+    // to make toggling between factors cheap.
+    setMemoizationCapacity(4);
 }
 
 void VolumeSubsample::process() {
@@ -98,8 +102,7 @@ void VolumeSubsample::process() {
 
 std::shared_ptr<Volume> VolumeSubsample::subsample(std::shared_ptr<const Volume> volume,
                                                    size3_t f) {
-    auto vol = volume->getRepresentation<VolumeRAM>();
-    auto sample = std::make_shared<Volume>(util::volumeSubSample(vol, f));
+    auto sample = std::make_shared<Volume>(util::volumeSubSample(*volume, f));
     sample->copyMetaDataFrom(*volume);
     sample->dataMap_ = volume->dataMap_;
     sample->setModelMatrix(volume->getModelMatrix());
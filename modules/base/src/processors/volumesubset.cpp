@@ -33,6 +33,7 @@
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
+#include <inviwo/core/datastructures/volume/volumedisk.h>               // for VolumeDisk
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
 #include <inviwo/core/network/networklock.h>                            // for NetworkLock
 #include <inviwo/core/ports/volumeport.h>                               // for VolumeInport, Vol...
@@ -45,6 +46,7 @@
 #include <inviwo/core/properties/valuewrapper.h>                        // for PropertySerializa...
 #include <inviwo/core/util/glmmat.h>                                    // for mat3
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t
+#include <inviwo/core/util/volumeslabs.h>                               // for canStreamSlabs
 #include <modules/base/algorithm/volume/volumeramsubset.h>              // for VolumeRAMSubSet
 
 #include <functional>     // for __base
@@ -115,15 +117,22 @@ VolumeSubset::~VolumeSubset() = default;
 
 void VolumeSubset::process() {
     if (enabled_.get()) {
-        const auto vol = inport_.getData()->getRepresentation<VolumeRAM>();
+        const auto& input = *inport_.getData();
         const size3_t offset{rangeX_.get().x, rangeY_.get().x, rangeZ_.get().x};
         const size3_t dim = size3_t{rangeX_.get().y, rangeY_.get().y, rangeZ_.get().y} - offset;
 
         if (dim == dims_)
             outport_.setData(inport_.getData());
         else {
-            auto volume = std::make_shared<Volume>(*inport_.getData(), NoData{});
-            volume->addRepresentation(VolumeRAMSubSet::apply(vol, dim, offset));
+            auto volume = std::make_shared<Volume>(input, NoData{});
+            if (!input.hasValidRepresentation<VolumeRAM>() && util::canStreamSlabs(input)) {
+                // Only read the subset from disk instead of loading the whole volume
+                volume->addRepresentation(
+                    input.getRepresentation<VolumeDisk>()->readRegion(offset, dim));
+            } else {
+                volume->addRepresentation(
+                    VolumeRAMSubSet::apply(input.getRepresentation<VolumeRAM>(), dim, offset));
+            }
 
             if (adjustBasisAndOffset_.get()) {
                 vec3 volOffset = inport_.getData()->getOffset();
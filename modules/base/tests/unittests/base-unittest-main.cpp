@@ -31,10 +31,11 @@
 #pragma comment(linker, "/SUBSYSTEM:CONSOLE")
 #endif
 
-#include <inviwo/testutil/configurablegtesteventlistener.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/common/coremodulesharedlibrary.h>
 
-#include <inviwo/core/datastructures/representationutil.h>
-#include <inviwo/core/datastructures/representationfactorymanager.h>
+#include <inviwo/testutil/configurablegtesteventlistener.h>
 
 #include <warn/push>
 #include <warn/ignore/all>
@@ -44,8 +45,16 @@
 using namespace inviwo;
 
 int main(int argc, char** argv) {
-    RepresentationFactoryManager rfm;
-    util::registerCoreRepresentations(rfm);
+
+    inviwo::LogCentral::init();
+
+    // The readers and writers need the factories of the core, i.e. for the MetaData
+    InviwoApplication app(argc, argv, "Inviwo-Unittests-Base");
+    {
+        std::vector<std::unique_ptr<InviwoModuleFactoryObject>> modules;
+        modules.emplace_back(createInviwoCore());
+        app.registerModules(std::move(modules));
+    }
 
     int ret = -1;
     {
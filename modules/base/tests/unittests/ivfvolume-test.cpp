@@ -0,0 +1,113 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/volume/volumeramsubsample.h>
+#include <modules/base/io/ivfvolumereader.h>
+#include <modules/base/io/ivfvolumewriter.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/raiiutils.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+void expectEqual(const VolumeRAM& result, const VolumeRAM& expected) {
+    ASSERT_EQ(result.getDimensions(), expected.getDimensions());
+    const auto dims = expected.getDimensions();
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const size3_t pos{x, y, z};
+                ASSERT_EQ(result.getAsDouble(pos), expected.getAsDouble(pos))
+                    << "at (" << x << ", " << y << ", " << z << ")";
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(IvfVolume, CompressedLevels) {
+    const size3_t dims{20, 12, 9};
+    auto ram = std::make_shared<VolumeRAMPrecision<std::uint16_t>>(dims);
+    auto* data = ram->getDataTyped();
+    for (size_t i = 0; i < dims.x * dims.y * dims.z; ++i) {
+        data[i] = static_cast<std::uint16_t>((i * 7919) % 1000);
+    }
+    const Volume volume{ram};
+
+    const auto file =
+        (std::filesystem::temp_directory_path() / "inviwo-ivfvolume-test.ivf").string();
+    const auto brickFile = filesystem::replaceFileExtension(file, "ivb");
+    util::OnScopeExit cleanup{[&]() {
+        std::filesystem::remove(file);
+        std::filesystem::remove(brickFile);
+    }};
+    util::writeCompressedIvfVolume(volume, file, 8, 3, Overwrite::Yes);
+
+    // Each level halves the previous one
+    std::vector<std::shared_ptr<const VolumeRAM>> expected{ram};
+    for (size_t level = 1; level < 3; ++level) {
+        const auto& prev = *expected.back();
+        const auto factors = glm::clamp(prev.getDimensions(), size3_t{1}, size3_t{2});
+        expected.push_back(util::volumeSubSample(&prev, factors));
+    }
+    EXPECT_EQ(expected[1]->getDimensions(), size3_t(10, 6, 4));
+    EXPECT_EQ(expected[2]->getDimensions(), size3_t(5, 3, 2));
+
+    for (size_t level = 0; level < 3; ++level) {
+        SCOPED_TRACE(level);
+        const auto result = util::readIvfVolumeLevel(file, level);
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->getDimensions(), expected[level]->getDimensions());
+        // All levels cover the same space
+        EXPECT_EQ(result->getModelMatrix(), volume.getModelMatrix());
+        expectEqual(*result->getRepresentation<VolumeRAM>(), *expected[level]);
+    }
+
+    // Levels beyond the coarsest one read the coarsest one
+    const auto clamped = util::readIvfVolumeLevel(file, 10);
+    expectEqual(*clamped->getRepresentation<VolumeRAM>(), *expected[2]);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,199 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/processors/volumecurlcpuprocessor.h>
+#include <modules/base/processors/volumedivergencecpuprocessor.h>
+#include <modules/base/processors/volumegradientcpuprocessor.h>
+#include <modules/base/processors/volumeshifter.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/ports/volumeport.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/ordinalproperty.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/utilities.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+struct VolumeTestSource : Processor {
+    VolumeTestSource() : Processor("source", "source"), outport{"outport"} { addPort(outport); }
+    virtual const ProcessorInfo getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override { outport.setData(volume); }
+
+    VolumeOutport outport;
+    std::shared_ptr<Volume> volume;
+};
+
+const ProcessorInfo VolumeTestSource::processorInfo_{
+    "org.inviwo.VolumeTestSource",  // Class identifier
+    "Volume Test Source",           // Display name
+    "Testing",                      // Category
+    CodeState::Stable,              // Code state
+    Tags::CPU,                      // Tags
+};
+
+struct VolumeTestSink : Processor {
+    VolumeTestSink(const std::string& id) : Processor(id, id), inport{"inport"} {
+        addPort(inport);
+    }
+    virtual const ProcessorInfo getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override { volume = inport.getData(); }
+
+    VolumeInport inport;
+    std::shared_ptr<const Volume> volume;
+};
+
+const ProcessorInfo VolumeTestSink::processorInfo_{
+    "org.inviwo.VolumeTestSink",  // Class identifier
+    "Volume Test Sink",           // Display name
+    "Testing",                    // Category
+    CodeState::Stable,            // Code state
+    Tags::CPU,                    // Tags
+};
+
+// A rotating field with a varying z component, F = (-y, x, z^2)
+std::shared_ptr<Volume> makeField() {
+    const size3_t dims{24, 20, 16};
+    auto ram = std::make_shared<VolumeRAMPrecision<vec3>>(dims);
+    const util::IndexMapper3D im{dims};
+    auto* data = ram->getDataTyped();
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const auto p = vec3{size3_t{x, y, z}} / vec3{dims - size3_t{1}} - 0.5f;
+                data[im(x, y, z)] = vec3{-p.y, p.x, p.z * p.z};
+            }
+        }
+    }
+    return std::make_shared<Volume>(ram);
+}
+
+bool equal(const Volume& a, const Volume& b) {
+    if (a.getDimensions() != b.getDimensions() || a.getDataFormat() != b.getDataFormat() ||
+        a.dataMap_.dataRange != b.dataMap_.dataRange ||
+        a.dataMap_.valueRange != b.dataMap_.valueRange) {
+        return false;
+    }
+    const auto* ramA = a.getRepresentation<VolumeRAM>();
+    const auto* ramB = b.getRepresentation<VolumeRAM>();
+    const auto bytes = glm::compMul(a.getDimensions()) * a.getDataFormat()->getSize();
+    return std::memcmp(ramA->getData(), ramB->getData(), bytes) == 0;
+}
+
+}  // namespace
+
+TEST(ParallelEvaluation, VolumeOperations) {
+    ASSERT_GT(util::getPoolSize(), size_t{0});
+
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    auto sourcePtr = std::make_unique<VolumeTestSource>();
+    auto* source = sourcePtr.get();
+    source->volume = makeField();
+
+    std::vector<std::unique_ptr<Processor>> operations;
+    operations.push_back(std::make_unique<VolumeCurlCPUProcessor>());
+    operations.push_back(std::make_unique<VolumeDivergenceCPUProcessor>());
+    operations.push_back(std::make_unique<VolumeGradientCPUProcessor>());
+    operations.push_back(std::make_unique<VolumeShifter>());
+    auto* offset =
+        dynamic_cast<FloatVec3Property*>(operations.back()->getPropertyByIdentifier("offset"));
+    ASSERT_NE(offset, nullptr);
+    offset->set(vec3{0.25f, -0.5f, 0.0f});
+
+    std::vector<VolumeTestSink*> sinks;
+    {
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(sourcePtr));
+        for (auto& operation : operations) {
+            // Only the volume operations that are safe to process concurrently opt in
+            EXPECT_EQ(operation->getProcessorInfo().processingThread, ProcessingThread::Any);
+
+            const auto id = operation->getProcessorInfo().displayName;
+            operation->setIdentifier(util::stripIdentifier(id));
+            auto sink = std::make_unique<VolumeTestSink>(util::stripIdentifier(id) + "Sink");
+            sinks.push_back(sink.get());
+
+            auto* op = network.addProcessor(std::move(operation));
+            network.addProcessor(std::move(sink));
+            network.addConnection(source->getOutports()[0], op->getInports()[0]);
+            network.addConnection(op->getOutports()[0], sinks.back()->getInports()[0]);
+        }
+    }
+
+    std::vector<std::shared_ptr<const Volume>> serial;
+    for (auto* sink : sinks) {
+        ASSERT_NE(sink->volume, nullptr) << sink->getIdentifier();
+        serial.push_back(sink->volume);
+    }
+
+    // All the operations are processed concurrently in the thread pool, on a new input
+    evaluator.setEvaluationMode(EvaluationMode::Parallel);
+    for (int i = 0; i < 3; ++i) {
+        source->volume = std::shared_ptr<Volume>(source->volume->clone());
+        source->invalidate(InvalidationLevel::InvalidOutput);
+
+        for (size_t j = 0; j < sinks.size(); ++j) {
+            SCOPED_TRACE(sinks[j]->getIdentifier());
+            ASSERT_NE(sinks[j]->volume, nullptr);
+            EXPECT_NE(sinks[j]->volume, serial[j]);
+            EXPECT_TRUE(equal(*sinks[j]->volume, *serial[j]));
+            EXPECT_TRUE(sinks[j]->isValid());
+        }
+    }
+}
+
+}  // namespace inviwo
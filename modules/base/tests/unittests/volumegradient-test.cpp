@@ -0,0 +1,190 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/volume/volumegradient.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumebrickedram.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/raiiutils.h>
+
+#include <filesystem>
+#include <memory>
+
+namespace inviwo {
+
+namespace {
+
+// Serves the voxels of a VolumeRAM from a VolumeDisk, such that the volume can be streamed
+class RegionLoader : public DiskRepresentationLoader<VolumeRepresentation>,
+                     public VolumeRegionLoader {
+public:
+    RegionLoader(std::shared_ptr<const VolumeRAMPrecision<float>> ram) : ram_{std::move(ram)} {}
+    virtual RegionLoader* clone() const override { return new RegionLoader(*this); }
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation&) const override {
+        return std::shared_ptr<VolumeRAM>(ram_->clone());
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation>,
+                                      const VolumeRepresentation&) const override {}
+    virtual std::shared_ptr<VolumeRAM> readRegion(const VolumeRepresentation&, size3_t offset,
+                                                  size3_t extent) const override {
+        auto region = std::make_shared<VolumeRAMPrecision<float>>(extent);
+        const util::IndexMapper3D src{ram_->getDimensions()};
+        const util::IndexMapper3D dst{extent};
+        for (size_t z = 0; z < extent.z; ++z) {
+            for (size_t y = 0; y < extent.y; ++y) {
+                for (size_t x = 0; x < extent.x; ++x) {
+                    region->getDataTyped()[dst(x, y, z)] =
+                        ram_->getDataTyped()[src(size3_t{x, y, z} + offset)];
+                }
+            }
+        }
+        return region;
+    }
+
+private:
+    std::shared_ptr<const VolumeRAMPrecision<float>> ram_;
+};
+
+constexpr vec3 slope{1.0f, 2.0f, -3.0f};
+
+// A sheared and rotated volume with values that increase linearly with the world position
+std::shared_ptr<Volume> makeVolume(bool onDisk) {
+    const size3_t dims{12, 10, 9};
+    const mat3 basis{vec3{2.0f, 0.5f, 0.0f}, vec3{-0.5f, 1.5f, 0.25f}, vec3{0.3f, 0.0f, 1.0f}};
+
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    auto volume = std::make_shared<Volume>(ram);
+    volume->setBasis(basis);
+    volume->setOffset(vec3{-1.0f, 0.5f, 2.0f});
+
+    const auto indexToWorld = volume->getCoordinateTransformer().getIndexToWorldMatrix();
+    const util::IndexMapper3D im{dims};
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const vec3 world{indexToWorld * vec4{vec3{size3_t{x, y, z}}, 1.0f}};
+                ram->getDataTyped()[im(x, y, z)] = glm::dot(slope, world);
+            }
+        }
+    }
+    if (!onDisk) return volume;
+
+    auto disk = std::make_shared<VolumeDisk>(dims, DataFloat32::get());
+    disk->setLoader(new RegionLoader(ram));
+    auto streamed = std::make_shared<Volume>(disk);
+    streamed->setModelMatrix(volume->getModelMatrix());
+    streamed->setWorldMatrix(volume->getWorldMatrix());
+    return streamed;
+}
+
+}  // namespace
+
+TEST(VolumeGradient, LinearFieldInShearedVolume) {
+    const auto gradient = util::gradientVolume(makeVolume(false), 0);
+    const auto* ram = gradient->getRepresentation<VolumeRAM>();
+    const auto dims = gradient->getDimensions();
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const auto g = ram->getAsDVec3(size3_t{x, y, z});
+                ASSERT_NEAR(g.x, slope.x, 1e-3) << "at (" << x << ", " << y << ", " << z << ")";
+                ASSERT_NEAR(g.y, slope.y, 1e-3) << "at (" << x << ", " << y << ", " << z << ")";
+                ASSERT_NEAR(g.z, slope.z, 1e-3) << "at (" << x << ", " << y << ", " << z << ")";
+            }
+        }
+    }
+    EXPECT_NEAR(gradient->dataMap_.dataRange.y, 3.0, 1e-3);
+}
+
+TEST(VolumeGradient, StreamedMatchesInMemory) {
+    const auto file =
+        (std::filesystem::temp_directory_path() / "inviwo-volumegradient-test.raw").string();
+    util::OnScopeExit cleanup{[&]() { std::filesystem::remove(file); }};
+
+    const auto inMemory = util::gradientVolume(makeVolume(false), 0);
+    const auto streamed = util::gradientVolume(makeVolume(true), 0, file);
+
+    ASSERT_EQ(streamed->getDimensions(), inMemory->getDimensions());
+    EXPECT_EQ(streamed->getDataFormat(), inMemory->getDataFormat());
+    EXPECT_EQ(streamed->dataMap_.dataRange, inMemory->dataMap_.dataRange);
+    EXPECT_EQ(streamed->getModelMatrix(), inMemory->getModelMatrix());
+
+    const auto* a = inMemory->getRepresentation<VolumeRAM>();
+    const auto* b = streamed->getRepresentation<VolumeRAM>();
+    const auto dims = inMemory->getDimensions();
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const size3_t pos{x, y, z};
+                ASSERT_EQ(a->getAsDVec3(pos), b->getAsDVec3(pos))
+                    << "at (" << x << ", " << y << ", " << z << ")";
+            }
+        }
+    }
+}
+
+TEST(VolumeGradient, BrickedMatchesLinear) {
+    auto volume = makeVolume(false);
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+    // Small bricks such that there are partial bricks along each axis
+    auto bricked = std::make_shared<VolumeBrickedRAMPrecision<float>>(volume->getDimensions(),
+                                                                      RAMAllocation{}, 4, 1);
+    bricked->copyFrom(*ram);
+    volume->addRepresentation(bricked);
+
+    const auto linear = util::gradientVolume(makeVolume(false), 0);
+    const auto fromBricks = util::gradientVolume(volume, 0);
+    EXPECT_EQ(fromBricks->dataMap_.dataRange, linear->dataMap_.dataRange);
+
+    const auto* a = linear->getRepresentation<VolumeRAM>();
+    const auto* b = fromBricks->getRepresentation<VolumeRAM>();
+    const auto dims = linear->getDimensions();
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const size3_t pos{x, y, z};
+                ASSERT_EQ(a->getAsDVec3(pos), b->getAsDVec3(pos))
+                    << "at (" << x << ", " << y << ", " << z << ")";
+            }
+        }
+    }
+}
+
+}  // namespace inviwo
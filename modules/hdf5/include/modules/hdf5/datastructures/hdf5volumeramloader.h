@@ -0,0 +1,188 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/hdf5/hdf5moduledefine.h>
+#include <modules/hdf5/datastructures/hdf5handle.h>
+
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <H5Cpp.h>
+#include <warn/pop>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+/**
+ * \class VolumeRAMLoader
+ * \brief Reads a hyperslab of an HDF5 dataset into a VolumeRAM once it is requested.
+ * Used by Handle::getVolumeAtPathAsType.
+ *
+ * The selection is read in slabs that cover whole rows of chunks of the dataset, and the chunk
+ * cache of the dataset is sized to hold one such row, such that every chunk is read and
+ * decompressed once. The HDF5 library serializes all calls into it, hence the chunks can not
+ * be read in parallel through it. If the chunks are stored uncompressed or with the deflate and
+ * shuffle filters only, and the data needs no type conversion, the raw chunks are read directly
+ * and decompressed in parallel on the thread pool instead, while the next row of chunks is read.
+ *
+ * Subregions can be read without reading the whole selection, @see VolumeDisk::readRegion.
+ */
+class IVW_MODULE_HDF5_API VolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation>,
+                                            public VolumeRegionLoader {
+public:
+    /**
+     * @param filename the HDF5 file
+     * @param dataset the absolute path of the dataset in the file
+     * @param selection the part of the dataset to read, one entry per dimension of the dataset
+     *        in column major order, i.e. the fastest varying dimension first. At most three of the
+     *        dimensions can select more than one element.
+     * @throws hdf5::Exception if more than three dimensions select more than one element
+     */
+    VolumeRAMLoader(std::string filename, std::string dataset,
+                    std::vector<Handle::Selection> selection);
+    virtual VolumeRAMLoader* clone() const override;
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override;
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                      const VolumeRepresentation& src) const override;
+
+    virtual std::shared_ptr<VolumeRAM> readRegion(const VolumeRepresentation& src, size3_t offset,
+                                                  size3_t extent) const override;
+
+    /**
+     * The dimensions of the volume, the selected dimensions of the dataset in reverse order.
+     */
+    size3_t getDimensions() const;
+
+    /**
+     * The range of the values of the selection, read as @p format, if it is known without reading
+     * the data. Taken from the `actual_range`, or `actual_min` and `actual_max`, attributes of the
+     * dataset, which bound the values of any selection. They are given in unpacked values, and
+     * are converted back to the stored values using the `scale_factor` and `add_offset`
+     * attributes. Otherwise a range computed by computeDataRange is returned, which is cached
+     * until the file is modified.
+     */
+    std::optional<dvec2> getDataRange(const DataFormatBase* format) const;
+
+    /**
+     * Compute the range of the values of the selection, read as @p format, over all components.
+     * The selection is read in slabs, such that it never has to fit in memory as a whole. The
+     * range is cached until the file is modified, @see getDataRange.
+     */
+    dvec2 computeDataRange(const DataFormatBase* format) const;
+
+private:
+    void read(const DataFormatBase* format, void* dest, size3_t offset, size3_t extent) const;
+    std::string rangeKey(const DataFormatBase* format) const;
+
+    std::string filename_;
+    std::string dataset_;
+    // The selection in row major order, as used by HDF5
+    std::vector<hsize_t> start_;
+    std::vector<hsize_t> count_;
+    std::vector<hsize_t> stride_;
+    // The dimension of the dataset along each axis of the volume, the rank if there is none
+    std::array<size_t, 3> axes_;
+};
+
+/**
+ * Helpers for reading raw chunks, exposed for testing.
+ */
+namespace detail {
+
+/// A box of selection indices, one entry per dimension of the dataset in row major order
+struct Box {
+    std::vector<hsize_t> first;
+    std::vector<hsize_t> count;
+};
+
+/// The part of a dataset that is read, and how it is split into chunks
+struct Layout {
+    std::vector<hsize_t> start;
+    std::vector<hsize_t> stride;
+    Box box;
+    // The dimensions of the chunks, ones if the dataset is not chunked
+    std::vector<hsize_t> chunk;
+    // The range of chunk indices along each dimension that intersect the box
+    std::vector<hsize_t> chunkFirst;
+    std::vector<hsize_t> chunkEnd;
+    // The dimension along which the box is split into slabs, the z axis of the volume
+    size_t slabDim;
+};
+
+/// A raw chunk, as stored in the file, and the part of the box in it
+struct Chunk {
+    std::vector<hsize_t> origin;
+    Box part;
+    std::vector<std::byte> data;
+    std::uint32_t mask = 0;
+};
+
+/**
+ * Undo the shuffle filter, which stores the first byte of all elements, then the second, etc.
+ */
+IVW_MODULE_HDF5_API std::vector<std::byte> unshuffle(const std::vector<std::byte>& data,
+                                                     size_t elementSize);
+
+/**
+ * Undo the @p filters, in reverse order, skipping those flagged as failed in @p mask.
+ * @throws Exception if the data can not be inflated or is smaller than @p chunkBytes
+ */
+IVW_MODULE_HDF5_API std::vector<std::byte> decode(std::vector<std::byte> data,
+                                                  std::uint32_t mask,
+                                                  const std::vector<H5Z_filter_t>& filters,
+                                                  size_t chunkBytes, size_t elementSize);
+
+/**
+ * Copy the part of the box in @p chunk from the decoded chunk @p src to @p dest, which holds
+ * the whole box.
+ */
+IVW_MODULE_HDF5_API void scatter(const std::byte* src, const Layout& layout, const Chunk& chunk,
+                                 std::byte* dest, size_t elementSize);
+
+}  // namespace detail
+
+}  // namespace hdf5
+
+}  // namespace inviwo
@@ -39,6 +39,7 @@
 #include <H5Cpp.h>
 #include <warn/pop>
 
+#include <mutex>
 #include <vector>
 
 namespace inviwo {
@@ -59,6 +60,13 @@ IVW_MODULE_HDF5_API Paths findpaths(const H5::Group& grp, const Path& path,
 IVW_MODULE_HDF5_API bool isOfType(const H5::Group& grp, const std::string& type);
 IVW_MODULE_HDF5_API VolumeInfos getVolumeInfo(const H5::DataSet& ds, const Path& path);
 
+/**
+ * Lock for calls into the HDF5 library, which is not thread safe unless built to be. Hold it
+ * while using the library from threads that might run concurrently with others using it, e.g.
+ * from loaders that are called on the thread pool.
+ */
+IVW_MODULE_HDF5_API std::unique_lock<std::recursive_mutex> lock();
+
 }  // namespace hdf5
 
 }  // namespace inviwo
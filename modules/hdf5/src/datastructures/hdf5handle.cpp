@@ -30,14 +30,13 @@
  *********************************************************************************/
 
 #include <modules/hdf5/datastructures/hdf5handle.h>
+#include <modules/hdf5/datastructures/hdf5volumeramloader.h>
 #include <inviwo/core/util/stdextensions.h>
-#include <inviwo/core/util/formatdispatching.h>
 #include <inviwo/core/util/raiiutils.h>
-#include <inviwo/core/datastructures/volume/volumeramprecision.h>
-
-#include <modules/base/algorithm/dataminmax.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
 
 #include <algorithm>
+#include <memory>
 
 namespace inviwo {
 
@@ -127,98 +126,44 @@ std::shared_ptr<Volume> Handle::getVolumeAtPathAsType(const Path& path,
                                                       std::vector<Selection> selection,
                                                       const DataFormatBase* type) const {
 
-    auto dataset = data_.openDataSet(path);
-    ::inviwo::util::OnScopeExit closedataset{[&]() { dataset.close(); }};
-
-    const H5::DataSpace dataSpace = dataset.getSpace();
-    const size_t rank = dataSpace.getSimpleExtentNdims();
-    if (selection.size() != rank) {
-        throw Exception("Selection not of the same rank as the data", IVW_CONTEXT);
-    }
-
-    std::vector<hsize_t> dataDimensions(rank);
-    dataSpace.getSimpleExtentDims(dataDimensions.data());
-    const hsize_t dataSize = dataSpace.getSelectNpoints();
-
-    std::vector<hsize_t> start(rank);
-    std::vector<hsize_t> count(rank);
-    std::vector<hsize_t> stride(rank);
-
-    /*
-     * Column major, i.e. the FIRST listed dimension is the fasted changing
-     * Inviwo, OpenGL, matlab, Fortran
-     *
-     * Row major, i.e. the LAST listed dimension is the fasted changing
-     * HDF, C/C++, Mathematica, Python
-     *
-     * Solution reverse all the dimension lists.
-     * Row major version of the selection to match the hdf row major dataDimensions.
-     */
-    std::reverse(selection.begin(), selection.end());
-
-    size3_t volumeDimensions(1);
-    int resRank = 0;
-    std::vector<hsize_t> memoryDimensions{1, 1, 1};
-
-    for (size_t i = 0; i < rank; ++i) {
-        start[i] = selection[i].start;
-        count[i] =
-            static_cast<hsize_t>((selection[i].end - selection[i].start) / selection[i].stride);
-        stride[i] = selection[i].stride;
-
-        if (count[i] > 1) {
-            if (resRank > 2) throw Exception("Invalid selection, resulting rank > 3", IVW_CONTEXT);
-            memoryDimensions[resRank] = count[i];
-            volumeDimensions[resRank] = count[i];
-            resRank++;
+    std::unique_ptr<VolumeRAMLoader> loader;
+    const DataFormatBase* format = nullptr;
+    {
+        const auto hdfLock = lock();
+        auto dataset = data_.openDataSet(path);
+        ::inviwo::util::OnScopeExit closedataset{[&]() { dataset.close(); }};
+
+        const H5::DataSpace dataSpace = dataset.getSpace();
+        const size_t rank = dataSpace.getSimpleExtentNdims();
+        if (selection.size() != rank) {
+            throw Exception("Selection not of the same rank as the data", IVW_CONTEXT);
         }
-    }
-
-    dataSpace.selectHyperslab(H5S_SELECT_SET, count.data(), start.data(), stride.data(), nullptr);
-
-    H5::DataSpace memorySpace(3, memoryDimensions.data());
-    memorySpace.selectAll();
 
-    hsize_t selectionSize = memorySpace.getSelectNpoints();
+        std::vector<hsize_t> dataDimensions(rank);
+        dataSpace.getSimpleExtentDims(dataDimensions.data());
 
-    LogInfo("Data rank: " << rank << " dims " << joinString(dataDimensions, " x ") << " size "
-                          << dataSize << " selection " << dataSpace.getSelectNpoints()
-                          << " memory size " << memorySpace.getSelectNpoints() << " memory dim "
-                          << volumeDimensions);
+        format = type ? type : util::getDataFormatFromDataSet(dataset);
+        loader = std::make_unique<VolumeRAMLoader>(filename_, dataset.getObjName(),
+                                                   std::move(selection));
 
-    const DataFormatBase* format = type ? type : util::getDataFormatFromDataSet(dataset);
-
-    // Reverse back the Column major
-    std::reverse(&volumeDimensions[0], &volumeDimensions[0] + volumeDimensions.length());
-    auto volumeram = createVolumeRAM(volumeDimensions, format);
-
-    auto minmax = volumeram->dispatch<std::pair<dvec4, dvec4>, dispatching::filter::Scalars>(
-        [&](auto vrprecision) {
-            using ValueType = ::inviwo::util::PrecisionValueType<decltype(vrprecision)>;
-
-            ValueType* data = vrprecision->getDataTyped();
-
-            try {
-                dataset.read(data, TypeMap<ValueType>::getType(), memorySpace, dataSpace);
-            } catch (H5::DataSetIException& e) {
-                throw Exception("HDF: unable to read data: " + e.getDetailMsg(), IVW_CONTEXT);
-            }
-
-            auto res = ::inviwo::util::dataMinMax(data, selectionSize);
-
-            LogInfo("Read HDF volume type: " << DataFormat<ValueType>::str()
-                                             << " data range: " << res.first << ", " << res.second
-                                             << " file: " << dataset.getFileName());
+        LogInfo("Data rank: " << rank << " dims " << joinString(dataDimensions, " x ")
+                              << " size " << dataSpace.getSelectNpoints() << " volume dim "
+                              << loader->getDimensions());
+    }
 
-            return res;
-        });
+    // The data is read once the volume is used. If the data range is not known without reading
+    // it, compute it once here, before anyone can use the volume.
+    auto dataRange = loader->getDataRange(format);
+    if (!dataRange) dataRange = loader->computeDataRange(format);
+    LogInfo("HDF volume type: " << format->getString() << " data range: " << *dataRange
+                                << " file: " << filename_);
 
-    auto volume = std::make_shared<Volume>(volumeDimensions, format);
-    volume->dataMap_.dataRange.x = glm::compMin(minmax.first);
-    volume->dataMap_.dataRange.y = glm::compMax(minmax.second);
-    volume->dataMap_.valueRange = volume->dataMap_.dataRange;
+    auto volumeDisk = std::make_shared<VolumeDisk>(filename_, loader->getDimensions(), format);
+    volumeDisk->setLoader(loader.release());
 
-    volume->addRepresentation(volumeram);
+    auto volume = std::make_shared<Volume>(volumeDisk);
+    volume->dataMap_.dataRange = *dataRange;
+    volume->dataMap_.valueRange = *dataRange;
 
     return volume;
 }
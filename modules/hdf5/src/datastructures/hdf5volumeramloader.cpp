@@ -0,0 +1,616 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <modules/hdf5/datastructures/hdf5volumeramloader.h>
+
+#include <modules/base/algorithm/dataminmax.h>
+#include <modules/hdf5/hdf5exception.h>
+#include <modules/hdf5/hdf5types.h>
+#include <modules/hdf5/hdf5utils.h>
+
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+namespace {
+
+/**
+ * Advances @p index to the next position in [first, end), the last dimension varying fastest.
+ * Returns false after the last position.
+ */
+bool advance(std::vector<hsize_t>& index, const std::vector<hsize_t>& first,
+             const std::vector<hsize_t>& end) {
+    for (size_t dim = index.size(); dim-- > 0;) {
+        if (++index[dim] < end[dim]) return true;
+        index[dim] = first[dim];
+    }
+    return false;
+}
+
+}  // namespace
+
+namespace detail {
+
+std::vector<std::byte> unshuffle(const std::vector<std::byte>& data, size_t elementSize) {
+    std::vector<std::byte> result(data.size());
+    const auto elements = data.size() / elementSize;
+    for (size_t byte = 0; byte < elementSize; ++byte) {
+        for (size_t i = 0; i < elements; ++i) {
+            result[i * elementSize + byte] = data[byte * elements + i];
+        }
+    }
+    // Trailing bytes that do not make up a whole element are not shuffled
+    std::copy(data.begin() + elements * elementSize, data.end(),
+              result.begin() + elements * elementSize);
+    return result;
+}
+
+std::vector<std::byte> decode(std::vector<std::byte> data, std::uint32_t mask,
+                              const std::vector<H5Z_filter_t>& filters, size_t chunkBytes,
+                              size_t elementSize) {
+    for (size_t i = filters.size(); i-- > 0;) {
+        // Filters that failed when writing the chunk are flagged in the mask
+        if (mask & (1u << i)) continue;
+        if (filters[i] == H5Z_FILTER_DEFLATE) {
+            std::vector<std::byte> inflated(chunkBytes);
+            auto size = static_cast<uLongf>(inflated.size());
+            if (uncompress(reinterpret_cast<Bytef*>(inflated.data()), &size,
+                           reinterpret_cast<const Bytef*>(data.data()),
+                           static_cast<uLong>(data.size())) != Z_OK) {
+                throw Exception("HDF: unable to inflate chunk",
+                                IVW_CONTEXT_CUSTOM("hdf5::VolumeRAMLoader"));
+            }
+            inflated.resize(size);
+            data = std::move(inflated);
+        } else {
+            data = unshuffle(data, elementSize);
+        }
+    }
+    if (data.size() < chunkBytes) {
+        throw Exception("HDF: truncated chunk", IVW_CONTEXT_CUSTOM("hdf5::VolumeRAMLoader"));
+    }
+    return data;
+}
+
+void scatter(const std::byte* src, const Layout& layout, const Chunk& chunk, std::byte* dest,
+             size_t elementSize) {
+    const auto rank = layout.start.size();
+    const auto last = rank - 1;
+    std::vector<size_t> srcStrides(rank, 1);
+    std::vector<size_t> destStrides(rank, 1);
+    for (size_t dim = last; dim > 0; --dim) {
+        srcStrides[dim - 1] = srcStrides[dim] * layout.chunk[dim];
+        destStrides[dim - 1] = destStrides[dim] * layout.box.count[dim];
+    }
+    const auto coord = [&](size_t dim, hsize_t index) {
+        return layout.start[dim] + index * layout.stride[dim] - chunk.origin[dim];
+    };
+
+    const auto& part = chunk.part;
+    auto index = part.first;
+    auto end = index;
+    for (size_t dim = 0; dim < last; ++dim) end[dim] += part.count[dim];
+    end[last] += 1;
+
+    do {
+        size_t srcOffset = 0;
+        size_t destOffset = 0;
+        for (size_t dim = 0; dim < last; ++dim) {
+            srcOffset += coord(dim, index[dim]) * srcStrides[dim];
+            destOffset += (index[dim] - layout.box.first[dim]) * destStrides[dim];
+        }
+        srcOffset += coord(last, part.first[last]);
+        destOffset += part.first[last] - layout.box.first[last];
+
+        if (layout.stride[last] == 1) {
+            std::memcpy(dest + destOffset * elementSize, src + srcOffset * elementSize,
+                        part.count[last] * elementSize);
+        } else {
+            for (hsize_t i = 0; i < part.count[last]; ++i) {
+                std::memcpy(dest + (destOffset + i) * elementSize,
+                            src + (srcOffset + i * layout.stride[last]) * elementSize,
+                            elementSize);
+            }
+        }
+    } while (advance(index, part.first, end));
+}
+
+}  // namespace detail
+
+namespace {
+
+using detail::Box;
+using detail::Chunk;
+using detail::Layout;
+
+// The amount of data to read per call into the library
+constexpr size_t slabBytes = 64 * 1024 * 1024;
+constexpr size_t maxChunkCacheBytes = 256 * 1024 * 1024;
+
+H5::PredType memoryType(const DataFormatBase* format) {
+    return dispatching::dispatch<H5::PredType, dispatching::filter::Scalars>(
+        format->getId(), []<typename Result, typename Format>() -> Result {
+            return TypeMap<typename Format::type>::getType();
+        });
+}
+
+/**
+ * The selection indices in the box along @p dim that fall into [begin, end) of the dataset.
+ */
+std::pair<hsize_t, hsize_t> intersect(const Layout& layout, size_t dim, hsize_t begin,
+                                      hsize_t end) {
+    const auto start = layout.start[dim];
+    const auto stride = layout.stride[dim];
+    const auto index = [&](hsize_t coord) -> hsize_t {
+        return coord <= start ? 0 : (coord - start + stride - 1) / stride;
+    };
+    const auto first = layout.box.first[dim];
+    const auto last = first + layout.box.count[dim];
+    return {std::clamp(index(begin), first, last), std::clamp(index(end), first, last)};
+}
+
+/**
+ * The part of the box that is in the chunk at @p index, if any.
+ */
+std::optional<Box> chunkPart(const Layout& layout, const std::vector<hsize_t>& dims,
+                             const std::vector<hsize_t>& index) {
+    Box part{layout.box.first, layout.box.count};
+    for (size_t dim = 0; dim < index.size(); ++dim) {
+        const auto begin = index[dim] * layout.chunk[dim];
+        const auto [first, last] =
+            intersect(layout, dim, begin, std::min(begin + layout.chunk[dim], dims[dim]));
+        if (first >= last) return std::nullopt;
+        part.first[dim] = first;
+        part.count[dim] = last - first;
+    }
+    return part;
+}
+
+/**
+ * Read the @p part of the box of @p layout into @p dest, which holds the whole box.
+ */
+void readPart(const H5::DataSet& dataset, const H5::DataType& type, const Layout& layout,
+              const Box& part, void* dest) {
+    const auto rank = layout.start.size();
+    std::vector<hsize_t> fileStart(rank);
+    std::vector<hsize_t> memoryStart(rank);
+    for (size_t dim = 0; dim < rank; ++dim) {
+        fileStart[dim] = layout.start[dim] + part.first[dim] * layout.stride[dim];
+        memoryStart[dim] = part.first[dim] - layout.box.first[dim];
+    }
+
+    H5::DataSpace fileSpace = dataset.getSpace();
+    fileSpace.selectHyperslab(H5S_SELECT_SET, part.count.data(), fileStart.data(),
+                              layout.stride.data());
+    H5::DataSpace memorySpace(static_cast<int>(rank), layout.box.count.data());
+    memorySpace.selectHyperslab(H5S_SELECT_SET, part.count.data(), memoryStart.data());
+
+    try {
+        dataset.read(dest, type, memorySpace, fileSpace);
+    } catch (const H5::Exception& e) {
+        throw Exception("HDF: unable to read data: " + e.getDetailMsg(),
+                        IVW_CONTEXT_CUSTOM("hdf5::VolumeRAMLoader"));
+    }
+}
+
+/**
+ * The number of bytes of one row of chunks along the slab dimension.
+ */
+size_t chunkRowBytes(const Layout& layout, size_t elementSize) {
+    size_t bytes = elementSize * layout.chunk[layout.slabDim];
+    for (size_t dim = 0; dim < layout.chunk.size(); ++dim) {
+        if (dim == layout.slabDim) continue;
+        bytes *= (layout.chunkEnd[dim] - layout.chunkFirst[dim]) * layout.chunk[dim];
+    }
+    return bytes;
+}
+
+#if H5_VERSION_GE(1, 10, 3)
+
+/**
+ * The filters of the chunks, in the order they were applied, if all of them can be decoded
+ * here.
+ */
+std::optional<std::vector<H5Z_filter_t>> decodableFilters(const H5::DSetCreatPropList& dcpl) {
+    std::vector<H5Z_filter_t> filters;
+    const auto count = H5Pget_nfilters(dcpl.getId());
+    for (int i = 0; i < count; ++i) {
+        unsigned int flags = 0;
+        size_t elements = 0;
+        unsigned int config = 0;
+        const auto filter = H5Pget_filter2(dcpl.getId(), static_cast<unsigned int>(i), &flags,
+                                           &elements, nullptr, 0, nullptr, &config);
+        if (filter != H5Z_FILTER_DEFLATE && filter != H5Z_FILTER_SHUFFLE) return std::nullopt;
+        filters.push_back(filter);
+    }
+    return filters;
+}
+
+/**
+ * Read the raw chunks in the rows [begin, end) of chunks along the slab dimension. Chunks that
+ * are not allocated are read through the library instead, which fills in the fill value.
+ */
+std::vector<Chunk> readRawChunks(const H5::DataSet& dataset, const H5::DataType& type,
+                                 const Layout& layout, const std::vector<hsize_t>& dims,
+                                 hsize_t begin, hsize_t end, void* dest) {
+    std::vector<Chunk> chunks;
+    auto first = layout.chunkFirst;
+    auto last = layout.chunkEnd;
+    first[layout.slabDim] = begin;
+    last[layout.slabDim] = end;
+
+    auto index = first;
+    do {
+        auto part = chunkPart(layout, dims, index);
+        if (!part) continue;
+
+        Chunk chunk{std::vector<hsize_t>(index.size()), std::move(*part), {}, 0};
+        for (size_t dim = 0; dim < index.size(); ++dim) {
+            chunk.origin[dim] = index[dim] * layout.chunk[dim];
+        }
+        hsize_t bytes = 0;
+        herr_t status = -1;
+        // Older versions of the library fail instead of returning zero for unallocated chunks
+        H5E_BEGIN_TRY {
+            status = H5Dget_chunk_storage_size(dataset.getId(), chunk.origin.data(), &bytes);
+        }
+        H5E_END_TRY;
+        if (status < 0 || bytes == 0) {
+            readPart(dataset, type, layout, chunk.part, dest);
+            continue;
+        }
+        chunk.data.resize(bytes);
+        if (H5Dread_chunk(dataset.getId(), H5P_DEFAULT, chunk.origin.data(), &chunk.mask,
+                          chunk.data.data()) < 0) {
+            throw Exception("HDF: unable to read chunk",
+                            IVW_CONTEXT_CUSTOM("hdf5::VolumeRAMLoader"));
+        }
+        chunks.push_back(std::move(chunk));
+    } while (advance(index, first, last));
+    return chunks;
+}
+
+/**
+ * Read the box by reading the raw chunks, one batch of rows of chunks at the time, and
+ * decoding them on the thread pool while the next batch is read.
+ */
+void readChunks(const H5::DataSet& dataset, const H5::DataType& type, const Layout& layout,
+                const std::vector<hsize_t>& dims, const std::vector<H5Z_filter_t>& filters,
+                void* dest) {
+    const auto elementSize = type.getSize();
+    size_t chunkBytes = elementSize;
+    for (const auto extent : layout.chunk) chunkBytes *= extent;
+    const auto rows = std::max(size_t{1}, slabBytes / chunkRowBytes(layout, elementSize));
+
+    auto row = layout.chunkFirst[layout.slabDim];
+    const auto rowsEnd = layout.chunkEnd[layout.slabDim];
+    const auto readRows = [&]() {
+        const auto begin = row;
+        row = std::min<hsize_t>(row + rows, rowsEnd);
+        return readRawChunks(dataset, type, layout, dims, begin, row, dest);
+    };
+
+    auto& pool = ::inviwo::util::getThreadPool();
+    auto chunks = readRows();
+    while (!chunks.empty() || row < rowsEnd) {
+        if (chunks.empty()) {
+            chunks = readRows();
+            continue;
+        }
+        auto latch = pool.enqueueRange(chunks.size(), chunks.size(), [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                const auto data = detail::decode(std::move(chunks[i].data), chunks[i].mask,
+                                                 filters, chunkBytes, elementSize);
+                detail::scatter(data.data(), layout, chunks[i], static_cast<std::byte*>(dest),
+                                elementSize);
+            }
+        });
+        std::vector<Chunk> next;
+        try {
+            if (row < rowsEnd) next = readRows();
+        } catch (...) {
+            pool.wait(*latch);
+            throw;
+        }
+        pool.wait(*latch);
+        latch->get();
+        chunks = std::move(next);
+    }
+}
+
+#endif
+
+std::optional<dvec2> rangeFromAttributes(const H5::DataSet& dataset) {
+    const auto values = [&](const char* name) -> std::vector<double> {
+        if (!dataset.attrExists(name)) return {};
+        const auto attribute = dataset.openAttribute(name);
+        const auto typeClass = attribute.getTypeClass();
+        if (typeClass != H5T_INTEGER && typeClass != H5T_FLOAT) return {};
+        std::vector<double> result(
+            static_cast<size_t>(attribute.getSpace().getSimpleExtentNpoints()));
+        attribute.read(H5::PredType::NATIVE_DOUBLE, result.data());
+        return result;
+    };
+
+    // The valid_range and valid_min/valid_max attributes only say which values are not missing,
+    // and are not used since they may be much wider than the data.
+    std::optional<dvec2> range;
+    if (const auto actual = values("actual_range"); actual.size() == 2) {
+        range = dvec2{actual[0], actual[1]};
+    } else if (const auto min = values("actual_min"), max = values("actual_max");
+               min.size() == 1 && max.size() == 1) {
+        range = dvec2{min[0], max[0]};
+    }
+    if (!range) return std::nullopt;
+
+    // The range is given in unpacked values, unpacked = stored * scale_factor + add_offset
+    const auto scale = values("scale_factor");
+    const auto offset = values("add_offset");
+    if (scale.size() == 1 && scale[0] == 0.0) return std::nullopt;
+    if (offset.size() == 1) *range -= offset[0];
+    if (scale.size() == 1) *range /= scale[0];
+    if (range->x > range->y) std::swap(range->x, range->y);
+    return range;
+}
+
+struct RangeCache {
+    std::mutex mutex;
+    std::map<std::string, dvec2> ranges;
+};
+
+RangeCache& rangeCache() {
+    static RangeCache cache;
+    return cache;
+}
+
+}  // namespace
+
+VolumeRAMLoader::VolumeRAMLoader(std::string filename, std::string dataset,
+                                 std::vector<Handle::Selection> selection)
+    : filename_{std::move(filename)}, dataset_{std::move(dataset)} {
+    /*
+     * Column major, i.e. the FIRST listed dimension is the fasted changing
+     * Inviwo, OpenGL, matlab, Fortran
+     *
+     * Row major, i.e. the LAST listed dimension is the fasted changing
+     * HDF, C/C++, Mathematica, Python
+     */
+    std::reverse(selection.begin(), selection.end());
+
+    std::vector<size_t> selected;
+    for (const auto& item : selection) {
+        if (item.stride == 0 || item.end < item.start) {
+            throw Exception("Invalid selection", IVW_CONTEXT);
+        }
+        start_.push_back(item.start);
+        count_.push_back((item.end - item.start) / item.stride);
+        stride_.push_back(item.stride);
+        if (count_.back() > 1) selected.push_back(count_.size() - 1);
+    }
+    if (selected.size() > 3) throw Exception("Invalid selection, resulting rank > 3", IVW_CONTEXT);
+
+    // The first selected dimension is the slowest varying one, i.e. the z axis of the volume
+    axes_.fill(start_.size());
+    for (size_t i = 0; i < selected.size(); ++i) axes_[2 - i] = selected[i];
+}
+
+VolumeRAMLoader* VolumeRAMLoader::clone() const { return new VolumeRAMLoader(*this); }
+
+size3_t VolumeRAMLoader::getDimensions() const {
+    size3_t dims{1};
+    for (size_t axis = 0; axis < 3; ++axis) {
+        if (axes_[axis] < count_.size()) dims[axis] = count_[axes_[axis]];
+    }
+    return dims;
+}
+
+std::shared_ptr<VolumeRepresentation> VolumeRAMLoader::createRepresentation(
+    const VolumeRepresentation& src) const {
+    auto volumeRAM = createVolumeRAM(src.getDimensions(), src.getDataFormat(),
+                                     RAMAllocation::uninitialized(), src.getSwizzleMask(),
+                                     src.getInterpolation(), src.getWrapping());
+    read(src.getDataFormat(), volumeRAM->getData(), size3_t{0}, src.getDimensions());
+    return volumeRAM;
+}
+
+void VolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                           const VolumeRepresentation& src) const {
+    auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
+
+    if (src.getDimensions() != volumeDst->getDimensions()) {
+        volumeDst->setDimensions(src.getDimensions());
+    }
+    read(src.getDataFormat(), volumeDst->getData(), size3_t{0}, src.getDimensions());
+
+    volumeDst->setSwizzleMask(src.getSwizzleMask());
+    volumeDst->setInterpolation(src.getInterpolation());
+    volumeDst->setWrapping(src.getWrapping());
+}
+
+std::shared_ptr<VolumeRAM> VolumeRAMLoader::readRegion(const VolumeRepresentation& src,
+                                                       size3_t offset, size3_t extent) const {
+    auto volumeRAM = createVolumeRAM(extent, src.getDataFormat(), RAMAllocation::uninitialized(),
+                                     src.getSwizzleMask(), src.getInterpolation(),
+                                     src.getWrapping());
+    read(src.getDataFormat(), volumeRAM->getData(), offset, extent);
+    return volumeRAM;
+}
+
+dvec2 VolumeRAMLoader::computeDataRange(const DataFormatBase* format) const {
+    const auto dims = getDimensions();
+    const auto planeBytes = std::max(size_t{1}, dims.x * dims.y * format->getSize());
+    const auto depth = std::max(size_t{1}, std::min(slabBytes / planeBytes, dims.z));
+
+    dvec2 range{std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()};
+    for (size_t z = 0; z < dims.z; z += depth) {
+        const size3_t extent{dims.x, dims.y, std::min(depth, dims.z - z)};
+        auto slab = createVolumeRAM(extent, format, RAMAllocation::uninitialized());
+        read(format, slab->getData(), size3_t{0, 0, z}, extent);
+        const auto [min, max] = ::inviwo::util::volumeMinMax(slab.get());
+        for (int c = 0; c < static_cast<int>(format->getComponents()); ++c) {
+            range.x = std::min(range.x, min[c]);
+            range.y = std::max(range.y, max[c]);
+        }
+    }
+    // An empty selection
+    if (range.x > range.y) range = dvec2{0.0};
+
+    auto& cache = rangeCache();
+    std::scoped_lock cacheLock{cache.mutex};
+    cache.ranges.insert_or_assign(rangeKey(format), range);
+    return range;
+}
+
+std::string VolumeRAMLoader::rangeKey(const DataFormatBase* format) const {
+    return fmt::format("{}|{}|{}|{}|{}|{}|{}", filename_,
+                       filesystem::fileModificationTime(filename_), dataset_,
+                       joinString(start_, ","), joinString(count_, ","),
+                       joinString(stride_, ","), format->getString());
+}
+
+void VolumeRAMLoader::read(const DataFormatBase* format, void* dest, size3_t offset,
+                           size3_t extent) const {
+    const auto rank = start_.size();
+    Layout layout{start_, stride_, Box{std::vector<hsize_t>(rank, 0), count_}, {}, {}, {}, 0};
+    for (size_t axis = 0; axis < 3; ++axis) {
+        if (axes_[axis] >= rank) continue;
+        layout.box.first[axes_[axis]] = offset[axis];
+        layout.box.count[axes_[axis]] = extent[axis];
+    }
+    if (rank == 0 || std::ranges::find(layout.box.count, hsize_t{0}) != layout.box.count.end()) {
+        return;
+    }
+    layout.slabDim = axes_[2] < rank ? axes_[2] : 0;
+
+    const auto type = memoryType(format);
+    const auto hdfLock = lock();
+
+    H5::H5File file(filename_, H5F_ACC_RDONLY);
+    auto dataset = file.openDataSet(dataset_);
+    if (static_cast<size_t>(dataset.getSpace().getSimpleExtentNdims()) != rank) {
+        throw Exception("Selection not of the same rank as the data", IVW_CONTEXT);
+    }
+    std::vector<hsize_t> dims(rank);
+    dataset.getSpace().getSimpleExtentDims(dims.data());
+
+    const auto dcpl = dataset.getCreatePlist();
+    const bool chunked = dcpl.getLayout() == H5D_CHUNKED;
+    layout.chunk.assign(rank, 1);
+    if (chunked) dcpl.getChunk(static_cast<int>(rank), layout.chunk.data());
+
+    layout.chunkFirst.resize(rank);
+    layout.chunkEnd.resize(rank);
+    size_t chunks = 1;
+    for (size_t dim = 0; dim < rank; ++dim) {
+        const auto first = layout.start[dim] + layout.box.first[dim] * layout.stride[dim];
+        const auto last = first + (layout.box.count[dim] - 1) * layout.stride[dim];
+        if (last >= dims[dim]) {
+            throw Exception("Selection outside of the dataset of size " + joinString(dims, " x "),
+                            IVW_CONTEXT);
+        }
+        layout.chunkFirst[dim] = first / layout.chunk[dim];
+        layout.chunkEnd[dim] = last / layout.chunk[dim] + 1;
+        chunks *= layout.chunkEnd[dim] - layout.chunkFirst[dim];
+    }
+
+#if H5_VERSION_GE(1, 10, 3)
+    if (chunked && chunks > 1 && ::inviwo::util::getPoolSize() > 0 &&
+        dataset.getDataType() == type) {
+        if (const auto filters = decodableFilters(dcpl)) {
+            readChunks(dataset, type, layout, dims, *filters, dest);
+            return;
+        }
+    }
+#endif
+
+    if (chunked) {
+        // Make room for one row of chunks in the cache, slabs that end within a row of chunks
+        // then do not decompress them again.
+        const auto rowBytes = chunkRowBytes(layout, dataset.getDataType().getSize());
+        const auto rowChunks = chunks / static_cast<size_t>(layout.chunkEnd[layout.slabDim] -
+                                                            layout.chunkFirst[layout.slabDim]);
+        H5::DSetAccPropList dapl;
+        dapl.setChunkCache(std::max(size_t{521}, 10 * rowChunks + 1),
+                           std::min(rowBytes, maxChunkCacheBytes), 1.0);
+        dataset.close();
+        dataset = file.openDataSet(dataset_, dapl);
+    }
+
+    const auto rows = std::max(size_t{1}, slabBytes / chunkRowBytes(layout, type.getSize()));
+    const auto slabDim = layout.slabDim;
+    for (auto row = layout.chunkFirst[slabDim]; row < layout.chunkEnd[slabDim]; row += rows) {
+        const auto [first, last] =
+            intersect(layout, slabDim, row * layout.chunk[slabDim],
+                      std::min((row + rows) * layout.chunk[slabDim], dims[slabDim]));
+        if (first >= last) continue;
+        Box part = layout.box;
+        part.first[slabDim] = first;
+        part.count[slabDim] = last - first;
+        readPart(dataset, type, layout, part, dest);
+    }
+}
+
+std::optional<dvec2> VolumeRAMLoader::getDataRange(const DataFormatBase* format) const {
+    {
+        const auto hdfLock = lock();
+        H5::H5File file(filename_, H5F_ACC_RDONLY);
+        const auto dataset = file.openDataSet(dataset_);
+        if (const auto range = rangeFromAttributes(dataset)) return range;
+    }
+
+    auto& cache = rangeCache();
+    std::scoped_lock cacheLock{cache.mutex};
+    if (auto it = cache.ranges.find(rangeKey(format)); it != cache.ranges.end()) {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+}  // namespace hdf5
+
+}  // namespace inviwo
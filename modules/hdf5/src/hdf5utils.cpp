@@ -73,6 +73,11 @@ VolumeInfos getVolumeInfo(const H5::DataSet& ds, const Path& path) {
     return paths;
 }
 
+std::unique_lock<std::recursive_mutex> lock() {
+    static std::recursive_mutex mutex;
+    return std::unique_lock{mutex};
+}
+
 bool isOfType(const H5::Group& grp, const std::string& type) {
     bool result = false;
     try {
@@ -0,0 +1,184 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/hdf5/datastructures/hdf5volumeramloader.h>
+#include <inviwo/core/util/exception.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::vector<std::byte> shuffle(const std::vector<std::byte>& data, size_t elementSize) {
+    std::vector<std::byte> result(data);
+    const auto elements = data.size() / elementSize;
+    for (size_t byte = 0; byte < elementSize; ++byte) {
+        for (size_t i = 0; i < elements; ++i) {
+            result[byte * elements + i] = data[i * elementSize + byte];
+        }
+    }
+    return result;
+}
+
+std::vector<std::byte> deflate(const std::vector<std::byte>& data) {
+    std::vector<std::byte> result(compressBound(static_cast<uLong>(data.size())));
+    auto size = static_cast<uLongf>(result.size());
+    EXPECT_EQ(Z_OK, compress(reinterpret_cast<Bytef*>(result.data()), &size,
+                             reinterpret_cast<const Bytef*>(data.data()),
+                             static_cast<uLong>(data.size())));
+    result.resize(size);
+    return result;
+}
+
+std::vector<std::byte> sequence(size_t size) {
+    std::vector<std::byte> data(size);
+    for (size_t i = 0; i < size; ++i) data[i] = static_cast<std::byte>(i * 7 % 251);
+    return data;
+}
+
+}  // namespace
+
+TEST(HDF5ChunkDecoding, Unshuffle) {
+    // Five whole elements and three trailing bytes, which are not shuffled
+    const auto data = sequence(23);
+    EXPECT_EQ(data, hdf5::detail::unshuffle(shuffle(data, 4), 4));
+    EXPECT_EQ(data, hdf5::detail::unshuffle(data, 1));
+}
+
+TEST(HDF5ChunkDecoding, ShuffleDeflate) {
+    const auto data = sequence(128);
+    const std::vector<H5Z_filter_t> filters{H5Z_FILTER_SHUFFLE, H5Z_FILTER_DEFLATE};
+
+    EXPECT_EQ(data, hdf5::detail::decode(deflate(shuffle(data, 2)), 0, filters, 128, 2));
+    EXPECT_EQ(data, hdf5::detail::decode(deflate(data), 0, {H5Z_FILTER_DEFLATE}, 128, 2));
+    EXPECT_EQ(data, hdf5::detail::decode(data, 0, {}, 128, 2));
+}
+
+TEST(HDF5ChunkDecoding, SkipFailedFilters) {
+    const auto data = sequence(128);
+    const std::vector<H5Z_filter_t> filters{H5Z_FILTER_SHUFFLE, H5Z_FILTER_DEFLATE};
+
+    // The deflate filter failed when the chunk was written, only the shuffle is undone
+    EXPECT_EQ(data, hdf5::detail::decode(shuffle(data, 2), 0b10, filters, 128, 2));
+    EXPECT_EQ(data, hdf5::detail::decode(data, 0b11, filters, 128, 2));
+}
+
+TEST(HDF5ChunkDecoding, InvalidChunks) {
+    const auto data = sequence(128);
+
+    EXPECT_THROW(hdf5::detail::decode(data, 0, {H5Z_FILTER_DEFLATE}, 128, 2), Exception);
+    EXPECT_THROW(hdf5::detail::decode(sequence(100), 0, {}, 128, 2), Exception);
+    EXPECT_THROW(hdf5::detail::decode(deflate(sequence(100)), 0, {H5Z_FILTER_DEFLATE}, 128, 2),
+                 Exception);
+}
+
+TEST(HDF5ChunkDecoding, Scatter) {
+    const std::vector<hsize_t> dims{6, 7, 9};
+    const std::vector<hsize_t> chunk{4, 4, 4};
+    const std::vector<hsize_t> start{1, 0, 2};
+    const std::vector<hsize_t> stride{1, 2, 3};
+
+    // The value of each element of the dataset is its index
+    const auto value = [&](const std::vector<hsize_t>& coord) {
+        return static_cast<std::uint32_t>((coord[0] * dims[1] + coord[1]) * dims[2] + coord[2]);
+    };
+
+    const auto test = [&](const hdf5::detail::Box& box) {
+        const hdf5::detail::Layout layout{start, stride, box, chunk, {}, {}, 0};
+        std::vector<std::uint32_t> dest(box.count[0] * box.count[1] * box.count[2], 0);
+
+        std::vector<hsize_t> index(3);
+        for (index[0] = 0; index[0] * chunk[0] < dims[0]; ++index[0]) {
+            for (index[1] = 0; index[1] * chunk[1] < dims[1]; ++index[1]) {
+                for (index[2] = 0; index[2] * chunk[2] < dims[2]; ++index[2]) {
+                    hdf5::detail::Chunk part{std::vector<hsize_t>(3), box, {}, 0};
+                    bool empty = false;
+                    for (size_t dim = 0; dim < 3; ++dim) {
+                        part.origin[dim] = index[dim] * chunk[dim];
+                        hsize_t first = box.first[dim] + box.count[dim];
+                        hsize_t last = box.first[dim];
+                        const auto end = part.origin[dim] + chunk[dim];
+                        for (auto i = box.first[dim]; i < box.first[dim] + box.count[dim]; ++i) {
+                            const auto coord = start[dim] + i * stride[dim];
+                            if (coord < part.origin[dim] || coord >= end) continue;
+                            first = std::min(first, i);
+                            last = std::max(last, i + 1);
+                        }
+                        if (first >= last) empty = true;
+                        part.part.first[dim] = first;
+                        part.part.count[dim] = last - first;
+                    }
+                    if (empty) continue;
+
+                    // Chunks at the edges are stored whole
+                    std::vector<std::uint32_t> src(chunk[0] * chunk[1] * chunk[2]);
+                    std::vector<hsize_t> coord(3);
+                    for (size_t i = 0; i < src.size(); ++i) {
+                        coord[0] = part.origin[0] + i / (chunk[1] * chunk[2]);
+                        coord[1] = part.origin[1] + i / chunk[2] % chunk[1];
+                        coord[2] = part.origin[2] + i % chunk[2];
+                        src[i] = value(coord);
+                    }
+                    hdf5::detail::scatter(reinterpret_cast<const std::byte*>(src.data()), layout,
+                                          part, reinterpret_cast<std::byte*>(dest.data()),
+                                          sizeof(std::uint32_t));
+                }
+            }
+        }
+
+        size_t i = 0;
+        std::vector<hsize_t> coord(3);
+        for (auto z = box.first[0]; z < box.first[0] + box.count[0]; ++z) {
+            for (auto y = box.first[1]; y < box.first[1] + box.count[1]; ++y) {
+                for (auto x = box.first[2]; x < box.first[2] + box.count[2]; ++x, ++i) {
+                    coord = {start[0] + z * stride[0], start[1] + y * stride[1],
+                             start[2] + x * stride[2]};
+                    EXPECT_EQ(value(coord), dest[i]) << "at " << z << ", " << y << ", " << x;
+                }
+            }
+        }
+    };
+
+    test(hdf5::detail::Box{{0, 0, 0}, {5, 4, 3}});
+    test(hdf5::detail::Box{{1, 1, 0}, {3, 2, 3}});
+    test(hdf5::detail::Box{{2, 3, 2}, {1, 1, 1}});
+}
+
+}  // namespace inviwo
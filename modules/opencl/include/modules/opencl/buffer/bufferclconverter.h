@@ -39,6 +39,7 @@ namespace inviwo {
 class IVW_MODULE_OPENCL_API BufferRAM2CLConverter
     : public RepresentationConverterType<BufferRepresentation, BufferRAM, BufferCL> {
 public:
+    virtual double getCost() const override { return convertercost::upload; }
     virtual std::shared_ptr<BufferCL> createFrom(
         std::shared_ptr<const BufferRAM> source) const override;
     virtual void update(std::shared_ptr<const BufferRAM> source,
@@ -48,6 +49,7 @@ public:
 class IVW_MODULE_OPENCL_API BufferCL2RAMConverter
     : public RepresentationConverterType<BufferRepresentation, BufferCL, BufferRAM> {
 public:
+    virtual double getCost() const override { return convertercost::download; }
     virtual std::shared_ptr<BufferRAM> createFrom(
         std::shared_ptr<const BufferCL> source) const override;
     virtual void update(std::shared_ptr<const BufferCL> source,
@@ -40,6 +40,7 @@ namespace inviwo {
 class IVW_MODULE_OPENCL_API BufferCLGL2RAMConverter
     : public RepresentationConverterType<BufferRepresentation, BufferCLGL, BufferRAM> {
 public:
+    virtual double getCost() const override { return convertercost::download; }
     virtual std::shared_ptr<BufferRAM> createFrom(
         std::shared_ptr<const BufferCLGL> source) const override;
     virtual void update(std::shared_ptr<const BufferCLGL> source,
@@ -49,6 +50,7 @@ public:
 class IVW_MODULE_OPENCL_API BufferCLGL2GLConverter
     : public RepresentationConverterType<BufferRepresentation, BufferCLGL, BufferGL> {
 public:
+    virtual double getCost() const override { return convertercost::share; }
     virtual std::shared_ptr<BufferGL> createFrom(
         std::shared_ptr<const BufferCLGL> source) const override;
     virtual void update(std::shared_ptr<const BufferCLGL> source,
@@ -58,6 +60,7 @@ public:
 class IVW_MODULE_OPENCL_API BufferGL2CLGLConverter
     : public RepresentationConverterType<BufferRepresentation, BufferGL, BufferCLGL> {
 public:
+    virtual double getCost() const override { return convertercost::share; }
     virtual std::shared_ptr<BufferCLGL> createFrom(
         std::shared_ptr<const BufferGL> source) const override;
     virtual void update(std::shared_ptr<const BufferGL> source,
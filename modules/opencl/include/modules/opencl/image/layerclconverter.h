@@ -41,6 +41,7 @@ namespace inviwo {
 class IVW_MODULE_OPENCL_API LayerRAM2CLConverter
     : public RepresentationConverterType<LayerRepresentation, LayerRAM, LayerCL> {
 public:
+    virtual double getCost() const override { return convertercost::upload; }
     virtual std::shared_ptr<LayerCL> createFrom(
         std::shared_ptr<const LayerRAM> source) const override;
     virtual void update(std::shared_ptr<const LayerRAM> source,
@@ -50,6 +51,7 @@ public:
 class IVW_MODULE_OPENCL_API LayerCL2RAMConverter
     : public RepresentationConverterType<LayerRepresentation, LayerCL, LayerRAM> {
 public:
+    virtual double getCost() const override { return convertercost::download; }
     virtual std::shared_ptr<LayerRAM> createFrom(
         std::shared_ptr<const LayerCL> source) const override;
     virtual void update(std::shared_ptr<const LayerCL> source,
@@ -41,6 +41,7 @@ namespace inviwo {
 class IVW_MODULE_OPENCL_API LayerCLGL2RAMConverter
     : public RepresentationConverterType<LayerRepresentation, LayerCLGL, LayerRAM> {
 public:
+    virtual double getCost() const override { return convertercost::download; }
     virtual std::shared_ptr<LayerRAM> createFrom(
         std::shared_ptr<const LayerCLGL> source) const override;
     virtual void update(std::shared_ptr<const LayerCLGL> source,
@@ -50,6 +51,7 @@ public:
 class IVW_MODULE_OPENCL_API LayerCLGL2GLConverter
     : public RepresentationConverterType<LayerRepresentation, LayerCLGL, LayerGL> {
 public:
+    virtual double getCost() const override { return convertercost::share; }
     virtual std::shared_ptr<LayerGL> createFrom(
         std::shared_ptr<const LayerCLGL> source) const override;
     virtual void update(std::shared_ptr<const LayerCLGL> source,
@@ -68,6 +70,7 @@ public:
 class IVW_MODULE_OPENCL_API LayerGL2CLGLConverter
     : public RepresentationConverterType<LayerRepresentation, LayerGL, LayerCLGL> {
 public:
+    virtual double getCost() const override { return convertercost::share; }
     virtual std::shared_ptr<LayerCLGL> createFrom(
         std::shared_ptr<const LayerGL> source) const override;
     virtual void update(std::shared_ptr<const LayerGL> source,
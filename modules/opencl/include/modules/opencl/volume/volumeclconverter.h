@@ -41,6 +41,7 @@ namespace inviwo {
 class IVW_MODULE_OPENCL_API VolumeRAM2CLConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeRAM, VolumeCL> {
 public:
+    virtual double getCost() const override { return convertercost::upload; }
     virtual std::shared_ptr<VolumeCL> createFrom(
         std::shared_ptr<const VolumeRAM> source) const override;
     virtual void update(std::shared_ptr<const VolumeRAM> source,
@@ -50,6 +51,7 @@ public:
 class IVW_MODULE_OPENCL_API VolumeCL2RAMConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeCL, VolumeRAM> {
 public:
+    virtual double getCost() const override { return convertercost::download; }
     virtual std::shared_ptr<VolumeRAM> createFrom(
         std::shared_ptr<const VolumeCL> source) const override;
     virtual void update(std::shared_ptr<const VolumeCL> source,
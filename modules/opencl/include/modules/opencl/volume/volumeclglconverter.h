@@ -43,6 +43,7 @@ namespace inviwo {
 class IVW_MODULE_OPENCL_API VolumeCLGL2RAMConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeCLGL, VolumeRAM> {
 public:
+    virtual double getCost() const override { return convertercost::download; }
     virtual std::shared_ptr<VolumeRAM> createFrom(
         std::shared_ptr<const VolumeCLGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeCLGL> source,
@@ -52,6 +53,7 @@ public:
 class IVW_MODULE_OPENCL_API VolumeGL2CLGLConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeGL, VolumeCLGL> {
 public:
+    virtual double getCost() const override { return convertercost::share; }
     virtual std::shared_ptr<VolumeCLGL> createFrom(
         std::shared_ptr<const VolumeGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeGL> source,
@@ -70,6 +72,7 @@ public:
 class IVW_MODULE_OPENCL_API VolumeCLGL2GLConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeCLGL, VolumeGL> {
 public:
+    virtual double getCost() const override { return convertercost::share; }
     virtual std::shared_ptr<VolumeGL> createFrom(
         std::shared_ptr<const VolumeCLGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeCLGL> source,
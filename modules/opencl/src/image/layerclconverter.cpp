@@ -60,8 +60,8 @@ std::shared_ptr<LayerRAM> LayerCL2RAMConverter::createFrom(
     std::shared_ptr<const LayerCL> layerCL) const {
     uvec2 dimensions = layerCL->getDimensions();
     auto destination = createLayerRAM(dimensions, layerCL->getLayerType(), layerCL->getDataFormat(),
-                                      layerCL->getSwizzleMask(), layerCL->getInterpolation(),
-                                      layerCL->getWrapping());
+                                      RAMAllocation::uninitialized(), layerCL->getSwizzleMask(),
+                                      layerCL->getInterpolation(), layerCL->getWrapping());
 
     if (destination) {
         layerCL->download(destination->getData());
@@ -39,8 +39,9 @@ std::shared_ptr<LayerRAM> LayerCLGL2RAMConverter::createFrom(
     std::shared_ptr<const LayerCLGL> layerCLGL) const {
     uvec2 dimensions = layerCLGL->getDimensions();
     auto destination = createLayerRAM(dimensions, layerCLGL->getLayerType(),
-                                      layerCLGL->getDataFormat(), layerCLGL->getSwizzleMask(),
-                                      layerCLGL->getInterpolation(), layerCLGL->getWrapping());
+                                      layerCLGL->getDataFormat(), RAMAllocation::uninitialized(),
+                                      layerCLGL->getSwizzleMask(), layerCLGL->getInterpolation(),
+                                      layerCLGL->getWrapping());
 
     if (destination) {
         layerCLGL->getTexture()->download(destination->getData());
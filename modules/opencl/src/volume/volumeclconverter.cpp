@@ -57,8 +57,9 @@ std::shared_ptr<VolumeRAM> VolumeCL2RAMConverter::createFrom(
     std::shared_ptr<const VolumeCL> volumeCL) const {
     size3_t dimensions = volumeCL->getDimensions();
     auto destination =
-        createVolumeRAM(dimensions, volumeCL->getDataFormat(), nullptr, volumeCL->getSwizzleMask(),
-                        volumeCL->getInterpolation(), volumeCL->getWrapping());
+        createVolumeRAM(dimensions, volumeCL->getDataFormat(), RAMAllocation::uninitialized(),
+                        volumeCL->getSwizzleMask(), volumeCL->getInterpolation(),
+                        volumeCL->getWrapping());
 
     if (destination) {
         volumeCL->download(destination->getData());
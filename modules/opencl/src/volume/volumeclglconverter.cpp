@@ -38,7 +38,8 @@ namespace inviwo {
 std::shared_ptr<VolumeRAM> VolumeCLGL2RAMConverter::createFrom(
     std::shared_ptr<const VolumeCLGL> volumeCLGL) const {
     const size3_t dimensions{volumeCLGL->getDimensions()};
-    auto destination = createVolumeRAM(dimensions, volumeCLGL->getDataFormat(), nullptr,
+    auto destination = createVolumeRAM(dimensions, volumeCLGL->getDataFormat(),
+                                       RAMAllocation::uninitialized(),
                                        volumeCLGL->getSwizzleMask(), volumeCLGL->getInterpolation(),
                                        volumeCLGL->getWrapping());
 
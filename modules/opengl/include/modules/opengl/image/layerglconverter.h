@@ -43,6 +43,7 @@ class LayerRepresentation;
 class IVW_MODULE_OPENGL_API LayerRAM2GLConverter
     : public RepresentationConverterType<LayerRepresentation, LayerRAM, LayerGL> {
 public:
+    virtual double getCost() const override { return convertercost::upload; }
     virtual std::shared_ptr<LayerGL> createFrom(
         std::shared_ptr<const LayerRAM> source) const override;
     virtual void update(std::shared_ptr<const LayerRAM> source,
@@ -52,6 +53,7 @@ public:
 class IVW_MODULE_OPENGL_API LayerGL2RAMConverter
     : public RepresentationConverterType<LayerRepresentation, LayerGL, LayerRAM> {
 public:
+    virtual double getCost() const override { return convertercost::download; }
     virtual std::shared_ptr<LayerRAM> createFrom(
         std::shared_ptr<const LayerGL> source) const override;
     virtual void update(std::shared_ptr<const LayerGL> source,
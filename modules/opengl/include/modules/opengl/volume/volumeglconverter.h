@@ -43,6 +43,7 @@ class VolumeRepresentation;
 class IVW_MODULE_OPENGL_API VolumeRAM2GLConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeRAM, VolumeGL> {
 public:
+    virtual double getCost() const override { return convertercost::upload; }
     virtual std::shared_ptr<VolumeGL> createFrom(
         std::shared_ptr<const VolumeRAM> source) const override;
     virtual void update(std::shared_ptr<const VolumeRAM> source,
@@ -52,6 +53,7 @@ public:
 class IVW_MODULE_OPENGL_API VolumeGL2RAMConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeGL, VolumeRAM> {
 public:
+    virtual double getCost() const override { return convertercost::download; }
     virtual std::shared_ptr<VolumeRAM> createFrom(
         std::shared_ptr<const VolumeGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeGL> source,
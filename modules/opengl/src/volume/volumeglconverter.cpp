@@ -61,9 +61,9 @@ void VolumeRAM2GLConverter::update(std::shared_ptr<const VolumeRAM> volumeSrc,
 
 std::shared_ptr<VolumeRAM> VolumeGL2RAMConverter::createFrom(
     std::shared_ptr<const VolumeGL> volumeGL) const {
-    auto volume = createVolumeRAM(volumeGL->getDimensions(), volumeGL->getDataFormat(), nullptr,
-                                  volumeGL->getSwizzleMask(), volumeGL->getInterpolation(),
-                                  volumeGL->getWrapping());
+    auto volume = createVolumeRAM(volumeGL->getDimensions(), volumeGL->getDataFormat(),
+                                  RAMAllocation::uninitialized(), volumeGL->getSwizzleMask(),
+                                  volumeGL->getInterpolation(), volumeGL->getWrapping());
 
     if (volume) {
         volumeGL->getTexture()->download(volume->getData());
@@ -41,6 +41,7 @@ namespace inviwo {
 class IVW_MODULE_PYTHON3GL_API VolumeGL2PyConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumeGL, VolumePy> {
 public:
+    virtual double getCost() const override { return convertercost::download; }
     virtual std::shared_ptr<VolumePy> createFrom(
         std::shared_ptr<const VolumeGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeGL> source,
@@ -50,6 +51,7 @@ public:
 class IVW_MODULE_PYTHON3GL_API VolumePy2GLConverter
     : public RepresentationConverterType<VolumeRepresentation, VolumePy, VolumeGL> {
 public:
+    virtual double getCost() const override { return convertercost::upload; }
     virtual std::shared_ptr<VolumeGL> createFrom(
         std::shared_ptr<const VolumePy> source) const override;
     virtual void update(std::shared_ptr<const VolumePy> source,
@@ -117,18 +117,23 @@ void DiscardShortLines::process() {
     auto& outLines = *outLinesData;
     auto& filteredLines = *filteredLinesData;
 
+    // Only collect the lines for the outports that are used
+    const bool keepLines = linesOut_.isConsumed();
+    const bool keepRemoved = removedLines_.isConsumed();
+
     for (const auto& line : lines) {
         bool keep = line.getLength() >= minLength_.get();
 
-        if (keep) {
+        if (keep && keepLines) {
             outLines.push_back(line, IntegralLineSet::SetIndex::No);
-        } else {
+        } else if (!keep && keepRemoved) {
             filteredLines.push_back(line, IntegralLineSet::SetIndex::No);
         }
     }
 
-    linesOut_.setData(outLinesData);
-    removedLines_.setData(filteredLinesData);
+    // The outports that are not used keep their last data
+    if (keepLines) linesOut_.setData(outLinesData);
+    if (keepRemoved) removedLines_.setData(filteredLinesData);
 }
 
 }  // namespace inviwo
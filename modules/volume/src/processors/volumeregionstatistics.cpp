@@ -256,8 +256,8 @@ struct StatsFunctor {
     const size_t channels;
     std::shared_ptr<DataFrame> df;
 
-    const VolumeRAM* volumeRep;
-    const VolumeRAM* atlasRep;
+    std::shared_ptr<const VolumeRAM> volumeRep;
+    std::shared_ptr<const VolumeRAM> atlasRep;
     const DataMapper map;
 
     const dvec3 dim;
@@ -279,8 +279,8 @@ struct StatsFunctor {
         , minRegionId{static_cast<size_t>(atlas.dataMap_.dataRange.x)}
         , channels{volume.getDataFormat()->getComponents()}
         , df{std::make_shared<DataFrame>(static_cast<uint32_t>(nRegions))}
-        , volumeRep{volume.getRepresentation<VolumeRAM>()}
-        , atlasRep{atlas.getRepresentation<VolumeRAM>()}
+        , volumeRep{volume.getRepresentationShared<VolumeRAM>()}
+        , atlasRep{atlas.getRepresentationShared<VolumeRAM>()}
         , map{volume.dataMap_}
         , dim{static_cast<dvec3>(volume.getDimensions())}
         , data2dest{volume.getCoordinateTransformer().getMatrix(CoordinateSpace::Data, destSpace)}
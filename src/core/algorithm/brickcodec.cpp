@@ -0,0 +1,272 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/algorithm/brickcodec.h>
+
+#include <inviwo/core/util/exception.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace inviwo {
+
+namespace util {
+
+namespace {
+
+constexpr size_t minMatch = 4;
+constexpr size_t maxOffset = 65535;
+constexpr size_t hashBits = 12;
+
+enum class BrickMode : unsigned char { Raw = 0, DeltaLZ = 1 };
+
+[[noreturn]] void corrupt() {
+    throw Exception(IVW_CONTEXT_CUSTOM("util::decompressLZ"), "Corrupt compressed data");
+}
+
+template <typename U>
+U load(const std::byte* p) {
+    U value;
+    std::memcpy(&value, p, sizeof(U));
+    return value;
+}
+
+template <typename U>
+void store(std::byte* p, U value) {
+    std::memcpy(p, &value, sizeof(U));
+}
+
+std::uint32_t hash(std::uint32_t value) { return (value * 2654435761u) >> (32 - hashBits); }
+
+void writeLength(std::vector<std::byte>& out, size_t length) {
+    for (; length >= 255; length -= 255) out.push_back(std::byte{255});
+    out.push_back(static_cast<std::byte>(length));
+}
+
+/**
+ * A sequence is a token with the number of literals in the high and the match length in the low
+ * four bits, the literals, a 16-bit little-endian offset, and the match length. Lengths of 15 or
+ * more continue in the following bytes. The last sequence only has literals.
+ */
+void writeSequence(std::vector<std::byte>& out, const std::byte* literals, size_t literalCount,
+                   size_t offset, size_t matchLength) {
+    const size_t length = matchLength > 0 ? matchLength - minMatch : 0;
+    out.push_back(static_cast<std::byte>((std::min<size_t>(literalCount, 15) << 4) |
+                                         std::min<size_t>(length, 15)));
+    if (literalCount >= 15) writeLength(out, literalCount - 15);
+    out.insert(out.end(), literals, literals + literalCount);
+    if (matchLength == 0) return;
+
+    out.push_back(static_cast<std::byte>(offset & 0xff));
+    out.push_back(static_cast<std::byte>(offset >> 8));
+    if (length >= 15) writeLength(out, length - 15);
+}
+
+void appendLZ(std::span<const std::byte> data, std::vector<std::byte>& out) {
+    const std::byte* src = data.data();
+    const size_t size = data.size();
+    // Position + 1 of the last occurrence of each hashed four byte sequence, 0 means none
+    std::vector<size_t> table(size_t{1} << hashBits, 0);
+
+    size_t anchor = 0;
+    size_t pos = 0;
+    while (size >= minMatch && pos <= size - minMatch) {
+        const auto seq = load<std::uint32_t>(src + pos);
+        auto& entry = table[hash(seq)];
+        const size_t candidate = entry;
+        entry = pos + 1;
+        if (candidate != 0 && pos - (candidate - 1) <= maxOffset &&
+            load<std::uint32_t>(src + candidate - 1) == seq) {
+            const size_t match = candidate - 1;
+            size_t length = minMatch;
+            while (pos + length < size && src[match + length] == src[pos + length]) ++length;
+            writeSequence(out, src + anchor, pos - anchor, pos - match, length);
+            pos += length;
+            anchor = pos;
+        } else {
+            ++pos;
+        }
+    }
+    writeSequence(out, src + anchor, size - anchor, 0, 0);
+}
+
+/**
+ * Replace each component by its difference to the same component of the previous voxel, and
+ * store byte b of component i at b * count + i.
+ */
+template <typename U>
+void deltaShuffle(const std::byte* src, std::byte* dst, size_t count, size_t components) {
+    for (size_t i = 0; i < count; ++i) {
+        const U prev = i >= components ? load<U>(src + (i - components) * sizeof(U)) : U{0};
+        const auto diff = static_cast<U>(load<U>(src + i * sizeof(U)) - prev);
+        for (size_t b = 0; b < sizeof(U); ++b) {
+            dst[b * count + i] = static_cast<std::byte>((diff >> (8 * b)) & 0xff);
+        }
+    }
+}
+
+template <typename U>
+void unshuffleDelta(const std::byte* src, std::byte* dst, size_t count, size_t components) {
+    for (size_t i = 0; i < count; ++i) {
+        U diff{0};
+        for (size_t b = 0; b < sizeof(U); ++b) {
+            diff |= static_cast<U>(static_cast<U>(std::to_integer<unsigned>(src[b * count + i]))
+                                   << (8 * b));
+        }
+        const U prev = i >= components ? load<U>(dst + (i - components) * sizeof(U)) : U{0};
+        store<U>(dst + i * sizeof(U), static_cast<U>(diff + prev));
+    }
+}
+
+template <typename F>
+void dispatchComponentSize(size_t componentSize, size_t components, size_t bytes, F&& func) {
+    switch (componentSize) {
+        case 2:
+            return func(std::uint16_t{}, bytes / 2, components);
+        case 4:
+            return func(std::uint32_t{}, bytes / 4, components);
+        case 8:
+            return func(std::uint64_t{}, bytes / 8, components);
+        default:
+            // Difference whole voxels byte by byte
+            return func(std::uint8_t{}, bytes, components * componentSize);
+    }
+}
+
+}  // namespace
+
+std::vector<std::byte> compressLZ(std::span<const std::byte> data) {
+    std::vector<std::byte> out;
+    out.reserve(data.size() / 4 + 16);
+    appendLZ(data, out);
+    return out;
+}
+
+void decompressLZ(std::span<const std::byte> compressed, std::span<std::byte> data) {
+    const std::byte* in = compressed.data();
+    const std::byte* const inEnd = in + compressed.size();
+    std::byte* out = data.data();
+    std::byte* const outEnd = out + data.size();
+
+    const auto readLength = [&](size_t length) {
+        if (length != 15) return length;
+        for (;;) {
+            if (in == inEnd) corrupt();
+            const auto extra = std::to_integer<size_t>(*in++);
+            length += extra;
+            if (extra != 255) return length;
+        }
+    };
+
+    for (;;) {
+        if (in == inEnd) corrupt();
+        const auto token = std::to_integer<size_t>(*in++);
+
+        const size_t literals = readLength(token >> 4);
+        if (literals > static_cast<size_t>(inEnd - in) ||
+            literals > static_cast<size_t>(outEnd - out)) {
+            corrupt();
+        }
+        out = std::copy_n(in, literals, out);
+        in += literals;
+        if (in == inEnd) break;
+
+        if (inEnd - in < 2) corrupt();
+        const size_t offset =
+            std::to_integer<size_t>(in[0]) | (std::to_integer<size_t>(in[1]) << 8);
+        in += 2;
+        const size_t length = readLength(token & 15) + minMatch;
+        if (offset == 0 || offset > static_cast<size_t>(out - data.data()) ||
+            length > static_cast<size_t>(outEnd - out)) {
+            corrupt();
+        }
+        const std::byte* match = out - offset;
+        if (offset >= length) {
+            out = std::copy_n(match, length, out);
+        } else {
+            // Overlapping match, i.e. a repeating pattern
+            for (size_t i = 0; i < length; ++i) *out++ = match[i];
+        }
+    }
+    if (out != outEnd) corrupt();
+}
+
+std::vector<std::byte> compressBrick(std::span<const std::byte> data, size_t componentSize,
+                                     size_t components) {
+    if (componentSize == 0 || components == 0 || data.size() % (componentSize * components) != 0) {
+        throw Exception(IVW_CONTEXT_CUSTOM("util::compressBrick"),
+                        "Size {} is not a multiple of the voxel size {}", data.size(),
+                        componentSize * components);
+    }
+
+    std::vector<std::byte> shuffled(data.size());
+    dispatchComponentSize(componentSize, components, data.size(),
+                          [&]<typename U>(U, size_t count, size_t stride) {
+                              deltaShuffle<U>(data.data(), shuffled.data(), count, stride);
+                          });
+
+    std::vector<std::byte> out;
+    out.reserve(data.size() / 4 + 16);
+    out.push_back(static_cast<std::byte>(BrickMode::DeltaLZ));
+    appendLZ(shuffled, out);
+
+    if (out.size() > data.size()) {
+        out.assign(1, static_cast<std::byte>(BrickMode::Raw));
+        out.insert(out.end(), data.begin(), data.end());
+    }
+    out.shrink_to_fit();
+    return out;
+}
+
+void decompressBrick(std::span<const std::byte> compressed, std::span<std::byte> data,
+                     size_t componentSize, size_t components) {
+    if (compressed.empty()) corrupt();
+    const auto mode = static_cast<BrickMode>(std::to_integer<unsigned char>(compressed.front()));
+    const auto payload = compressed.subspan(1);
+
+    if (mode == BrickMode::Raw) {
+        if (payload.size() != data.size()) corrupt();
+        std::copy(payload.begin(), payload.end(), data.begin());
+    } else if (mode == BrickMode::DeltaLZ) {
+        std::vector<std::byte> shuffled(data.size());
+        decompressLZ(payload, shuffled);
+        dispatchComponentSize(componentSize, components, data.size(),
+                              [&]<typename U>(U, size_t count, size_t stride) {
+                                  unshuffleDelta<U>(shuffled.data(), data.data(), count, stride);
+                              });
+    } else {
+        corrupt();
+    }
+}
+
+}  // namespace util
+
+}  // namespace inviwo
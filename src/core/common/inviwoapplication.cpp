@@ -32,6 +32,8 @@
 #include <inviwo/core/common/moduleaction.h>
 #include <inviwo/core/inviwocommondefines.h>
 #include <inviwo/core/datastructures/camera/camerafactory.h>
+#include <inviwo/core/datastructures/idlecompressionmanager.h>
+#include <inviwo/core/datastructures/residencymanager.h>
 #include <inviwo/core/interaction/pickingmanager.h>
 #include <inviwo/core/io/datareaderfactory.h>
 #include <inviwo/core/io/datawriterfactory.h>
@@ -69,10 +71,14 @@
 #include <inviwo/core/util/timer.h>
 #include <inviwo/core/util/settings/systemsettings.h>
 #include <inviwo/core/util/commandlineparser.h>
+#include <inviwo/core/util/networktraceobserver.h>
+#include <inviwo/core/util/profiler.h>
+#include <inviwo/core/util/tracerecorder.h>
 
 #include <inviwo/core/resourcemanager/resourcemanagerobserver.h>
 
 #include <chrono>
+#include <sstream>
 
 namespace inviwo {
 
@@ -180,6 +186,37 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
         resourceManager_->setEnabled(false);
     }
 
+    const auto updateEvaluationMode = [this]() {
+        processorNetworkEvaluator_->setEvaluationMode(systemSettings_->parallelEvaluation_
+                                                          ? EvaluationMode::Parallel
+                                                          : EvaluationMode::Serial);
+    };
+    updateEvaluationMode();
+    systemSettings_->parallelEvaluation_.onChange(updateEvaluationMode);
+
+    const auto updateMemoryBudget = [this]() {
+        ResidencyManager::setBudget(systemSettings_->memoryBudget_.get() * 1024 * 1024);
+    };
+    updateMemoryBudget();
+    systemSettings_->memoryBudget_.onChange(updateMemoryBudget);
+
+    const auto updateIdleCompression = [this]() {
+        IdleCompressionManager::setIdleEpochs(systemSettings_->idleCompression_.get());
+    };
+    updateIdleCompression();
+    systemSettings_->idleCompression_.onChange(updateIdleCompression);
+
+    if (commandLineParser_->getProfile()) {
+        Profiler::setEnabled(true);
+    }
+
+    if (commandLineParser_->getTrace()) {
+        TraceRecorder::setThreadName("Main Thread");
+        TraceRecorder::setEnabled(true);
+        networkTraceObserver_ = std::make_unique<NetworkTraceObserver>(
+            processorNetwork_.get(), processorNetworkEvaluator_.get());
+    }
+
     moduleManager_.onModulesDidRegister([this]() {
         if (resourceManager_->isEnabled() && resourceManager_->numberOfResources() > 0) {
             LogWarn(
@@ -233,7 +270,31 @@ InviwoApplication::InviwoApplication() : InviwoApplication(0, nullptr, "Inviwo")
 InviwoApplication::InviwoApplication(std::string_view displayName)
     : InviwoApplication(0, nullptr, displayName) {}
 
-InviwoApplication::~InviwoApplication() { resizePool(0); }
+InviwoApplication::~InviwoApplication() {
+    resizePool(0);
+
+    if (commandLineParser_->getProfile()) {
+        std::stringstream ss;
+        Profiler::dump(ss);
+        LogInfo("Profiler timings:\n" << ss.str());
+    }
+
+    if (commandLineParser_->getTrace()) {
+        TraceRecorder::setEnabled(false);
+        auto filename = commandLineParser_->getTraceFileName();
+        if (!filesystem::isAbsolutePath(filename)) {
+            auto outputDir = commandLineParser_->getOutputPath();
+            filename = (!outputDir.empty() ? outputDir : filesystem::getWorkingDirectory()) + "/" +
+                       filename;
+        }
+        try {
+            TraceRecorder::write(filename);
+            LogInfo("Wrote trace to " << filename);
+        } catch (const Exception& e) {
+            LogError(e.getMessage());
+        }
+    }
+}
 
 void InviwoApplication::registerModules(
     std::vector<std::unique_ptr<InviwoModuleFactoryObject>> moduleFactories) {
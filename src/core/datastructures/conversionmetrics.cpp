@@ -0,0 +1,120 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/datastructures/conversionmetrics.h>
+
+#include <inviwo/core/util/demangle.h>
+#include <inviwo/core/util/formatconversion.h>
+#include <inviwo/core/util/stdextensions.h>
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+namespace inviwo {
+
+namespace {
+
+struct State {
+    std::mutex mutex;
+    std::unordered_map<ConversionMetrics::ConverterID, ConversionMetrics::Entry> entries;
+};
+
+State& state() {
+    static State state;
+    return state;
+}
+
+}  // namespace
+
+void ConversionMetrics::record(ConverterID id, size_t bytes, std::chrono::nanoseconds time) {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    auto it = s.entries.try_emplace(id, Entry{id.first, id.second}).first;
+    ++it->second.count;
+    it->second.bytes += bytes;
+    it->second.time += time;
+}
+
+auto ConversionMetrics::get() -> std::vector<Entry> {
+    std::vector<Entry> res;
+    {
+        auto& s = state();
+        std::scoped_lock lock{s.mutex};
+        res.reserve(s.entries.size());
+        std::transform(s.entries.begin(), s.entries.end(), std::back_inserter(res),
+                       [](const auto& item) { return item.second; });
+    }
+    std::sort(res.begin(), res.end(),
+              [](const Entry& a, const Entry& b) { return a.time > b.time; });
+    return res;
+}
+
+auto ConversionMetrics::get(ConverterID id) -> Entry {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    if (auto it = s.entries.find(id); it != s.entries.end()) {
+        return it->second;
+    } else {
+        return Entry{id.first, id.second};
+    }
+}
+
+size_t ConversionMetrics::getCount() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    size_t count = 0;
+    for (const auto& item : s.entries) count += item.second.count;
+    return count;
+}
+
+void ConversionMetrics::reset() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    s.entries.clear();
+}
+
+std::string ConversionMetrics::report() {
+    auto buff = fmt::memory_buffer();
+    fmt::format_to(std::back_inserter(buff), "{:30} {:30} {:>8} {:>12} {:>12}\n", "From", "To",
+                   "Count", "Bytes", "Time (ms)");
+    for (const auto& entry : get()) {
+        fmt::format_to(std::back_inserter(buff), "{:30} {:30} {:>8} {:>12} {:>12.3f}\n",
+                       util::demangle(entry.from.name()), util::demangle(entry.to.name()),
+                       entry.count, util::formatBytesToString(entry.bytes),
+                       std::chrono::duration<double, std::milli>(entry.time).count());
+    }
+    return std::string(buff.data(), buff.size());
+}
+
+}  // namespace inviwo
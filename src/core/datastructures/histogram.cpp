@@ -102,6 +102,9 @@ double& NormalizedHistogram::operator[](size_t i) { return data_[i]; }
 
 const double& NormalizedHistogram::operator[](size_t i) const { return data_[i]; }
 
+HistogramContainer::HistogramContainer(std::vector<NormalizedHistogram> histograms)
+    : histograms_{std::move(histograms)} {}
+
 size_t HistogramContainer::size() const { return histograms_.size(); }
 
 bool HistogramContainer::empty() const { return histograms_.empty(); }
@@ -30,8 +30,8 @@
 #include <inviwo/core/datastructures/histogramtools.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/common/inviwoapplication.h>
-
-#include <glm/gtx/component_wise.hpp>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/threadutil.h>
 
 namespace inviwo {
 
@@ -57,25 +57,49 @@ HistogramSupplier& HistogramSupplier::operator=(const HistogramSupplier& that) {
 
 std::shared_ptr<HistogramCalculationState> HistogramSupplier::startCalculation(
     std::shared_ptr<const VolumeRAM> volumeRam, dvec2 dataRange, size_t bins) const {
+    return startCalculation(
+        [volumeRam, dataRange, bins](const CancellationToken& token) {
+            return volumeRam->dispatch<HistogramContainer>([&](auto vr) {
+                using T = util::PrecisionValueType<decltype(vr)>;
+                HistogramAccumulator<T> acc{dataRange, bins};
+                const auto dims = vr->getDimensions();
+                const auto layer = dims.x * dims.y;
+                const auto* data = vr->getDataTyped();
+                // Add one slice at a time to stop early when cancelled
+                for (size_t z = 0; z < dims.z; ++z) {
+                    if (token.isCancelled()) return HistogramContainer{};
+                    acc.add(data + z * layer, data + (z + 1) * layer);
+                }
+                return acc.finish();
+            });
+        },
+        dataRange, bins);
+}
+
+std::shared_ptr<HistogramCalculationState> HistogramSupplier::startCalculation(
+    std::function<HistogramContainer(const CancellationToken&)> calculate, dvec2 dataRange,
+    size_t bins) const {
     if (!calculation_ || calculation_->getBins() != bins ||
         calculation_->getDataRange() != dataRange) {
 
         histograms_ = std::make_shared<HistogramContainer>();
         calculation_ = std::make_shared<HistogramCalculationState>(histograms_, bins, dataRange);
 
-        dispatchPool([weakState = std::weak_ptr<HistogramCalculationState>(calculation_),
-                      stop = calculation_->stop_, volumeRam, dataRange, bins]() {
-            auto histograms = volumeRam->dispatch<HistogramContainer>([&](auto vr) {
-                return HistogramContainer(dataRange, bins, vr->getDataTyped(),
-                                          vr->getDataTyped() + glm::compMul(vr->getDimensions()));
-            });
-            if (*stop) return;
-            dispatchFrontAndForget([hist = std::move(histograms), weakState]() {
-                if (auto s = weakState.lock()) {
-                    done(s, std::move(hist));
-                }
+        // Histograms are never urgent, don't let them delay other work in the pool
+        util::dispatchPool(
+            TaskPriority::Background, calculation_->stop_.getToken(),
+            [weakState = std::weak_ptr<HistogramCalculationState>(calculation_),
+             calculate = std::move(calculate)]() {
+                const auto& stop = ThreadPool::currentToken();
+                if (stop.isCancelled()) return;
+                auto histograms = calculate(stop);
+                if (stop.isCancelled()) return;
+                dispatchFrontAndForget([hist = std::move(histograms), weakState]() {
+                    if (auto s = weakState.lock()) {
+                        done(s, std::move(hist));
+                    }
+                });
             });
-        });
     }
     return calculation_;
 }
@@ -0,0 +1,242 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/datastructures/idlecompressionmanager.h>
+
+#include <inviwo/core/util/demangle.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+using Usage = RepresentationUsage;
+
+struct Entry {
+    std::shared_ptr<Usage::Record> record;
+    IdleCompressionManager::Compress compress;
+};
+
+struct Candidate {
+    const void* owner;
+    std::type_index type;
+    std::type_index compressed;
+    IdleCompressionManager::Compress compress;
+};
+
+struct State {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::unordered_map<std::type_index, std::type_index> types;
+    std::unordered_map<std::pair<const void*, std::type_index>, Entry> entries;
+    size_t compressions = 0;
+    // Whether a compression is running, and the owner it is currently compressing
+    bool running = false;
+    const void* compressing = nullptr;
+};
+
+State& state() {
+    static State state;
+    return state;
+}
+
+std::atomic<size_t> idleEpochs{0};
+std::atomic<size_t> epoch{0};
+
+void compress(const std::vector<Candidate>& candidates, size_t idleSince) {
+    auto& s = state();
+    for (const auto& candidate : candidates) {
+        {
+            std::scoped_lock lock{s.mutex};
+            // The owner has been removed in the meantime
+            if (!s.entries.contains(std::pair{candidate.owner, candidate.type})) continue;
+            // Keeps remove, and hence the destruction of the owner, waiting until we are done
+            s.compressing = candidate.owner;
+        }
+        bool done = true;
+        try {
+            done = candidate.compress(candidate.owner, candidate.type, candidate.compressed,
+                                      idleSince);
+        } catch (const std::exception& e) {
+            LogErrorCustom("IdleCompressionManager", "Failed to compress representation of type "
+                                                         << util::demangle(candidate.type.name())
+                                                         << ": " << e.what());
+        }
+        {
+            std::scoped_lock lock{s.mutex};
+            s.compressing = nullptr;
+            if (auto it = s.entries.find(std::pair{candidate.owner, candidate.type});
+                done && it != s.entries.end()) {
+                ++s.compressions;
+                it->second.record->compression.state = Usage::State::Unknown;
+                s.entries.erase(it);
+            }
+        }
+        s.cv.notify_all();
+    }
+    {
+        std::scoped_lock lock{s.mutex};
+        s.running = false;
+    }
+    s.cv.notify_all();
+}
+
+}  // namespace
+
+bool IdleCompressionManager::isEnabled() { return idleEpochs.load() != 0; }
+
+void IdleCompressionManager::setIdleEpochs(size_t epochs) { idleEpochs = epochs; }
+
+size_t IdleCompressionManager::getIdleEpochs() { return idleEpochs; }
+
+void IdleCompressionManager::registerCompressedType(std::type_index type,
+                                                    std::type_index compressed) {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    s.types.insert_or_assign(type, compressed);
+}
+
+void IdleCompressionManager::unregisterCompressedType(std::type_index type) {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    s.types.erase(type);
+    for (auto it = s.entries.begin(); it != s.entries.end();) {
+        if (it->first.second == type) {
+            it->second.record->compression.state = Usage::State::Unknown;
+            it = s.entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void IdleCompressionManager::touch(const void* owner, std::type_index type,
+                                   const RepresentationUsage& usage, Compress compress) {
+    if (!isEnabled()) return;
+    auto& stamp = usage.record_->compression;
+    stamp.epoch.store(epoch.load(std::memory_order_relaxed), std::memory_order_release);
+    if (stamp.state.load(std::memory_order_acquire) != Usage::State::Unknown) return;
+
+    // First use of the representation
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    if (!s.types.contains(type)) {
+        stamp.state = Usage::State::Ignored;
+        return;
+    }
+    s.entries.insert_or_assign(std::pair{owner, type}, Entry{usage.record_, compress});
+    stamp.state = Usage::State::Registered;
+}
+
+void IdleCompressionManager::remove(const void* owner) {
+    auto& s = state();
+    std::unique_lock lock{s.mutex};
+    s.cv.wait(lock, [&]() { return s.compressing != owner; });
+    for (auto it = s.entries.begin(); it != s.entries.end();) {
+        if (it->first.first == owner) {
+            it->second.record->compression.state = Usage::State::Unknown;
+            it = s.entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void IdleCompressionManager::nextEpoch() {
+    const auto current = ++epoch;
+    const auto idle = idleEpochs.load();
+    if (idle == 0 || current <= idle) return;
+    const auto idleSince = current - idle;
+
+    auto& s = state();
+    std::vector<Candidate> candidates;
+    {
+        std::scoped_lock lock{s.mutex};
+        if (s.running) return;
+        for (const auto& [key, entry] : s.entries) {
+            if (entry.record->compression.epoch.load(std::memory_order_acquire) < idleSince &&
+                entry.record->pins.load(std::memory_order_acquire) == 0) {
+                candidates.push_back({key.first, key.second, s.types.at(key.second),
+                                      entry.compress});
+            }
+        }
+        if (candidates.empty()) return;
+        s.running = true;
+    }
+
+    // Compress without holding the lock, such that uses and removals are not blocked
+    if (util::getPoolSize() == 0) {
+        compress(candidates, idleSince);
+    } else {
+        util::dispatchPool(
+            TaskPriority::Background,
+            [candidates = std::move(candidates), idleSince]() { compress(candidates, idleSince); });
+    }
+}
+
+void IdleCompressionManager::wait() {
+    auto& s = state();
+    std::unique_lock lock{s.mutex};
+    s.cv.wait(lock, [&]() { return !s.running; });
+}
+
+size_t IdleCompressionManager::size() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    return s.entries.size();
+}
+
+size_t IdleCompressionManager::getCompressions() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    return s.compressions;
+}
+
+void IdleCompressionManager::clear() {
+    wait();
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    for (auto& [key, entry] : s.entries) {
+        entry.record->compression.state = Usage::State::Unknown;
+    }
+    s.entries.clear();
+}
+
+}  // namespace inviwo
@@ -61,6 +61,20 @@ struct LayerRAMCreationDispatcher {
     }
 };
 
+struct LayerRAMAllocationCreationDispatcher {
+    using type = std::shared_ptr<LayerRAM>;
+    template <typename Result, typename T>
+    std::shared_ptr<LayerRAM> operator()(const size2_t& dimensions, LayerType type,
+                                         const RAMAllocation& allocation,
+                                         const SwizzleMask& swizzleMask,
+                                         InterpolationType interpolation,
+                                         const Wrapping2D& wrapping) {
+        using F = typename T::type;
+        return std::make_shared<LayerRAMPrecision<F>>(dimensions, allocation, type, swizzleMask,
+                                                      interpolation, wrapping);
+    }
+};
+
 std::shared_ptr<LayerRAM> createLayerRAM(const size2_t& dimensions, LayerType type,
                                          const DataFormatBase* format,
                                          const SwizzleMask& swizzleMask,
@@ -71,4 +85,16 @@ std::shared_ptr<LayerRAM> createLayerRAM(const size2_t& dimensions, LayerType ty
         format->getId(), disp, dimensions, type, swizzleMask, interpolation, wrapping);
 }
 
+std::shared_ptr<LayerRAM> createLayerRAM(const size2_t& dimensions, LayerType type,
+                                         const DataFormatBase* format,
+                                         const RAMAllocation& allocation,
+                                         const SwizzleMask& swizzleMask,
+                                         InterpolationType interpolation,
+                                         const Wrapping2D& wrapping) {
+    LayerRAMAllocationCreationDispatcher disp;
+    return dispatching::dispatch<std::shared_ptr<LayerRAM>, dispatching::filter::All>(
+        format->getId(), disp, dimensions, type, allocation, swizzleMask, interpolation,
+        wrapping);
+}
+
 }  // namespace inviwo
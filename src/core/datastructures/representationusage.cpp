@@ -0,0 +1,66 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/datastructures/representationusage.h>
+
+#include <algorithm>
+
+namespace inviwo {
+
+namespace {
+
+RepresentationPins*& current() {
+    static thread_local RepresentationPins* pins = nullptr;
+    return pins;
+}
+
+}  // namespace
+
+RepresentationPins::RepresentationPins() : pinned_{}, outer_{current()} { current() = this; }
+
+RepresentationPins::~RepresentationPins() {
+    for (const auto& record : pinned_) record->pins.fetch_sub(1, std::memory_order_release);
+    current() = outer_;
+}
+
+void RepresentationPins::pin(const RepresentationUsage& usage) {
+    auto* scope = current();
+    if (!scope) return;
+    const auto& record = usage.record_;
+    if (std::find(scope->pinned_.begin(), scope->pinned_.end(), record) != scope->pinned_.end()) {
+        return;
+    }
+    // Callers still hold the representation here, hence the managers will see the pin as soon as
+    // they can see that the representation is unused.
+    record->pins.fetch_add(1, std::memory_order_acq_rel);
+    scope->pinned_.push_back(record);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,183 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/residencymanager.h>
+
+#include <inviwo/core/util/stdextensions.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+using Usage = RepresentationUsage;
+
+struct Entry {
+    std::shared_ptr<Usage::Record> record;
+    ResidencyManager::Evict evict;
+};
+
+struct State {
+    std::mutex mutex;
+    std::unordered_map<std::pair<const void*, std::type_index>, Entry> entries;
+    size_t evictions = 0;
+
+    size_t bytes() const {
+        size_t sum = 0;
+        for (const auto& [key, entry] : entries) {
+            sum += entry.record->bytes.load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    void evict(size_t budget, size_t epoch) {
+        if (budget == 0) return;
+        auto total = bytes();
+        if (total <= budget) return;
+
+        struct Candidate {
+            size_t lastUse;
+            std::pair<const void*, std::type_index> key;
+        };
+        std::vector<Candidate> candidates;
+        for (const auto& [key, entry] : entries) {
+            const auto lastUse = entry.record->residency.epoch.load(std::memory_order_acquire);
+            // Representations used in the current epoch are never evicted
+            if (lastUse < epoch) candidates.push_back({lastUse, key});
+        }
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [](const auto& a, const auto& b) { return a.lastUse < b.lastUse; });
+
+        for (const auto& candidate : candidates) {
+            if (total <= budget) break;
+            const auto it = entries.find(candidate.key);
+            const auto& [key, entry] = *it;
+            if (entry.record->pins.load(std::memory_order_acquire) != 0) continue;
+            if (entry.evict(key.first, key.second, epoch)) {
+                ++evictions;
+                total -= entry.record->bytes.load(std::memory_order_relaxed);
+                entry.record->residency.state = Usage::State::Unknown;
+                entries.erase(it);
+            }
+        }
+    }
+};
+
+State& state() {
+    static State state;
+    return state;
+}
+
+std::atomic<size_t> budget{0};
+std::atomic<size_t> epoch{0};
+
+}  // namespace
+
+bool ResidencyManager::isEnabled() { return budget.load(std::memory_order_relaxed) != 0; }
+
+void ResidencyManager::setBudget(size_t bytes) {
+    budget.store(bytes, std::memory_order_relaxed);
+    enforce();
+}
+
+size_t ResidencyManager::getBudget() { return budget.load(std::memory_order_relaxed); }
+
+size_t ResidencyManager::getResidentBytes() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    return s.bytes();
+}
+
+size_t ResidencyManager::size() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    return s.entries.size();
+}
+
+size_t ResidencyManager::getEvictions() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    return s.evictions;
+}
+
+void ResidencyManager::touch(const void* owner, std::type_index type,
+                             const RepresentationUsage& usage, size_t bytes, Evict evict) {
+    auto& record = *usage.record_;
+    record.bytes.store(bytes, std::memory_order_relaxed);
+    record.residency.epoch.store(epoch.load(std::memory_order_relaxed),
+                                 std::memory_order_release);
+    if (record.residency.state.load(std::memory_order_acquire) != Usage::State::Unknown) return;
+
+    // First use of the representation
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    s.entries.insert_or_assign(std::pair{owner, type}, Entry{usage.record_, evict});
+    record.residency.state = Usage::State::Registered;
+}
+
+void ResidencyManager::remove(const void* owner) {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    for (auto it = s.entries.begin(); it != s.entries.end();) {
+        if (it->first.first == owner) {
+            it->second.record->residency.state = Usage::State::Unknown;
+            it = s.entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ResidencyManager::nextEpoch() {
+    ++epoch;
+    enforce();
+}
+
+void ResidencyManager::enforce() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    s.evict(budget.load(std::memory_order_relaxed), epoch.load());
+}
+
+void ResidencyManager::clear() {
+    auto& s = state();
+    std::scoped_lock lock{s.mutex};
+    for (auto& [key, entry] : s.entries) {
+        entry.record->residency.state = Usage::State::Unknown;
+    }
+    s.entries.clear();
+}
+
+}  // namespace inviwo
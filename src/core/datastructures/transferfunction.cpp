@@ -180,6 +180,8 @@ void TransferFunction::calcTransferValues() const {
     IVW_ASSERT(std::is_sorted(sorted_.begin(), sorted_.end(), comparePtr{}), "Should be sorted");
 
     // We assume the the points a sorted here.
+    // The representation shares its data with the one it was copied from until detached
+    dataRepr_->detach();
     auto dataArray = dataRepr_->getDataTyped();
     const auto size = dataRepr_->getDimensions().x;
 
@@ -28,8 +28,11 @@
  *********************************************************************************/
 
 #include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/util/document.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/volumeslabs.h>
 
 #include <fmt/format.h>
 
@@ -212,6 +215,33 @@ const StructuredCameraCoordinateTransformer<3>& Volume::getCoordinateTransformer
 }
 
 std::shared_ptr<HistogramCalculationState> Volume::calculateHistograms(size_t bins) const {
+    if (util::shouldStreamSlabs(*this)) {
+        // Accumulate the histograms slab by slab, from a volume referring to the same file
+        auto volume = std::make_shared<Volume>(
+            std::shared_ptr<VolumeRepresentation>(getRepresentation<VolumeDisk>()->clone()));
+        const auto dataRange = dataMap_.dataRange;
+        return HistogramSupplier::startCalculation(
+            [volume, dataRange, bins](const CancellationToken& token) {
+                return dispatching::dispatch<HistogramContainer, dispatching::filter::All>(
+                    volume->getDataFormat()->getId(),
+                    [&]<typename Result, typename Format>() -> Result {
+                        using T = typename Format::type;
+                        HistogramAccumulator<T> acc{dataRange, bins};
+                        util::forEachVolumeSlab(
+                            *volume, util::slabDepth(*volume), 0,
+                            [&](const util::VolumeSlab& slab) {
+                                const auto& dims = slab.ram->getDimensions();
+                                const auto layer = dims.x * dims.y;
+                                const auto* data = static_cast<const T*>(slab.ram->getData()) +
+                                                   slab.haloBefore * layer;
+                                acc.add(data, data + slab.depth * layer);
+                            },
+                            token);
+                        return acc.finish();
+                    });
+            },
+            dataMap_.dataRange, bins);
+    }
     return HistogramSupplier::startCalculation(getRepresentationShared<VolumeRAM>(),
                                                dataMap_.dataRange, bins);
 }
@@ -0,0 +1,96 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/volume/volumebrickedram.h>
+
+namespace inviwo {
+
+VolumeBrickedRAM::VolumeBrickedRAM(const DataFormatBase* format, size_t brickSize, size_t apron)
+    : VolumeRepresentation(format), brickSize_{brickSize}, apron_{apron} {
+    IVW_ASSERT(brickSize_ > 0, "Brick size has to be larger than zero");
+}
+
+std::type_index VolumeBrickedRAM::getTypeIndex() const {
+    return std::type_index(typeid(VolumeBrickedRAM));
+}
+
+size3_t VolumeBrickedRAM::getBrickCount() const {
+    return (getDimensions() + size3_t{brickSize_ - 1}) / brickSize_;
+}
+
+size3_t VolumeBrickedRAM::getBrickExtent(const size3_t& brick) const {
+    return glm::min(size3_t{brickSize_}, getDimensions() - getBrickOffset(brick));
+}
+
+struct VolumeBrickedRamCreationDispatcher {
+    using type = std::shared_ptr<VolumeBrickedRAM>;
+    template <typename Result, typename T>
+    std::shared_ptr<VolumeBrickedRAM> operator()(const size3_t& dimensions, size_t brickSize,
+                                                 size_t apron, const SwizzleMask& swizzleMask,
+                                                 InterpolationType interpolation,
+                                                 const Wrapping3D& wrapping) {
+        using F = typename T::type;
+        return std::make_shared<VolumeBrickedRAMPrecision<F>>(dimensions, brickSize, apron,
+                                                              swizzleMask, interpolation, wrapping);
+    }
+
+    template <typename Result, typename T>
+    std::shared_ptr<VolumeBrickedRAM> operator()(const size3_t& dimensions,
+                                                 const RAMAllocation& allocation, size_t brickSize,
+                                                 size_t apron, const SwizzleMask& swizzleMask,
+                                                 InterpolationType interpolation,
+                                                 const Wrapping3D& wrapping) {
+        using F = typename T::type;
+        return std::make_shared<VolumeBrickedRAMPrecision<F>>(
+            dimensions, allocation, brickSize, apron, swizzleMask, interpolation, wrapping);
+    }
+};
+
+std::shared_ptr<VolumeBrickedRAM> createVolumeBrickedRAM(const size3_t& dimensions,
+                                                         const DataFormatBase* format,
+                                                         size_t brickSize, size_t apron,
+                                                         const SwizzleMask& swizzleMask,
+                                                         InterpolationType interpolation,
+                                                         const Wrapping3D& wrapping) {
+    VolumeBrickedRamCreationDispatcher disp;
+    return dispatching::dispatch<std::shared_ptr<VolumeBrickedRAM>, dispatching::filter::All>(
+        format->getId(), disp, dimensions, brickSize, apron, swizzleMask, interpolation, wrapping);
+}
+
+std::shared_ptr<VolumeBrickedRAM> createVolumeBrickedRAM(
+    const size3_t& dimensions, const DataFormatBase* format, const RAMAllocation& allocation,
+    size_t brickSize, size_t apron, const SwizzleMask& swizzleMask,
+    InterpolationType interpolation, const Wrapping3D& wrapping) {
+    VolumeBrickedRamCreationDispatcher disp;
+    return dispatching::dispatch<std::shared_ptr<VolumeBrickedRAM>, dispatching::filter::All>(
+        format->getId(), disp, dimensions, allocation, brickSize, apron, swizzleMask,
+        interpolation, wrapping);
+}
+
+}  // namespace inviwo
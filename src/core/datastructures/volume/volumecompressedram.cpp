@@ -0,0 +1,212 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/datastructures/volume/volumecompressedram.h>
+
+#include <inviwo/core/algorithm/brickcodec.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/assertion.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace inviwo {
+
+namespace {
+
+/**
+ * Call func(brick) for all bricks on the thread pool. Unlike parallelFor no brick is skipped if
+ * the calling task is cancelled.
+ */
+template <typename F>
+void forEachBrick(const size3_t& count, F&& func) {
+    const auto total = glm::compMul(count);
+    const auto call = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            func(size3_t{i % count.x, (i / count.x) % count.y, i / (count.x * count.y)});
+        }
+    };
+    if (total < 2 || util::getPoolSize() == 0) {
+        call(0, total);
+    } else {
+        auto& pool = util::getThreadPool();
+        auto latch = pool.enqueueRange(total, 4 * pool.getSize(), call);
+        pool.wait(*latch);
+        latch->get();
+    }
+}
+
+}  // namespace
+
+VolumeCompressedRAM::VolumeCompressedRAM(size3_t dimensions, const DataFormatBase* format,
+                                         size_t brickSize, const SwizzleMask& swizzleMask,
+                                         InterpolationType interpolation,
+                                         const Wrapping3D& wrapping)
+    : VolumeRepresentation(format)
+    , dimensions_{dimensions}
+    , brickSize_{brickSize}
+    , bricks_(glm::compMul(getBrickCount()))
+    , swizzleMask_{swizzleMask}
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {
+    IVW_ASSERT(brickSize_ > 0, "Brick size has to be larger than zero");
+}
+
+VolumeCompressedRAM::VolumeCompressedRAM(const VolumeRAM& source, size_t brickSize)
+    : VolumeCompressedRAM(source.getDimensions(), source.getDataFormat(), brickSize,
+                          source.getSwizzleMask(), source.getInterpolation(),
+                          source.getWrapping()) {
+    compress(source);
+}
+
+VolumeCompressedRAM* VolumeCompressedRAM::clone() const { return new VolumeCompressedRAM(*this); }
+
+std::type_index VolumeCompressedRAM::getTypeIndex() const {
+    return std::type_index(typeid(VolumeCompressedRAM));
+}
+
+size3_t VolumeCompressedRAM::getBrickCount() const {
+    return (dimensions_ + size3_t{brickSize_ - 1}) / brickSize_;
+}
+
+size3_t VolumeCompressedRAM::getBrickExtent(const size3_t& brick) const {
+    return glm::min(size3_t{brickSize_}, dimensions_ - getBrickOffset(brick));
+}
+
+size_t VolumeCompressedRAM::brickIndex(const size3_t& brick) const {
+    return util::IndexMapper3D{getBrickCount()}(brick);
+}
+
+void VolumeCompressedRAM::compress(const VolumeRAM& source) {
+    IVW_ASSERT(source.getDataFormat() == getDataFormat(), "Format mismatch");
+    IVW_ASSERT(source.getDimensions() == dimensions_, "Dimension mismatch");
+
+    const auto* format = getDataFormat();
+    const auto voxelSize = format->getSize();
+    const auto componentSize = voxelSize / format->getComponents();
+    const auto* src = static_cast<const std::byte*>(source.getData());
+    const util::IndexMapper3D im{dimensions_};
+
+    forEachBrick(getBrickCount(), [&](const size3_t& brick) {
+        const auto offset = getBrickOffset(brick);
+        const auto extent = getBrickExtent(brick);
+        const auto rowBytes = extent.x * voxelSize;
+        std::vector<std::byte> voxels(glm::compMul(extent) * voxelSize);
+        auto* dst = voxels.data();
+        for (size_t z = 0; z < extent.z; ++z) {
+            for (size_t y = 0; y < extent.y; ++y, dst += rowBytes) {
+                std::memcpy(dst, src + im(offset + size3_t{0, y, z}) * voxelSize, rowBytes);
+            }
+        }
+        bricks_[brickIndex(brick)] =
+            util::compressBrick(voxels, componentSize, format->getComponents());
+    });
+}
+
+void VolumeCompressedRAM::decompressBrick(const size3_t& brick, void* dest) const {
+    const auto* format = getDataFormat();
+    const auto voxelSize = format->getSize();
+    const auto bytes = glm::compMul(getBrickExtent(brick)) * voxelSize;
+    const std::span<std::byte> dst{static_cast<std::byte*>(dest), bytes};
+
+    const auto& compressed = bricks_[brickIndex(brick)];
+    if (compressed.empty()) {
+        std::fill(dst.begin(), dst.end(), std::byte{0});
+    } else {
+        util::decompressBrick(compressed, dst, voxelSize / format->getComponents(),
+                              format->getComponents());
+    }
+}
+
+std::span<const std::byte> VolumeCompressedRAM::getCompressedBrick(const size3_t& brick) const {
+    return bricks_[brickIndex(brick)];
+}
+
+void VolumeCompressedRAM::decompress(VolumeRAM& dest) const {
+    IVW_ASSERT(dest.getDataFormat() == getDataFormat(), "Format mismatch");
+    IVW_ASSERT(dest.getDimensions() == dimensions_, "Dimension mismatch");
+
+    const auto voxelSize = getDataFormat()->getSize();
+    auto* dst = static_cast<std::byte*>(dest.getData());
+    const util::IndexMapper3D im{dimensions_};
+
+    forEachBrick(getBrickCount(), [&](const size3_t& brick) {
+        const auto offset = getBrickOffset(brick);
+        const auto extent = getBrickExtent(brick);
+        const auto rowBytes = extent.x * voxelSize;
+        std::vector<std::byte> voxels(glm::compMul(extent) * voxelSize);
+        decompressBrick(brick, voxels.data());
+        const auto* src = voxels.data();
+        for (size_t z = 0; z < extent.z; ++z) {
+            for (size_t y = 0; y < extent.y; ++y, src += rowBytes) {
+                std::memcpy(dst + im(offset + size3_t{0, y, z}) * voxelSize, src, rowBytes);
+            }
+        }
+    });
+}
+
+void VolumeCompressedRAM::setDimensions(size3_t dimensions) {
+    if (dimensions_ != dimensions) {
+        dimensions_ = dimensions;
+        bricks_.assign(glm::compMul(getBrickCount()), {});
+    }
+}
+
+const size3_t& VolumeCompressedRAM::getDimensions() const { return dimensions_; }
+
+void VolumeCompressedRAM::setSwizzleMask(const SwizzleMask& mask) { swizzleMask_ = mask; }
+
+SwizzleMask VolumeCompressedRAM::getSwizzleMask() const { return swizzleMask_; }
+
+void VolumeCompressedRAM::setInterpolation(InterpolationType interpolation) {
+    interpolation_ = interpolation;
+}
+
+InterpolationType VolumeCompressedRAM::getInterpolation() const { return interpolation_; }
+
+void VolumeCompressedRAM::setWrapping(const Wrapping3D& wrapping) { wrapping_ = wrapping; }
+
+Wrapping3D VolumeCompressedRAM::getWrapping() const { return wrapping_; }
+
+size_t VolumeCompressedRAM::getNumberOfBytes() const {
+    size_t bytes = 0;
+    for (const auto& brick : bricks_) bytes += brick.size();
+    return bytes;
+}
+
+size_t VolumeCompressedRAM::getUncompressedNumberOfBytes() const {
+    return glm::compMul(dimensions_) * getDataFormat()->getSize();
+}
+
+}  // namespace inviwo
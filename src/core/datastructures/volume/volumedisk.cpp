@@ -28,6 +28,8 @@
  *********************************************************************************/
 
 #include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/glmfmt.h>
 
 namespace inviwo {
 
@@ -75,4 +77,20 @@ void VolumeDisk::setWrapping(const Wrapping3D& wrapping) { wrapping_ = wrapping;
 
 Wrapping3D VolumeDisk::getWrapping() const { return wrapping_; }
 
+bool VolumeDisk::canReadRegion() const {
+    return dynamic_cast<const VolumeRegionLoader*>(getLoader()) != nullptr;
+}
+
+std::shared_ptr<VolumeRAM> VolumeDisk::readRegion(size3_t offset, size3_t extent) const {
+    const auto* loader = dynamic_cast<const VolumeRegionLoader*>(getLoader());
+    if (!loader) {
+        throw Exception("The loader can not read subregions", IVW_CONTEXT);
+    }
+    if (glm::any(glm::greaterThan(offset + extent, dimensions_))) {
+        throw Exception(IVW_CONTEXT, "Region {} + {} is outside of the volume {}", offset, extent,
+                        dimensions_);
+    }
+    return loader->readRegion(*this, offset, extent);
+}
+
 }  // namespace inviwo
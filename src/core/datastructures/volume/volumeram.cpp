@@ -49,6 +49,35 @@ struct VolumeRamCreationDispatcher {
     }
 };
 
+struct VolumeRamAllocationCreationDispatcher {
+    using type = std::shared_ptr<VolumeRAM>;
+    template <typename Result, typename T>
+    std::shared_ptr<VolumeRAM> operator()(const size3_t& dimensions,
+                                          const RAMAllocation& allocation,
+                                          const SwizzleMask& swizzleMask,
+                                          InterpolationType interpolation,
+                                          const Wrapping3D& wrapping) {
+        using F = typename T::type;
+        return std::make_shared<VolumeRAMPrecision<F>>(dimensions, allocation, swizzleMask,
+                                                       interpolation, wrapping);
+    }
+};
+
+struct VolumeRamStorageCreationDispatcher {
+    using type = std::shared_ptr<VolumeRAM>;
+    template <typename Result, typename T>
+    std::shared_ptr<VolumeRAM> operator()(std::shared_ptr<void> storage, void* dataPtr,
+                                          const size3_t& dimensions,
+                                          const SwizzleMask& swizzleMask,
+                                          InterpolationType interpolation,
+                                          const Wrapping3D& wrapping) {
+        using F = typename T::type;
+        return std::make_shared<VolumeRAMPrecision<F>>(std::move(storage),
+                                                       static_cast<F*>(dataPtr), dimensions,
+                                                       swizzleMask, interpolation, wrapping);
+    }
+};
+
 std::shared_ptr<VolumeRAM> createVolumeRAM(const size3_t& dimensions, const DataFormatBase* format,
                                            void* dataPtr, const SwizzleMask& swizzleMask,
                                            InterpolationType interpolation,
@@ -58,4 +87,25 @@ std::shared_ptr<VolumeRAM> createVolumeRAM(const size3_t& dimensions, const Data
         format->getId(), disp, dataPtr, dimensions, swizzleMask, interpolation, wrapping);
 }
 
+std::shared_ptr<VolumeRAM> createVolumeRAM(const size3_t& dimensions, const DataFormatBase* format,
+                                           const RAMAllocation& allocation,
+                                           const SwizzleMask& swizzleMask,
+                                           InterpolationType interpolation,
+                                           const Wrapping3D& wrapping) {
+    VolumeRamAllocationCreationDispatcher disp;
+    return dispatching::dispatch<std::shared_ptr<VolumeRAM>, dispatching::filter::All>(
+        format->getId(), disp, dimensions, allocation, swizzleMask, interpolation, wrapping);
+}
+
+std::shared_ptr<VolumeRAM> createVolumeRAM(std::shared_ptr<void> storage, void* dataPtr,
+                                           const size3_t& dimensions, const DataFormatBase* format,
+                                           const SwizzleMask& swizzleMask,
+                                           InterpolationType interpolation,
+                                           const Wrapping3D& wrapping) {
+    VolumeRamStorageCreationDispatcher disp;
+    return dispatching::dispatch<std::shared_ptr<VolumeRAM>, dispatching::filter::All>(
+        format->getId(), disp, std::move(storage), dataPtr, dimensions, swizzleMask,
+        interpolation, wrapping);
+}
+
 }  // namespace inviwo
@@ -42,4 +42,74 @@ void VolumeDisk2RAMConverter::update(std::shared_ptr<const VolumeDisk> source,
     source->updateRepresentation(destination);
 }
 
+std::shared_ptr<VolumeBrickedRAM> VolumeRAM2BrickedRAMConverter::createFrom(
+    std::shared_ptr<const VolumeRAM> source) const {
+    auto destination = createVolumeBrickedRAM(
+        source->getDimensions(), source->getDataFormat(), RAMAllocation::uninitialized(),
+        VolumeBrickedRAM::defaultBrickSize, VolumeBrickedRAM::defaultApron,
+        source->getSwizzleMask(), source->getInterpolation(), source->getWrapping());
+    destination->copyFrom(*source);
+    return destination;
+}
+
+void VolumeRAM2BrickedRAMConverter::update(std::shared_ptr<const VolumeRAM> source,
+                                           std::shared_ptr<VolumeBrickedRAM> destination) const {
+    destination->setDimensions(source->getDimensions());
+    destination->copyFrom(*source);
+    destination->setSwizzleMask(source->getSwizzleMask());
+    destination->setInterpolation(source->getInterpolation());
+    destination->setWrapping(source->getWrapping());
+}
+
+std::shared_ptr<VolumeRAM> VolumeBrickedRAM2RAMConverter::createFrom(
+    std::shared_ptr<const VolumeBrickedRAM> source) const {
+    auto destination = createVolumeRAM(source->getDimensions(), source->getDataFormat(),
+                                       RAMAllocation::uninitialized(), source->getSwizzleMask(),
+                                       source->getInterpolation(), source->getWrapping());
+    source->copyTo(*destination);
+    return destination;
+}
+
+void VolumeBrickedRAM2RAMConverter::update(std::shared_ptr<const VolumeBrickedRAM> source,
+                                           std::shared_ptr<VolumeRAM> destination) const {
+    destination->setDimensions(source->getDimensions());
+    source->copyTo(*destination);
+    destination->setSwizzleMask(source->getSwizzleMask());
+    destination->setInterpolation(source->getInterpolation());
+    destination->setWrapping(source->getWrapping());
+}
+
+std::shared_ptr<VolumeCompressedRAM> VolumeRAM2CompressedRAMConverter::createFrom(
+    std::shared_ptr<const VolumeRAM> source) const {
+    return std::make_shared<VolumeCompressedRAM>(*source);
+}
+
+void VolumeRAM2CompressedRAMConverter::update(
+    std::shared_ptr<const VolumeRAM> source,
+    std::shared_ptr<VolumeCompressedRAM> destination) const {
+    destination->setDimensions(source->getDimensions());
+    destination->compress(*source);
+    destination->setSwizzleMask(source->getSwizzleMask());
+    destination->setInterpolation(source->getInterpolation());
+    destination->setWrapping(source->getWrapping());
+}
+
+std::shared_ptr<VolumeRAM> VolumeCompressedRAM2RAMConverter::createFrom(
+    std::shared_ptr<const VolumeCompressedRAM> source) const {
+    auto destination = createVolumeRAM(source->getDimensions(), source->getDataFormat(),
+                                       RAMAllocation::uninitialized(), source->getSwizzleMask(),
+                                       source->getInterpolation(), source->getWrapping());
+    source->decompress(*destination);
+    return destination;
+}
+
+void VolumeCompressedRAM2RAMConverter::update(std::shared_ptr<const VolumeCompressedRAM> source,
+                                              std::shared_ptr<VolumeRAM> destination) const {
+    destination->setDimensions(source->getDimensions());
+    source->decompress(*destination);
+    destination->setSwizzleMask(source->getSwizzleMask());
+    destination->setInterpolation(source->getInterpolation());
+    destination->setWrapping(source->getWrapping());
+}
+
 }  // namespace inviwo
@@ -29,39 +29,311 @@
 
 #include <inviwo/core/io/bytereaderutil.h>
 #include <inviwo/core/io/datareaderexception.h>
-#include <inviwo/core/util/raiiutils.h>
-#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/util/threadutil.h>
 
-#include <fmt/format.h>
+#ifdef WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <inviwo/core/util/stringconversion.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IVW_SWAP_BYTES_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
 
 namespace inviwo {
 
-void util::readBytesIntoBuffer(std::string_view file, size_t offset, size_t bytes,
-                               bool littleEndian, size_t elementSize, void* dest) {
-    auto fin = filesystem::ifstream(file, std::ios::in | std::ios::binary);
-    OnScopeExit close([&fin]() { fin.close(); });
+namespace {
+
+/**
+ * Chunks are large enough to amortize the cost of a read call and small enough to give every
+ * thread of the pool a few of them for a volume of a couple of hundred MB.
+ */
+constexpr size_t chunkBytes = size_t{8} << 20;
+
+/**
+ * A read only file that supports reads at a given offset from several threads at once.
+ */
+class PositionalFile {
+public:
+    explicit PositionalFile(std::string_view file) : file_{file} {
+#ifdef WIN32
+        handle_ = CreateFileW(util::toWstring(file).c_str(), GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (handle_ == INVALID_HANDLE_VALUE) {
+            throw DataReaderException(IVW_CONTEXT_CUSTOM("readBytesIntoBuffer"),
+                                      "Could not open file: {}", file);
+        }
+#else
+        fd_ = ::open(std::string{file}.c_str(), O_RDONLY);
+        if (fd_ == -1) {
+            throw DataReaderException(IVW_CONTEXT_CUSTOM("readBytesIntoBuffer"),
+                                      "Could not open file: {}", file);
+        }
+#endif
+    }
+    PositionalFile(const PositionalFile&) = delete;
+    PositionalFile& operator=(const PositionalFile&) = delete;
+    ~PositionalFile() {
+#ifdef WIN32
+        CloseHandle(handle_);
+#else
+        ::close(fd_);
+#endif
+    }
+
+    void read(std::byte* dest, size_t bytes, size_t offset) const {
+        while (bytes > 0) {
+#ifdef WIN32
+            const auto request = static_cast<DWORD>(std::min(bytes, size_t{1} << 30));
+            OVERLAPPED overlapped{};
+            const auto offset64 = static_cast<unsigned long long>(offset);
+            overlapped.Offset = static_cast<DWORD>(offset64 & 0xFFFFFFFF);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset64 >> 32);
+            DWORD count = 0;
+            if (!ReadFile(handle_, dest, request, &count, &overlapped) || count == 0) {
+                fail(bytes, offset);
+            }
+#else
+            const auto count = ::pread(fd_, dest, bytes, static_cast<off_t>(offset));
+            if (count == -1 && errno == EINTR) continue;
+            if (count <= 0) fail(bytes, offset);
+#endif
+            dest += count;
+            bytes -= static_cast<size_t>(count);
+            offset += static_cast<size_t>(count);
+        }
+    }
+
+private:
+    [[noreturn]] void fail(size_t bytes, size_t offset) const {
+        throw DataReaderException(IVW_CONTEXT_CUSTOM("readBytesIntoBuffer"),
+                                  "Could not read {} bytes at offset {} from file: {}", bytes,
+                                  offset, file_);
+    }
+
+    std::string_view file_;
+#ifdef WIN32
+    HANDLE handle_;
+#else
+    int fd_;
+#endif
+};
+
+/**
+ * A mask for a byte shuffle that reverses the bytes of each element of N bytes.
+ */
+template <size_t N, size_t Width>
+constexpr std::array<char, Width> reverseMask() {
+    std::array<char, Width> mask{};
+    for (size_t i = 0; i < Width; ++i) {
+        mask[i] = static_cast<char>((i % 16) / N * N + N - 1 - i % N);
+    }
+    return mask;
+}
+
+#if defined(IVW_SWAP_BYTES_SSE2)
+template <size_t N>
+__m128i reverseSSE2(__m128i v) {
+    if constexpr (N == 4) {
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)),
+                                _MM_SHUFFLE(2, 3, 0, 1));
+    } else if constexpr (N == 8) {
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3)),
+                                _MM_SHUFFLE(0, 1, 2, 3));
+    }
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+#endif
+
+/**
+ * Reverse the bytes of @p count elements of N bytes each. The bulk of the elements is handled
+ * with the widest byte shuffle available to the compiler, the remainder one element at a time.
+ */
+template <size_t N>
+void reverseElements(std::byte* data, size_t count) {
+    [[maybe_unused]] auto* end = data + count * N;
+#if defined(__AVX2__)
+    alignas(32) static constexpr auto mask = reverseMask<N, 32>();
+    const auto shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(mask.data()));
+    for (; data + 32 <= end; data += 32) {
+        auto* p = reinterpret_cast<__m256i*>(data);
+        _mm256_storeu_si256(p, _mm256_shuffle_epi8(_mm256_loadu_si256(p), shuffle));
+    }
+#elif defined(__SSSE3__)
+    alignas(16) static constexpr auto mask = reverseMask<N, 16>();
+    const auto shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(mask.data()));
+    for (; data + 16 <= end; data += 16) {
+        auto* p = reinterpret_cast<__m128i*>(data);
+        _mm_storeu_si128(p, _mm_shuffle_epi8(_mm_loadu_si128(p), shuffle));
+    }
+#elif defined(IVW_SWAP_BYTES_SSE2)
+    for (; data + 16 <= end; data += 16) {
+        auto* p = reinterpret_cast<__m128i*>(data);
+        _mm_storeu_si128(p, reverseSSE2<N>(_mm_loadu_si128(p)));
+    }
+#elif defined(__ARM_NEON)
+    for (; data + 16 <= end; data += 16) {
+        auto* p = reinterpret_cast<uint8_t*>(data);
+        if constexpr (N == 2) {
+            vst1q_u8(p, vrev16q_u8(vld1q_u8(p)));
+        } else if constexpr (N == 4) {
+            vst1q_u8(p, vrev32q_u8(vld1q_u8(p)));
+        } else {
+            vst1q_u8(p, vrev64q_u8(vld1q_u8(p)));
+        }
+    }
+#endif
+    for (; data != end; data += N) {
+        std::reverse(data, data + N);
+    }
+}
+
+}  // namespace
 
-    if (fin.good()) {
-        fin.seekg(offset);
-        fin.read(static_cast<char*>(dest), bytes);
+void util::swapBytes(void* data, size_t bytes, size_t elementSize) {
+    auto* ptr = static_cast<std::byte*>(data);
+    switch (elementSize) {
+        case 0:
+        case 1:
+            return;
+        case 2:
+            return reverseElements<2>(ptr, bytes / 2);
+        case 4:
+            return reverseElements<4>(ptr, bytes / 4);
+        case 8:
+            return reverseElements<8>(ptr, bytes / 8);
+        default:
+            for (auto* end = ptr + bytes - bytes % elementSize; ptr != end; ptr += elementSize) {
+                std::reverse(ptr, ptr + elementSize);
+            }
+    }
+}
 
-        if (!littleEndian && elementSize > 1) {
-            char* temp = new char[elementSize];
+bool util::readBytesIntoBuffer(std::string_view file, size_t offset, size_t bytes,
+                               bool littleEndian, size_t elementSize, void* dest,
+                               const ReadProgress& progress, const CancellationToken& token) {
+    const PositionalFile fin{file};
 
-            for (std::size_t i = 0; i < bytes; i += elementSize) {
-                for (std::size_t j = 0; j < elementSize; j++)
-                    temp[j] = static_cast<char*>(dest)[i + j];
+    auto* dst = static_cast<std::byte*>(dest);
+    const bool swap = !littleEndian && elementSize > 1;
+    // Chunks hold whole elements so that each chunk can be swapped on its own
+    const auto element = std::max(elementSize, size_t{1});
+    const auto chunk = std::max(element, chunkBytes - chunkBytes % element);
+    const auto chunks = (bytes + chunk - 1) / chunk;
 
-                for (std::size_t j = 0; j < elementSize; j++)
-                    static_cast<char*>(dest)[i + j] = temp[elementSize - j - 1];
+    std::mutex progressMutex;
+    size_t read = 0;
+    std::atomic<bool> cancelled = false;
+    const auto readChunks = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            if (token.isCancelled()) {
+                cancelled = true;
+                return;
             }
+            const auto begin = i * chunk;
+            const auto size = std::min(chunk, bytes - begin);
+            fin.read(dst + begin, size, offset + begin);
+            if (swap) swapBytes(dst + begin, size, elementSize);
+            if (progress) {
+                std::scoped_lock lock{progressMutex};
+                read += size;
+                progress(read, bytes);
+            }
+        }
+    };
 
-            delete[] temp;
+    if (chunks < 2 || util::getPoolSize() == 0) {
+        readChunks(0, chunks);
+    } else {
+        auto& pool = util::getThreadPool();
+        auto latch = pool.enqueueRange(chunks, std::min(chunks, pool.getSize()), readChunks);
+        pool.wait(*latch);
+        latch->get();
+    }
+    return !cancelled;
+}
+
+bool util::readBoxIntoBuffer(std::string_view file, size_t offset, size3_t dims,
+                             size3_t boxOffset, size3_t boxExtent, bool littleEndian,
+                             size_t elementSize, void* dest, const CancellationToken& token) {
+    if (glm::any(glm::greaterThan(boxOffset + boxExtent, dims))) {
+        throw DataReaderException(IVW_CONTEXT_CUSTOM("readBoxIntoBuffer"),
+                                  "Box is outside of the volume in file: {}", file);
+    }
+    if (boxExtent.x == dims.x && boxExtent.y == dims.y) {
+        // A set of complete z-slices is contiguous in the file
+        return readBytesIntoBuffer(file, offset + boxOffset.z * dims.x * dims.y * elementSize,
+                                   glm::compMul(boxExtent) * elementSize, littleEndian,
+                                   elementSize, dest, {}, token);
+    }
+    if (glm::compMul(boxExtent) == 0) return true;
+
+    const PositionalFile fin{file};
+
+    auto* dst = static_cast<std::byte*>(dest);
+    const bool swap = !littleEndian && elementSize > 1;
+    const util::IndexMapper3D im{dims};
+    // With complete rows the rows of a slice are contiguous and read at once
+    const bool fullRows = boxExtent.x == dims.x;
+    const auto rowBytes = boxExtent.x * elementSize;
+    const auto sliceBytes = boxExtent.y * rowBytes;
+
+    std::atomic<bool> cancelled = false;
+    const auto readSlices = [&](size_t first, size_t last) {
+        for (size_t z = first; z < last; ++z) {
+            if (token.isCancelled()) {
+                cancelled = true;
+                return;
+            }
+            auto* slice = dst + z * sliceBytes;
+            const auto pos = [&](size_t y) {
+                return offset + im(boxOffset + size3_t{0, y, z}) * elementSize;
+            };
+            if (fullRows) {
+                fin.read(slice, sliceBytes, pos(0));
+            } else {
+                for (size_t y = 0; y < boxExtent.y; ++y) {
+                    fin.read(slice + y * rowBytes, rowBytes, pos(y));
+                }
+            }
+            if (swap) swapBytes(slice, sliceBytes, elementSize);
         }
+    };
+
+    if (boxExtent.z < 2 || util::getPoolSize() == 0) {
+        readSlices(0, boxExtent.z);
     } else {
-        throw DataReaderException(IVW_CONTEXT_CUSTOM("readBytesIntoBuffer"),
-                                  "Error: Could not read from file: ", file);
+        auto& pool = util::getThreadPool();
+        auto latch = pool.enqueueRange(boxExtent.z, std::min(boxExtent.z, pool.getSize()),
+                                       readSlices);
+        pool.wait(*latch);
+        latch->get();
     }
+    return !cancelled;
 }
 
 }  // namespace inviwo
@@ -0,0 +1,240 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/io/compressedvolumeramloader.h>
+
+#include <inviwo/core/algorithm/brickcodec.h>
+#include <inviwo/core/datastructures/volume/volumecompressedram.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/bytereaderutil.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+// The index is stored in little endian byte order
+void toLittleEndian(std::vector<std::uint64_t>& index) {
+    if constexpr (std::endian::native == std::endian::big) {
+        util::swapBytes(index.data(), index.size() * sizeof(std::uint64_t),
+                        sizeof(std::uint64_t));
+    }
+}
+
+void checkRegion(std::string_view file, const size3_t& dims, const size3_t& offset,
+                 const size3_t& extent) {
+    if (glm::any(glm::greaterThan(offset + extent, dims))) {
+        throw DataReaderException(IVW_CONTEXT_CUSTOM("CompressedVolumeRAMLoader"),
+                                  "Region is outside of the volume in file: {}", file);
+    }
+}
+
+}  // namespace
+
+CompressedVolumeRAMLoader::CompressedVolumeRAMLoader(const std::string& file, size_t offset,
+                                                     size_t brickSize)
+    : file_(file), offset_(offset), brickSize_(brickSize) {}
+
+CompressedVolumeRAMLoader* CompressedVolumeRAMLoader::clone() const {
+    return new CompressedVolumeRAMLoader(*this);
+}
+
+std::shared_ptr<VolumeRepresentation> CompressedVolumeRAMLoader::createRepresentation(
+    const VolumeRepresentation& src) const {
+    return readRegion(src, size3_t{0}, src.getDimensions());
+}
+
+void CompressedVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                                     const VolumeRepresentation& src) const {
+    auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
+
+    if (src.getDimensions() != volumeDst->getDimensions()) {
+        volumeDst->setDimensions(src.getDimensions());
+    }
+
+    read(src, size3_t{0}, src.getDimensions(), *volumeDst);
+
+    volumeDst->setSwizzleMask(src.getSwizzleMask());
+    volumeDst->setInterpolation(src.getInterpolation());
+    volumeDst->setWrapping(src.getWrapping());
+}
+
+std::shared_ptr<VolumeRAM> CompressedVolumeRAMLoader::readRegion(const VolumeRepresentation& src,
+                                                                 size3_t offset,
+                                                                 size3_t extent) const {
+    checkRegion(file_, src.getDimensions(), offset, extent);
+    auto volumeRAM = createVolumeRAM(extent, src.getDataFormat(), RAMAllocation::uninitialized(),
+                                     src.getSwizzleMask(), src.getInterpolation(),
+                                     src.getWrapping());
+    read(src, offset, extent, *volumeRAM);
+    return volumeRAM;
+}
+
+void CompressedVolumeRAMLoader::read(const VolumeRepresentation& src, size3_t offset,
+                                     size3_t extent, VolumeRAM& dest) const {
+    const auto dims = src.getDimensions();
+    checkRegion(file_, dims, offset, extent);
+    if (glm::compMul(extent) == 0) return;
+
+    const auto* format = src.getDataFormat();
+    const auto voxelSize = format->getSize();
+    const auto componentSize = voxelSize / format->getComponents();
+    const auto count = (dims + size3_t{brickSize_ - 1}) / brickSize_;
+    const util::IndexMapper3D brickIm{count};
+
+    auto fin = filesystem::ifstream(file_, std::ios::in | std::ios::binary);
+    if (!fin.good()) {
+        throw DataReaderException(IVW_CONTEXT, "Could not read from file: {}", file_);
+    }
+
+    std::vector<std::uint64_t> index(glm::compMul(count) + 1);
+    fin.seekg(offset_);
+    fin.read(reinterpret_cast<char*>(index.data()), index.size() * sizeof(std::uint64_t));
+    toLittleEndian(index);
+    if (!fin.good() || !std::is_sorted(index.begin(), index.end())) {
+        throw DataReaderException(IVW_CONTEXT, "Invalid brick index in file: {}", file_);
+    }
+    const auto dataStart = offset_ + index.size() * sizeof(std::uint64_t);
+
+    // Read the compressed bricks overlapping the region, one row of bricks along x at a time since
+    // those are contiguous in the file.
+    struct Brick {
+        size3_t pos;
+        size_t begin;
+        size_t end;
+    };
+    std::vector<Brick> bricks;
+    std::vector<std::byte> buffer;
+    const auto first = offset / brickSize_;
+    const auto last = (offset + extent - size3_t{1}) / brickSize_;
+    for (size_t z = first.z; z <= last.z; ++z) {
+        for (size_t y = first.y; y <= last.y; ++y) {
+            const auto rowBegin = brickIm(size3_t{first.x, y, z});
+            const auto rowEnd = brickIm(size3_t{last.x, y, z}) + 1;
+            const auto start = buffer.size();
+            buffer.resize(start + (index[rowEnd] - index[rowBegin]));
+            fin.seekg(dataStart + index[rowBegin]);
+            fin.read(reinterpret_cast<char*>(buffer.data() + start), buffer.size() - start);
+            for (size_t i = rowBegin; i < rowEnd; ++i) {
+                bricks.push_back({size3_t{first.x + i - rowBegin, y, z},
+                                  start + index[i] - index[rowBegin],
+                                  start + index[i + 1] - index[rowBegin]});
+            }
+        }
+    }
+    if (!fin.good()) {
+        throw DataReaderException(IVW_CONTEXT, "Could not read from file: {}", file_);
+    }
+
+    auto* dst = static_cast<std::byte*>(dest.getData());
+    const util::IndexMapper3D im{extent};
+    const auto decompress = [&](size_t begin, size_t end) {
+        std::vector<std::byte> voxels;
+        for (size_t i = begin; i < end; ++i) {
+            const auto& brick = bricks[i];
+            const auto brickOffset = brick.pos * brickSize_;
+            const auto brickExtent = glm::min(size3_t{brickSize_}, dims - brickOffset);
+            voxels.resize(glm::compMul(brickExtent) * voxelSize);
+            const std::span<const std::byte> compressed{buffer.data() + brick.begin,
+                                                        brick.end - brick.begin};
+            if (compressed.empty()) {
+                std::fill(voxels.begin(), voxels.end(), std::byte{0});
+            } else {
+                util::decompressBrick(compressed, voxels, componentSize, format->getComponents());
+            }
+
+            // Copy the part of the brick that is inside of the region
+            const auto lower = glm::max(brickOffset, offset);
+            const auto upper = glm::min(brickOffset + brickExtent, offset + extent);
+            const auto rowBytes = (upper.x - lower.x) * voxelSize;
+            const util::IndexMapper3D brickVoxelIm{brickExtent};
+            for (size_t z = lower.z; z < upper.z; ++z) {
+                for (size_t y = lower.y; y < upper.y; ++y) {
+                    const size3_t pos{lower.x, y, z};
+                    std::memcpy(dst + im(pos - offset) * voxelSize,
+                                voxels.data() + brickVoxelIm(pos - brickOffset) * voxelSize,
+                                rowBytes);
+                }
+            }
+        }
+    };
+
+    if (bricks.size() < 2 || util::getPoolSize() == 0) {
+        decompress(0, bricks.size());
+    } else {
+        auto& pool = util::getThreadPool();
+        auto latch = pool.enqueueRange(bricks.size(), 4 * pool.getSize(), decompress);
+        pool.wait(*latch);
+        latch->get();
+    }
+}
+
+void util::writeCompressedBricks(const VolumeCompressedRAM& volume, std::ostream& out) {
+    const auto count = volume.getBrickCount();
+
+    std::vector<std::uint64_t> index{0};
+    index.reserve(glm::compMul(count) + 1);
+    for (size_t z = 0; z < count.z; ++z) {
+        for (size_t y = 0; y < count.y; ++y) {
+            for (size_t x = 0; x < count.x; ++x) {
+                index.push_back(index.back() + volume.getCompressedBrick({x, y, z}).size());
+            }
+        }
+    }
+    toLittleEndian(index);
+    out.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(std::uint64_t));
+
+    for (size_t z = 0; z < count.z; ++z) {
+        for (size_t y = 0; y < count.y; ++y) {
+            for (size_t x = 0; x < count.x; ++x) {
+                const auto brick = volume.getCompressedBrick({x, y, z});
+                out.write(reinterpret_cast<const char*>(brick.data()), brick.size());
+            }
+        }
+    }
+}
+
+}  // namespace inviwo
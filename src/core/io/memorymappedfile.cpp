@@ -0,0 +1,112 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/util/raiiutils.h>
+
+#ifdef WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <inviwo/core/util/stringconversion.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <string>
+
+namespace inviwo {
+
+namespace util {
+
+MemoryMappedFile::MemoryMappedFile(std::string_view file, size_t offset, size_t bytes)
+    : bytes_{bytes} {
+#ifdef WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const size_t granularity = info.dwAllocationGranularity;
+#else
+    const size_t granularity = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    const size_t start = offset - offset % granularity;
+    viewOffset_ = offset - start;
+    viewSize_ = viewOffset_ + bytes;
+
+#ifdef WIN32
+    HANDLE handle =
+        CreateFileW(util::toWstring(file).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        throw DataReaderException(IVW_CONTEXT, "Could not open file: {}", file);
+    }
+    OnScopeExit closeFile([&]() { CloseHandle(handle); });
+
+    HANDLE mapping = CreateFileMappingW(handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (!mapping) {
+        throw DataReaderException(IVW_CONTEXT, "Could not map file: {}", file);
+    }
+    OnScopeExit closeMapping([&]() { CloseHandle(mapping); });
+
+    const auto start64 = static_cast<unsigned long long>(start);
+    view_ = MapViewOfFile(mapping, FILE_MAP_COPY, static_cast<DWORD>(start64 >> 32),
+                          static_cast<DWORD>(start64 & 0xFFFFFFFF), viewSize_);
+    if (!view_) {
+        throw DataReaderException(IVW_CONTEXT, "Could not map file: {}", file);
+    }
+#else
+    const int fd = ::open(std::string{file}.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw DataReaderException(IVW_CONTEXT, "Could not open file: {}", file);
+    }
+    // The mapping keeps its own reference to the file
+    OnScopeExit closeFile([&]() { ::close(fd); });
+
+    void* view = ::mmap(nullptr, viewSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+                        static_cast<off_t>(start));
+    if (view == MAP_FAILED) {
+        throw DataReaderException(IVW_CONTEXT, "Could not map file: {}", file);
+    }
+    view_ = view;
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+#ifdef WIN32
+    UnmapViewOfFile(view_);
+#else
+    ::munmap(view_, viewSize_);
+#endif
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -30,28 +30,54 @@
 #include <inviwo/core/io/rawvolumeramloader.h>
 
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/util/filesystem.h>
 
 #include <glm/gtx/component_wise.hpp>
 
+#include <fstream>
+
 namespace inviwo {
 
-RawVolumeRAMLoader::RawVolumeRAMLoader(const std::string& rawFile, size_t offset, bool littleEndian)
-    : rawFile_(rawFile), offset_(offset), littleEndian_(littleEndian) {}
+RawVolumeRAMLoader::RawVolumeRAMLoader(const std::string& rawFile, size_t offset, bool littleEndian,
+                                       bool memoryMap)
+    : rawFile_(rawFile), offset_(offset), littleEndian_(littleEndian), memoryMap_(memoryMap) {}
 
 RawVolumeRAMLoader* RawVolumeRAMLoader::clone() const { return new RawVolumeRAMLoader(*this); }
 
+bool RawVolumeRAMLoader::canMap(const DataFormatBase* format, size_t bytes) const {
+    if (!memoryMap_) return false;
+    // The file layout has to match the memory layout, i.e. no byte swapping and aligned elements
+    if (!littleEndian_ && format->getSize() > 1) return false;
+    if (offset_ % (format->getSize() / format->getComponents()) != 0) return false;
+
+    std::ifstream fin = filesystem::ifstream(rawFile_, std::ios::in | std::ios::binary);
+    fin.seekg(0, std::ios::end);
+    return fin.good() && static_cast<size_t>(fin.tellg()) >= offset_ + bytes;
+}
+
 std::shared_ptr<VolumeRepresentation> RawVolumeRAMLoader::createRepresentation(
     const VolumeRepresentation& src) const {
 
     const auto size = glm::compMul(src.getDimensions()) * src.getDataFormat()->getSize();
-    auto data = std::make_unique<char[]>(size);
-    util::readBytesIntoBuffer(rawFile_, offset_, size, littleEndian_,
-                              src.getDataFormat()->getSize(), data.get());
 
-    auto volumeRAM =
-        createVolumeRAM(src.getDimensions(), src.getDataFormat(), data.get(), src.getSwizzleMask(),
-                        src.getInterpolation(), src.getWrapping());
-    data.release();
+    if (canMap(src.getDataFormat(), size)) {
+        try {
+            auto file = std::make_shared<util::MemoryMappedFile>(rawFile_, offset_, size);
+            auto* data = file->data();
+            return createVolumeRAM(std::move(file), data, src.getDimensions(),
+                                   src.getDataFormat(), src.getSwizzleMask(),
+                                   src.getInterpolation(), src.getWrapping());
+        } catch (const DataReaderException&) {
+            // Fall back to reading the file into memory
+        }
+    }
+
+    auto volumeRAM = createVolumeRAM(src.getDimensions(), src.getDataFormat(),
+                                     RAMAllocation::uninitialized(), src.getSwizzleMask(),
+                                     src.getInterpolation(), src.getWrapping());
+    util::readBytesIntoBuffer(rawFile_, offset_, size, littleEndian_,
+                              src.getDataFormat()->getSize(), volumeRAM->getData());
 
     return volumeRAM;
 }
@@ -72,4 +98,14 @@ void RawVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentati
     volumeDst->setInterpolation(src.getInterpolation());
     volumeDst->setWrapping(src.getWrapping());
 }
+std::shared_ptr<VolumeRAM> RawVolumeRAMLoader::readRegion(const VolumeRepresentation& src,
+                                                          size3_t offset, size3_t extent) const {
+    auto volumeRAM = createVolumeRAM(extent, src.getDataFormat(), RAMAllocation::uninitialized(),
+                                     src.getSwizzleMask(), src.getInterpolation(),
+                                     src.getWrapping());
+    util::readBoxIntoBuffer(rawFile_, offset_, src.getDimensions(), offset, extent, littleEndian_,
+                            src.getDataFormat()->getSize(), volumeRAM->getData());
+    return volumeRAM;
+}
+
 }  // namespace inviwo
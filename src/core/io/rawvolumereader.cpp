@@ -49,7 +49,8 @@ RawVolumeReader::RawVolumeReader()
     , spacing_(0.01f)
     , format_(nullptr)
     , byteOffset_(0u)
-    , parametersSet_(false) {
+    , parametersSet_(false)
+    , memoryMap_(false) {
     addExtension(FileExtension("raw", "Raw binary file"));
 }
 
@@ -61,7 +62,8 @@ RawVolumeReader::RawVolumeReader(const RawVolumeReader& rhs)
     , spacing_(rhs.spacing_)
     , format_(rhs.format_)
     , byteOffset_(rhs.byteOffset_)
-    , parametersSet_(false) {}
+    , parametersSet_(false)
+    , memoryMap_(rhs.memoryMap_) {}
 
 RawVolumeReader& RawVolumeReader::operator=(const RawVolumeReader& that) {
     if (this != &that) {
@@ -72,6 +74,7 @@ RawVolumeReader& RawVolumeReader::operator=(const RawVolumeReader& that) {
         format_ = that.format_;
         dataMapper_ = that.dataMapper_;
         byteOffset_ = that.byteOffset_;
+        memoryMap_ = that.memoryMap_;
         DataReaderType<Volume>::operator=(that);
     }
 
@@ -90,6 +93,21 @@ void RawVolumeReader::setParameters(const DataFormatBase* format, ivec3 dimensio
     byteOffset_ = byteOffset;
 }
 
+bool RawVolumeReader::setOption(std::string_view key, std::any value) {
+    if (key == "MemoryMap") {
+        if (auto* memoryMap = std::any_cast<bool>(&value)) {
+            memoryMap_ = *memoryMap;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::any RawVolumeReader::getOption(std::string_view key) {
+    if (key == "MemoryMap") return memoryMap_;
+    return {};
+}
+
 std::shared_ptr<Volume> RawVolumeReader::readData(std::string_view filePath) {
     return readData(filePath, nullptr);
 }
@@ -180,7 +198,8 @@ std::shared_ptr<Volume> RawVolumeReader::readData(std::string_view filePath,
         volume->setOffset(offset);
         volume->setWorldMatrix(wtm);
         auto vd = std::make_shared<VolumeDisk>(filePath, dimensions_, format_);
-        auto loader = std::make_unique<RawVolumeRAMLoader>(rawFile_, byteOffset_, littleEndian_);
+        auto loader = std::make_unique<RawVolumeRAMLoader>(rawFile_, byteOffset_, littleEndian_,
+                                                           memoryMap_);
         vd->setLoader(loader.release());
         volume->addRepresentation(vd);
 
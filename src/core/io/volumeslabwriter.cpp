@@ -0,0 +1,86 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/volumeslabwriter.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/filesystem.h>
+
+namespace inviwo {
+
+VolumeSlabWriter::VolumeSlabWriter(std::string_view rawFile, size3_t dimensions,
+                                   const DataFormatBase* format)
+    : rawFile_{rawFile}
+    , dimensions_{dimensions}
+    , format_{format}
+    , out_{filesystem::ofstream(rawFile, std::ios::out | std::ios::binary | std::ios::trunc)} {
+    if (!out_) {
+        throw DataWriterException(IVW_CONTEXT, "Could not write to raw file: {}", rawFile_);
+    }
+}
+
+void VolumeSlabWriter::write(const VolumeRAM& slab, size_t first, size_t count) {
+    const auto dims = slab.getDimensions();
+    if (slab.getDataFormat() != format_ || dims.x != dimensions_.x || dims.y != dimensions_.y ||
+        first + count > dims.z) {
+        throw DataWriterException("Slab does not match the written volume", IVW_CONTEXT);
+    }
+    if (layers_ + count > dimensions_.z) {
+        throw DataWriterException("Writing more layers than the volume has", IVW_CONTEXT);
+    }
+
+    const auto layerBytes = dims.x * dims.y * format_->getSize();
+    out_.write(static_cast<const char*>(slab.getData()) + first * layerBytes,
+               count * layerBytes);
+    if (!out_) {
+        throw DataWriterException(IVW_CONTEXT, "Could not write to raw file: {}", rawFile_);
+    }
+    layers_ += count;
+}
+
+size_t VolumeSlabWriter::getWrittenLayers() const { return layers_; }
+
+std::shared_ptr<VolumeDisk> VolumeSlabWriter::finish(const SwizzleMask& swizzleMask,
+                                                     InterpolationType interpolation,
+                                                     const Wrapping3D& wrapping) {
+    if (layers_ != dimensions_.z) {
+        throw DataWriterException(IVW_CONTEXT, "Only {} of {} layers were written to {}", layers_,
+                                  dimensions_.z, rawFile_);
+    }
+    out_.close();
+
+    auto disk = std::make_shared<VolumeDisk>(rawFile_, dimensions_, format_, swizzleMask,
+                                             interpolation, wrapping);
+    disk->setLoader(new RawVolumeRAMLoader(rawFile_, 0, true));
+    return disk;
+}
+
+}  // namespace inviwo
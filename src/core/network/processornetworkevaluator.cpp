@@ -28,30 +28,56 @@
  *********************************************************************************/
 
 #include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/datastructures/idlecompressionmanager.h>
+#include <inviwo/core/datastructures/residencymanager.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/processormemocache.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/zip.h>
 #include <inviwo/core/network/networkutils.h>
 #include <inviwo/core/network/networklock.h>
-#include <inviwo/core/util/clock.h>
+#include <inviwo/core/network/portconnection.h>
+#include <inviwo/core/util/profiler.h>
+#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/tracerecorder.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace inviwo {
 
 ProcessorNetworkEvaluator::ProcessorNetworkEvaluator(ProcessorNetwork* processorNetwork)
     : processorNetwork_(processorNetwork)
-    , processorsSorted_(util::topologicalSortFiltered(processorNetwork_))
+    , processorsSorted_()
+    , order_()
     , needsSorting_(true)
     , evaulationQueued_(false)
-    , exceptionHandler_(StandardEvaluationErrorHandler()) {
+    , evaluationMode_(EvaluationMode::Serial)
+    , exceptionHandler_(StandardEvaluationErrorHandler())
+    , dirtyMutex_()
+    , dirty_() {
 
     processorNetwork_->addObserver(this);
+    processorNetwork_->forEachProcessor([this](Processor* p) {
+        p->ProcessorObservable::addObserver(this);
+        markDirty(p);
+    });
 }
 
 void ProcessorNetworkEvaluator::setExceptionHandler(EvaluationErrorHandler handler) {
     exceptionHandler_ = handler;
 }
 
+void ProcessorNetworkEvaluator::setEvaluationMode(EvaluationMode mode) { evaluationMode_ = mode; }
+
+EvaluationMode ProcessorNetworkEvaluator::getEvaluationMode() const { return evaluationMode_; }
+
 void ProcessorNetworkEvaluator::onProcessorNetworkEvaluateRequest() {
     // Direct request, thus we don't want to queue the evaluation anymore
     evaulationQueued_ = false;
@@ -98,67 +124,272 @@ void ProcessorNetworkEvaluator::evaluate() {
     // lock processor network to avoid concurrent evaluation
     NetworkLock lock(processorNetwork_);
 
-    if (needsSorting_) {
-        processorsSorted_ = util::topologicalSortFiltered(processorNetwork_);
-        needsSorting_ = false;
-    }
+    // Representations used in the previous evaluation are no longer protected from eviction
+    ResidencyManager::nextEpoch();
+    IdleCompressionManager::nextEpoch();
 
     notifyObserversProcessorNetworkEvaluationBegin();
 
-    IVW_CPU_PROFILING_IF(500, "Evaluated Processor Network");
-
-    for (auto processor : processorsSorted_) {
-        if (!processor->isValid()) {
-            if (processor->isReady()) {
-                try {
-                    // re-initialize resources (e.g., shaders) if necessary
-                    if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
-                        processor->initializeResources();
-                    }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::InitResource, IVW_CONTEXT);
-                    continue;
-                }
-
-                try {
-                    // call onChange for all invalid inports
-                    for (auto inport : processor->getInports()) {
-                        inport->callOnChangeIfChanged();
-                    }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::PortOnChange, IVW_CONTEXT);
-                    continue;
-                }
-
-                processor->notifyObserversAboutToProcess(processor);
-
-                try {
-                    IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
-                    // do the actual processing
-                    processor->process();
-
-                    // Set processor as valid only if we still are ready.
-                    // Callbacks might have made our inports invalid, if so abort
-                    // the evaluation by not setting the processor valid.
-                    if (processor->isReady()) processor->setValid();
-
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::Process, IVW_CONTEXT);
-                }
-
-                processor->notifyObserversFinishedProcess(processor);
+    // Processing can invalidate other processors, e.g. through links or outports. Like a sweep
+    // over the whole sorted set, evaluate those in the same call, but only try each processor
+    // once to not loop on processors that fail or invalidate each other.
+    std::unordered_set<Processor*> evaluated;
+    {
+        IVW_PROFILE_SCOPE("ProcessorNetworkEvaluator::evaluate");
+        while (true) {
+            if (needsSorting_) sort();
+            const auto worklist = takeWorklist(evaluated);
+            if (worklist.empty()) break;
+
+            switch (evaluationMode_) {
+                case EvaluationMode::Parallel:
+                    evaluateParallel(worklist);
+                    break;
+                case EvaluationMode::Serial:
+                    evaluateSerial(worklist);
+                    break;
+            }
+            evaluated.insert(worklist.begin(), worklist.end());
+        }
+    }
+
+    // Processors that could not be processed, i.e. not ready or failed, have to be tried again
+    for (auto processor : evaluated) {
+        if (!processor->isValid()) markDirty(processor);
+    }
+
+    notifyObserversProcessorNetworkEvaluationEnd();
+}
+
+void ProcessorNetworkEvaluator::sort() {
+    processorsSorted_ = util::topologicalSortFiltered(processorNetwork_);
+    needsSorting_ = false;
+    updateOrder();
+    for (auto processor : processorsSorted_) updateConsumedOutports(processor);
+}
+
+void ProcessorNetworkEvaluator::updateOrder() {
+    order_.clear();
+    for (auto&& [i, processor] : util::enumerate(processorsSorted_)) order_[processor] = i;
+}
+
+bool ProcessorNetworkEvaluator::isEvaluated(Processor* processor) const {
+    return order_.count(processor) != 0;
+}
 
+bool ProcessorNetworkEvaluator::leadsToEvaluated(Processor* processor) const {
+    if (processor->isSink()) return true;
+    return util::any_of(processor->getOutports(), [&](Outport* outport) {
+        return util::any_of(outport->getConnectedInports(), [&](Inport* inport) {
+            auto consumer = inport->getProcessor();
+            return isEvaluated(consumer) && consumer->isConnectionActive(inport, outport);
+        });
+    });
+}
+
+void ProcessorNetworkEvaluator::updateConsumedOutports(Processor* processor) {
+    bool invalid = false;
+    for (auto outport : processor->getOutports()) {
+        const bool consumed = util::any_of(outport->getConnectedInports(), [&](Inport* inport) {
+            auto consumer = inport->getProcessor();
+            return isEvaluated(consumer) && consumer->isConnectionActive(inport, outport);
+        });
+        // The processor might have skipped producing data for the port and left stale data, it
+        // needs to be processed again to provide it.
+        invalid |= consumed && !outport->consumed_;
+        outport->consumed_ = consumed;
+    }
+    if (invalid) processor->invalidate(InvalidationLevel::InvalidOutput);
+}
+
+void ProcessorNetworkEvaluator::markDirty(Processor* processor) {
+    std::scoped_lock lock{dirtyMutex_};
+    dirty_.insert(processor);
+}
+
+std::vector<Processor*> ProcessorNetworkEvaluator::takeWorklist(
+    const std::unordered_set<Processor*>& skip) {
+    std::vector<Processor*> worklist;
+    {
+        std::scoped_lock lock{dirtyMutex_};
+        for (auto it = dirty_.begin(); it != dirty_.end();) {
+            if ((*it)->isValid()) {
+                it = dirty_.erase(it);
+            } else if (isEvaluated(*it) && !skip.contains(*it)) {
+                worklist.push_back(*it);
+                it = dirty_.erase(it);
             } else {
-                try {
-                    processor->doIfNotReady();
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::NotReady, IVW_CONTEXT);
-                }
+                ++it;
             }
         }
     }
+    std::sort(worklist.begin(), worklist.end(),
+              [&](Processor* a, Processor* b) { return order_.at(a) < order_.at(b); });
+    return worklist;
+}
 
-    notifyObserversProcessorNetworkEvaluationEnd();
+void ProcessorNetworkEvaluator::evaluateSerial(const std::vector<Processor*>& worklist) {
+    for (auto processor : worklist) {
+        if (prepareProcessor(processor)) {
+            finishProcessor(processor, processProcessor(processor));
+        }
+    }
+}
+
+void ProcessorNetworkEvaluator::evaluateParallel(const std::vector<Processor*>& worklist) {
+    // Count the number of unfinished predecessors of each processor, a processor can be scheduled
+    // when the count reaches zero. Predecessors that are not part of the worklist are valid or
+    // will not be evaluated and are ignored.
+    std::unordered_map<Processor*, size_t> pending;
+    std::unordered_map<Processor*, std::vector<Processor*>> successors;
+    for (auto processor : worklist) pending[processor] = 0;
+    for (auto processor : worklist) {
+        for (auto predecessor : util::getDirectPredecessors(processor)) {
+            if (pending.count(predecessor) != 0) {
+                ++pending[processor];
+                successors[predecessor].push_back(processor);
+            }
+        }
+    }
+
+    // keep the topological order among ready processors to match the serial evaluation
+    std::deque<Processor*> ready;
+    for (auto processor : worklist) {
+        if (pending[processor] == 0) ready.push_back(processor);
+    }
+
+    const auto done = [&](Processor* processor) {
+        for (auto successor : successors[processor]) {
+            if (--pending[successor] == 0) ready.push_back(successor);
+        }
+    };
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<std::pair<Processor*, std::exception_ptr>> finished;
+    size_t running = 0;
+
+    // Finish processors that were processed in the pool, all the state changes in the network
+    // caused by setValid happens here on the calling thread.
+    const auto collect = [&](bool wait) {
+        std::vector<std::pair<Processor*, std::exception_ptr>> batch;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            if (wait) condition.wait(lock, [&]() { return !finished.empty(); });
+            std::swap(batch, finished);
+        }
+        for (auto& [processor, error] : batch) {
+            --running;
+            finishProcessor(processor, error);
+            done(processor);
+        }
+    };
+
+    auto& pool = util::getThreadPool(processorNetwork_->getApplication());
+
+    while (!ready.empty() || running > 0) {
+        while (!ready.empty()) {
+            auto processor = ready.front();
+            ready.pop_front();
+
+            if (!prepareProcessor(processor)) {
+                done(processor);
+            } else if (processor->getProcessorInfo().processingThread == ProcessingThread::Any) {
+                ++running;
+                pool.enqueueRaw(
+                    [processor, &mutex, &condition, &finished]() {
+                        auto error = processProcessor(processor);
+                        {
+                            std::unique_lock<std::mutex> lock{mutex};
+                            finished.emplace_back(processor, error);
+                        }
+                        condition.notify_one();
+                    },
+                    TaskPriority::Interactive);
+            } else {
+                finishProcessor(processor, processProcessor(processor));
+                done(processor);
+            }
+            collect(false);
+        }
+        if (running > 0) collect(true);
+    }
+}
+
+bool ProcessorNetworkEvaluator::prepareProcessor(Processor* processor) {
+    if (processor->isValid()) return false;
+
+    if (!processor->isReady()) {
+        try {
+            processor->doIfNotReady();
+        } catch (...) {
+            exceptionHandler_(processor, EvaluationType::NotReady, IVW_CONTEXT);
+        }
+        return false;
+    }
+
+    try {
+        // re-initialize resources (e.g., shaders) if necessary
+        if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
+            processor->initializeResources();
+        }
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::InitResource, IVW_CONTEXT);
+        return false;
+    }
+
+    try {
+        // call onChange for all invalid inports
+        for (auto inport : processor->getInports()) {
+            inport->callOnChangeIfChanged();
+        }
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::PortOnChange, IVW_CONTEXT);
+        return false;
+    }
+
+    processor->notifyObserversAboutToProcess(processor);
+    return true;
+}
+
+std::exception_ptr ProcessorNetworkEvaluator::processProcessor(Processor* processor) {
+    try {
+        IVW_TRACE_SCOPE("process", processor->getIdentifier());
+        IVW_PROFILE_SCOPE("ProcessorNetworkEvaluator::process");
+        // skip the processing if the results can be restored from the memoization cache
+        auto* cache = processor->getMemoCache();
+        if (cache && cache->restore(*processor)) return nullptr;
+
+        // do the actual processing
+        processor->process();
+
+        if (cache) cache->store(*processor);
+    } catch (...) {
+        return std::current_exception();
+    }
+    return nullptr;
+}
+
+void ProcessorNetworkEvaluator::finishProcessor(Processor* processor, std::exception_ptr error) {
+    try {
+        if (error) std::rethrow_exception(error);
+
+        // Set processor as valid only if we still are ready.
+        // Callbacks might have made our inports invalid, if so abort
+        // the evaluation by not setting the processor valid.
+        if (processor->isReady()) processor->setValid();
+
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::Process, IVW_CONTEXT);
+    }
+
+    processor->notifyObserversFinishedProcess(processor);
+}
+
+void ProcessorNetworkEvaluator::onProcessorInvalidationBegin(Processor* p) {
+    // The network requests an evaluation when the invalidation ends, before the end is observed
+    // here. Hence mark the processor already when the invalidation begins.
+    markDirty(p);
 }
 
 void ProcessorNetworkEvaluator::onProcessorSinkChanged(Processor*) { needsSorting_ = true; }
@@ -169,20 +400,51 @@ void ProcessorNetworkEvaluator::onProcessorActiveConnectionsChanged(Processor*)
 
 void ProcessorNetworkEvaluator::onProcessorNetworkDidAddProcessor(Processor* p) {
     p->ProcessorObservable::addObserver(this);
-    needsSorting_ = true;
+    markDirty(p);
+    // A new processor has no connections, it is only evaluated if it is a sink. In that case it
+    // can go last in the order.
+    if (!needsSorting_ && p->isSink()) {
+        order_[p] = processorsSorted_.size();
+        processorsSorted_.push_back(p);
+    }
 }
 
 void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveProcessor(Processor* p) {
     p->ProcessorObservable::removeObserver(this);
-    needsSorting_ = true;
+    {
+        std::scoped_lock lock{dirtyMutex_};
+        dirty_.erase(p);
+    }
+    // All connections are removed before the processor, removing it keeps the order valid.
+    if (auto it = order_.find(p); it != order_.end()) {
+        processorsSorted_.erase(processorsSorted_.begin() + it->second);
+        updateOrder();
+    }
 }
 
-void ProcessorNetworkEvaluator::onProcessorNetworkDidAddConnection(const PortConnection&) {
-    needsSorting_ = true;
+void ProcessorNetworkEvaluator::onProcessorNetworkDidAddConnection(const PortConnection& c) {
+    auto producer = c.getOutport()->getProcessor();
+    auto consumer = c.getInport()->getProcessor();
+    // A connection from an evaluated processor to an evaluated processor later in the order
+    // changes neither the evaluated set nor the order.
+    if (!needsSorting_ && isEvaluated(producer) && isEvaluated(consumer) &&
+        order_.at(producer) < order_.at(consumer)) {
+        updateConsumedOutports(producer);
+    } else {
+        needsSorting_ = true;
+    }
 }
 
-void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveConnection(const PortConnection&) {
-    needsSorting_ = true;
+void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveConnection(const PortConnection& c) {
+    auto producer = c.getOutport()->getProcessor();
+    // Removing a connection keeps the order valid, but the producer, and hence its predecessors,
+    // might not lead to a sink anymore.
+    if (needsSorting_ || !isEvaluated(producer)) return;
+    if (leadsToEvaluated(producer)) {
+        updateConsumedOutports(producer);
+    } else {
+        needsSorting_ = true;
+    }
 }
 
 }  // namespace inviwo
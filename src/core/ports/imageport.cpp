@@ -130,6 +130,10 @@ void ImageOutport::clear() {
     DataOutport<Image>::clear();
 }
 
+std::shared_ptr<const void> ImageOutport::getUntypedData() const { return nullptr; }
+
+bool ImageOutport::setUntypedData(std::shared_ptr<const void>) { return false; }
+
 bool ImageOutport::hasEditableData() const { return static_cast<bool>(image_); }
 
 size2_t ImageOutport::getLargestReqDim() const {
@@ -46,7 +46,9 @@ Outport::Outport(std::string_view identifier, Document help)
                    IVW_ASSERT(false, "Must be set by derived class, see for example DataOutPort");
                    return false;
                }}
-    , invalidationLevel_(InvalidationLevel::Valid) {}
+    , invalidationLevel_(InvalidationLevel::Valid)
+    , dataVersion_{0}
+    , consumed_{true} {}
 
 Outport::~Outport() = default;
 
@@ -54,6 +56,14 @@ bool Outport::isConnected() const { return !(connectedInports_.empty()); }
 
 bool Outport::isReady() const { return isReady_; }
 
+std::shared_ptr<const void> Outport::getUntypedData() const { return nullptr; }
+
+bool Outport::setUntypedData(std::shared_ptr<const void>) { return false; }
+
+size_t Outport::getDataVersion() const { return dataVersion_; }
+
+bool Outport::isConsumed() const { return consumed_; }
+
 bool Outport::isConnectedTo(const Inport* port) const {
     return util::contains(connectedInports_, port);
 }
@@ -28,6 +28,7 @@
  *********************************************************************************/
 
 #include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/processors/processormemocache.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/stringconversion.h>
@@ -100,7 +101,7 @@ PoolProcessor::~PoolProcessor() { stopJobs(); }
 
 void PoolProcessor::stopJobs() {
     for (auto& state : states_) {
-        state->stop = true;
+        state->stop.cancel();
     }
 }
 
@@ -110,8 +111,9 @@ void PoolProcessor::submit(Submission& job) {
     job.setupProgress();
     states_.push_back(job.state);
     notifyObserversStartBackgroundWork(this, job.tasks.size());
+    auto& pool = util::getThreadPool(getInviwoApplication());
     for (auto& task : job.tasks) {
-        util::getThreadPool(getInviwoApplication()).enqueueRaw(std::move(task));
+        pool.enqueueRaw(std::move(task), TaskPriority::Normal, job.state->stop.getToken());
     }
 }
 
@@ -149,6 +151,8 @@ void PoolProcessor::handleError() {
 void PoolProcessor::newResults() { newResults(getOutports()); }
 
 void PoolProcessor::newResults(const std::vector<Outport*>& outports) {
+    if (auto* cache = getMemoCache()) cache->store(*this);
+
     notifyObserversInvalidationBegin(this);
     for (auto& outport : outports) {
         outport->invalidate(InvalidationLevel::InvalidOutput);
@@ -35,6 +35,7 @@
 #include <inviwo/core/interaction/events/interactionevent.h>
 #include <inviwo/core/interaction/events/pickingevent.h>
 #include <inviwo/core/processors/processorwidget.h>
+#include <inviwo/core/processors/processormemocache.h>
 #include <inviwo/core/util/factory.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/utilities.h>
@@ -58,7 +59,8 @@ Processor::Processor(std::string_view identifier, std::string_view displayName)
                 [this]() { return inports_.empty(); }}
     , identifier_(identifier)
     , displayName_{displayName}
-    , network_(nullptr) {
+    , network_(nullptr)
+    , memoCache_{nullptr} {
 
     util::validateIdentifier(identifier_, "Processor", IVW_CONTEXT);
 
@@ -304,6 +306,18 @@ bool Processor::isSink() const { return isSink_; }
 
 bool Processor::isReady() const { return isReady_; }
 
+void Processor::setMemoizationCapacity(size_t capacity) {
+    if (capacity == 0) {
+        memoCache_.reset();
+    } else if (memoCache_) {
+        memoCache_->setCapacity(capacity);
+    } else {
+        memoCache_ = std::make_unique<ProcessorMemoCache>(capacity);
+    }
+}
+
+ProcessorMemoCache* Processor::getMemoCache() const { return memoCache_.get(); }
+
 bool Processor::allInportsAreReady() const {
     return util::all_of(inports_, [](Inport* p) { return p->isReady() || p->isOptional(); });
 }
@@ -40,7 +40,8 @@ ProcessorInfo::ProcessorInfo(std::string aClassIdentifier, std::string aDisplayN
     , codeState(aCodeState)
     , tags{std::move(someTags)}
     , help{}
-    , visible{true} {}
+    , visible{true}
+    , processingThread{ProcessingThread::Front} {}
 
 ProcessorInfo::ProcessorInfo(std::string aClassIdentifier, std::string aDisplayName,
                              std::string aCategory, CodeState aCodeState, Tags someTags,
@@ -51,7 +52,20 @@ ProcessorInfo::ProcessorInfo(std::string aClassIdentifier, std::string aDisplayN
     , codeState(aCodeState)
     , tags{std::move(someTags)}
     , help{std::move(help)}
-    , visible{isVisible} {}
+    , visible{isVisible}
+    , processingThread{ProcessingThread::Front} {}
+
+ProcessorInfo::ProcessorInfo(std::string aClassIdentifier, std::string aDisplayName,
+                             std::string aCategory, CodeState aCodeState, Tags someTags,
+                             Document help, bool isVisible, ProcessingThread aProcessingThread)
+    : classIdentifier{std::move(aClassIdentifier)}
+    , displayName{std::move(aDisplayName)}
+    , category{std::move(aCategory)}
+    , codeState(aCodeState)
+    , tags{std::move(someTags)}
+    , help{std::move(help)}
+    , visible{isVisible}
+    , processingThread{aProcessingThread} {}
 
 bool operator==(const ProcessorInfo& a, const ProcessorInfo& b) {
     return std::tie(a.classIdentifier, a.displayName, a.category, a.codeState, a.tags, a.visible) ==
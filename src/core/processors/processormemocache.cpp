@@ -0,0 +1,152 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/processors/processormemocache.h>
+
+#include <inviwo/core/io/serialization/serializer.h>
+#include <inviwo/core/ports/inport.h>
+#include <inviwo/core/ports/outport.h>
+#include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/properties/property.h>
+#include <inviwo/core/properties/propertypresetmanager.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/hashcombine.h>
+#include <inviwo/core/util/profiler.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace inviwo {
+
+ProcessorMemoCache::ProcessorMemoCache(size_t capacity)
+    : capacity_{capacity}, entries_{}, pending_{}, hits_{0}, misses_{0} {}
+
+auto ProcessorMemoCache::makeKey(Processor& processor) -> std::optional<Key> {
+    Key key;
+    for (auto* inport : processor.getInports()) {
+        for (auto* outport : inport->getConnectedOutports()) {
+            auto data = outport->getUntypedData();
+            if (!data) return std::nullopt;
+            const auto version = outport->getDataVersion();
+            util::hash_combine(key.hash, data.get());
+            util::hash_combine(key.hash, version);
+            key.inputs.emplace_back(std::move(data), version);
+        }
+    }
+
+    Serializer serializer("");
+    for (auto* property : processor.getProperties()) {
+        auto reset = PropertyPresetManager::scopedSerializationModeAll(property);
+        serializer.serialize(property->getIdentifier(), *property);
+    }
+    std::stringstream ss;
+    serializer.writeFile(ss);
+    key.state = std::move(ss).str();
+    util::hash_combine(key.hash, key.state);
+
+    return key;
+}
+
+bool ProcessorMemoCache::restore(Processor& processor) {
+    pending_.reset();
+    if (capacity_ == 0) return false;
+
+    try {
+        pending_ = makeKey(processor);
+    } catch (const Exception&) {
+        // Properties that fail to serialize can not be memoized
+    }
+
+    const auto& outports = processor.getOutports();
+    const auto it = !pending_ ? entries_.end()
+                              : std::find_if(entries_.begin(), entries_.end(), [&](const Entry& e) {
+                                    return e.key == *pending_ &&
+                                           e.outputs.size() == outports.size();
+                                });
+
+    if (it == entries_.end()) {
+        ++misses_;
+        IVW_PROFILE_COUNT("ProcessorMemoCache::misses", 1);
+        return false;
+    }
+
+    // Make sure that no background job overwrites the restored results
+    if (auto* pool = dynamic_cast<PoolProcessor*>(&processor)) pool->stopJobs();
+
+    for (size_t i = 0; i < outports.size(); ++i) {
+        outports[i]->setUntypedData(it->outputs[i]);
+    }
+    entries_.splice(entries_.begin(), entries_, it);
+
+    ++hits_;
+    IVW_PROFILE_COUNT("ProcessorMemoCache::hits", 1);
+    return true;
+}
+
+void ProcessorMemoCache::store(Processor& processor) {
+    if (!pending_ || capacity_ == 0) return;
+
+    std::vector<std::shared_ptr<const void>> outputs;
+    for (auto* outport : processor.getOutports()) {
+        auto data = outport->getUntypedData();
+        if (!data) return;
+        outputs.push_back(std::move(data));
+    }
+
+    std::erase_if(entries_, [&](const Entry& e) { return e.key == *pending_; });
+    entries_.push_front(Entry{std::move(*pending_), std::move(outputs)});
+    pending_.reset();
+    while (entries_.size() > capacity_) entries_.pop_back();
+}
+
+void ProcessorMemoCache::clear() {
+    entries_.clear();
+    pending_.reset();
+}
+
+size_t ProcessorMemoCache::size() const { return entries_.size(); }
+
+size_t ProcessorMemoCache::getCapacity() const { return capacity_; }
+
+void ProcessorMemoCache::setCapacity(size_t capacity) {
+    capacity_ = capacity;
+    while (entries_.size() > capacity_) entries_.pop_back();
+}
+
+size_t ProcessorMemoCache::getHits() const { return hits_; }
+
+size_t ProcessorMemoCache::getMisses() const { return misses_; }
+
+double ProcessorMemoCache::getHitRate() const {
+    const auto total = hits_ + misses_;
+    return total == 0 ? 0.0 : static_cast<double>(hits_) / static_cast<double>(total);
+}
+
+}  // namespace inviwo
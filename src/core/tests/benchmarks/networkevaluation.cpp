@@ -0,0 +1,128 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/network/networklock.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/ports/datainport.h>
+#include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/processors/processor.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace inviwo;
+
+namespace {
+
+struct PassThrough : Processor {
+    PassThrough(const std::string& id, bool hasInport, bool hasOutport) : Processor(id, id) {
+        if (hasInport) addPort(std::make_unique<DataInport<int>>("in"));
+        if (hasOutport) addPort(std::make_unique<DataOutport<int>>("out"));
+    }
+
+    virtual const ProcessorInfo getProcessorInfo() const override { return processorInfo_; }
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override {
+        if (auto outport = getOutports().empty() ? nullptr : getOutports().front()) {
+            static_cast<DataOutport<int>*>(outport)->setData(std::make_shared<int>(0));
+        }
+    }
+};
+
+const ProcessorInfo PassThrough::processorInfo_{
+    "org.inviwo.PassThrough",  // Class identifier
+    "Pass Through",            // Display name
+    "Benchmark",               // Category
+    CodeState::Stable,         // Code state
+    Tags::CPU,                 // Tags
+};
+
+/**
+ * A network of \p chains independent chains of \p length processors, each ending in a sink.
+ */
+struct Network {
+    Network(size_t chains, size_t length) : network{nullptr}, evaluator{&network} {
+        NetworkLock lock(&network);
+        for (size_t c = 0; c < chains; ++c) {
+            Processor* prev = nullptr;
+            for (size_t i = 0; i < length; ++i) {
+                auto p = network.addProcessor(std::make_shared<PassThrough>(
+                    "p" + std::to_string(c) + "_" + std::to_string(i), i != 0, i + 1 != length));
+                if (prev) network.addConnection(prev->getOutports()[0], p->getInports()[0]);
+                if (i == 0) sources.push_back(p);
+                prev = p;
+            }
+        }
+    }
+
+    ProcessorNetwork network;
+    ProcessorNetworkEvaluator evaluator;
+    std::vector<Processor*> sources;
+};
+
+constexpr size_t chainLength = 4;
+
+/**
+ * Invalidate a single source, the evaluation should only touch the invalidated chain.
+ */
+void InvalidateOne(benchmark::State& state) {
+    Network net(static_cast<size_t>(state.range(0)) / chainLength, chainLength);
+    size_t i = 0;
+    for (auto _ : state) {
+        net.sources[i++ % net.sources.size()]->invalidate(InvalidationLevel::InvalidOutput);
+    }
+    state.counters["Processors"] = static_cast<double>(state.range(0));
+}
+
+/**
+ * Connect and disconnect a new sink to a source, the ordering should be kept incrementally.
+ */
+void Reconnect(benchmark::State& state) {
+    Network net(static_cast<size_t>(state.range(0)) / chainLength, chainLength);
+    auto sink = net.network.addProcessor(std::make_shared<PassThrough>("sink", true, false));
+    auto outport = net.sources.front()->getOutports()[0];
+    auto inport = sink->getInports()[0];
+    for (auto _ : state) {
+        net.network.addConnection(outport, inport);
+        net.network.removeConnection(outport, inport);
+    }
+    state.counters["Processors"] = static_cast<double>(state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(InvalidateOne)->RangeMultiplier(4)->Range(16, 16384);
+BENCHMARK(Reconnect)->RangeMultiplier(4)->Range(16, 16384);
+
+BENCHMARK_MAIN();
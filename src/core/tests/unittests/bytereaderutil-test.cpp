@@ -0,0 +1,179 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/io/bytereaderutil.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+// Large enough to be split into several chunks
+constexpr size_t count = size_t{10} << 20;
+
+std::uint32_t reversed(std::uint32_t v) {
+    return (v >> 24) | ((v >> 8) & 0xFF00u) | ((v << 8) & 0xFF0000u) | (v << 24);
+}
+
+util::TempFileHandle writeRaw(size_t header) {
+    util::TempFileHandle file{"inviwo", ".raw"};
+    std::vector<char> head(header);
+    std::vector<std::uint32_t> values(count);
+    std::iota(values.begin(), values.end(), std::uint32_t{0});
+    std::fwrite(head.data(), 1, head.size(), file);
+    std::fwrite(values.data(), sizeof(std::uint32_t), values.size(), file);
+    std::fflush(file);
+    return file;
+}
+
+}  // namespace
+
+TEST(ByteReaderUtil, SwapBytes) {
+    std::vector<std::uint16_t> u16{0x0102, 0x0304, 0x0506, 0x0708, 0x090A, 0x0B0C, 0x0D0E,
+                                   0x0F10, 0x1112};
+    util::swapBytes(u16.data(), u16.size() * sizeof(std::uint16_t), sizeof(std::uint16_t));
+    EXPECT_EQ(u16.front(), 0x0201);
+    EXPECT_EQ(u16.back(), 0x1211);
+
+    std::vector<std::uint32_t> u32(37);
+    std::iota(u32.begin(), u32.end(), std::uint32_t{0x01020304});
+    util::swapBytes(u32.data(), u32.size() * sizeof(std::uint32_t), sizeof(std::uint32_t));
+    for (size_t i = 0; i < u32.size(); ++i) {
+        EXPECT_EQ(u32[i], reversed(static_cast<std::uint32_t>(0x01020304 + i)));
+    }
+
+    std::vector<std::uint64_t> u64(11, 0x0102030405060708);
+    util::swapBytes(u64.data(), u64.size() * sizeof(std::uint64_t), sizeof(std::uint64_t));
+    for (auto v : u64) EXPECT_EQ(v, 0x0807060504030201);
+
+    std::vector<unsigned char> bytes{1, 2, 3, 4, 5, 6};
+    util::swapBytes(bytes.data(), bytes.size(), 3);
+    EXPECT_EQ(bytes, (std::vector<unsigned char>{3, 2, 1, 6, 5, 4}));
+}
+
+TEST(ByteReaderUtil, ReadChunked) {
+    constexpr size_t header = 12;
+    const auto file = writeRaw(header);
+
+    std::vector<std::uint32_t> little(count);
+    EXPECT_TRUE(util::readBytesIntoBuffer(file.getFileName(), header, count * 4, true, 4,
+                                          little.data()));
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(little[i], i);
+    }
+
+    std::vector<std::uint32_t> big(count);
+    size_t calls = 0;
+    size_t last = 0;
+    EXPECT_TRUE(util::readBytesIntoBuffer(file.getFileName(), header, count * 4, false, 4,
+                                          big.data(), [&](size_t read, size_t total) {
+                                              EXPECT_GT(read, last);
+                                              EXPECT_EQ(total, count * 4);
+                                              last = read;
+                                              ++calls;
+                                          }));
+    EXPECT_GT(calls, 1);
+    EXPECT_EQ(last, count * 4);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(big[i], reversed(static_cast<std::uint32_t>(i)));
+    }
+}
+
+TEST(ByteReaderUtil, Cancel) {
+    const auto file = writeRaw(0);
+    std::vector<std::uint32_t> data(count);
+
+    CancellationSource source;
+    source.cancel();
+    EXPECT_FALSE(util::readBytesIntoBuffer(file.getFileName(), 0, count * 4, true, 4,
+                                           data.data(), {}, source.getToken()));
+}
+
+TEST(ByteReaderUtil, ReadPastEnd) {
+    const auto file = writeRaw(0);
+    std::vector<std::uint32_t> data(count + 1);
+    EXPECT_THROW(util::readBytesIntoBuffer(file.getFileName(), 0, data.size() * 4, true, 4,
+                                           data.data()),
+                 DataReaderException);
+}
+
+TEST(ByteReaderUtil, ReadBox) {
+    constexpr size3_t dims{5, 4, 3};
+    const util::IndexMapper3D im{dims};
+    util::TempFileHandle file{"inviwo", ".raw"};
+    std::vector<std::uint16_t> values(glm::compMul(dims));
+    std::iota(values.begin(), values.end(), std::uint16_t{0});
+    std::fwrite(values.data(), sizeof(std::uint16_t), values.size(), file);
+    std::fflush(file);
+
+    // Partial rows, complete rows, and complete slices
+    for (const auto& [offset, extent] : {std::pair{size3_t{1, 1, 0}, size3_t{3, 2, 3}},
+                                         std::pair{size3_t{0, 1, 1}, size3_t{5, 3, 2}},
+                                         std::pair{size3_t{0, 0, 1}, size3_t{5, 4, 1}}}) {
+        for (const bool littleEndian : {true, false}) {
+            std::vector<std::uint16_t> box(glm::compMul(extent));
+            EXPECT_TRUE(util::readBoxIntoBuffer(file.getFileName(), 0, dims, offset, extent,
+                                                littleEndian, 2, box.data()));
+            const util::IndexMapper3D boxIm{extent};
+            for (size_t z = 0; z < extent.z; ++z) {
+                for (size_t y = 0; y < extent.y; ++y) {
+                    for (size_t x = 0; x < extent.x; ++x) {
+                        const auto value = values[im(offset + size3_t{x, y, z})];
+                        const auto swapped =
+                            static_cast<std::uint16_t>((value >> 8) | (value << 8));
+                        EXPECT_EQ(box[boxIm(x, y, z)], littleEndian ? value : swapped);
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<std::uint16_t> box(8);
+    EXPECT_THROW(util::readBoxIntoBuffer(file.getFileName(), 0, dims, size3_t{4, 0, 0},
+                                         size3_t{2, 2, 2}, true, 2, box.data()),
+                 DataReaderException);
+}
+
+}  // namespace inviwo
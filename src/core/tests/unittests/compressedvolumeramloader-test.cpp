@@ -0,0 +1,138 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volumecompressedram.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/compressedvolumeramloader.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t header = 16;
+constexpr size_t brickSize = 8;
+constexpr size3_t dims{21, 17, 12};
+
+std::uint16_t value(const size3_t& p) {
+    // Zero in the upper part, so some bricks are empty
+    return p.z < 9 ? static_cast<std::uint16_t>(p.x + 100 * p.y + 10000 * (p.z % 5)) : 0;
+}
+
+util::TempFileHandle writeBricks() {
+    VolumeRAMPrecision<std::uint16_t> ram(dims);
+    const util::IndexMapper3D im{dims};
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                ram.getDataTyped()[im(x, y, z)] = value(size3_t{x, y, z});
+            }
+        }
+    }
+    std::ostringstream bricks;
+    util::writeCompressedBricks(VolumeCompressedRAM{ram, brickSize}, bricks);
+    const auto data = bricks.str();
+
+    util::TempFileHandle file{"inviwo", ".ivb"};
+    const std::string head(header, 'x');
+    std::fwrite(head.data(), 1, head.size(), file);
+    std::fwrite(data.data(), 1, data.size(), file);
+    std::fflush(file);
+    return file;
+}
+
+void expectValues(const VolumeRAM& ram, const size3_t& offset) {
+    const auto* data = static_cast<const std::uint16_t*>(ram.getData());
+    const auto extent = ram.getDimensions();
+    const util::IndexMapper3D im{extent};
+    for (size_t z = 0; z < extent.z; ++z) {
+        for (size_t y = 0; y < extent.y; ++y) {
+            for (size_t x = 0; x < extent.x; ++x) {
+                ASSERT_EQ(data[im(x, y, z)], value(offset + size3_t{x, y, z}))
+                    << "at " << x << ", " << y << ", " << z;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST(CompressedVolumeRAMLoader, Read) {
+    const auto file = writeBricks();
+    const VolumeDisk disk{dims, DataUInt16::get()};
+    const CompressedVolumeRAMLoader loader{file.getFileName(), header, brickSize};
+
+    auto ram = std::static_pointer_cast<VolumeRAM>(loader.createRepresentation(disk));
+    ASSERT_EQ(ram->getDimensions(), dims);
+    expectValues(*ram, size3_t{0});
+
+    // Regions within a brick, across bricks, and at the borders of the volume
+    for (const auto& [offset, extent] : {std::pair{size3_t{1, 2, 3}, size3_t{3, 2, 1}},
+                                         std::pair{size3_t{5, 6, 7}, size3_t{10, 9, 4}},
+                                         std::pair{size3_t{16, 0, 8}, size3_t{5, 17, 4}}}) {
+        auto region = loader.readRegion(disk, offset, extent);
+        ASSERT_EQ(region->getDimensions(), extent);
+        expectValues(*region, offset);
+    }
+}
+
+TEST(CompressedVolumeRAMLoader, OutOfBounds) {
+    const auto file = writeBricks();
+    const VolumeDisk disk{dims, DataUInt16::get()};
+    const CompressedVolumeRAMLoader loader{file.getFileName(), header, brickSize};
+
+    EXPECT_THROW(loader.readRegion(disk, size3_t{16, 0, 8}, size3_t{6, 17, 4}),
+                 DataReaderException);
+    EXPECT_THROW(loader.readRegion(disk, size3_t{0, 0, 12}, size3_t{1, 1, 1}),
+                 DataReaderException);
+}
+
+TEST(CompressedVolumeRAMLoader, Truncated) {
+    const auto file = writeBricks();
+    const VolumeDisk disk{dims * size3_t{2}, DataUInt16::get()};
+    const CompressedVolumeRAMLoader loader{file.getFileName(), header, brickSize};
+    EXPECT_THROW(loader.createRepresentation(disk), DataReaderException);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,169 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/conversionmetrics.h>
+#include <inviwo/core/datastructures/representationconverterfactory.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+
+#include <memory>
+#include <typeindex>
+
+namespace inviwo {
+
+namespace {
+
+class TestConverter : public RepresentationConverter<VolumeRepresentation> {
+public:
+    TestConverter(std::type_index from, std::type_index to, double cost)
+        : from_{from}, to_{to}, cost_{cost} {}
+
+    virtual ConverterID getConverterID() const override { return ConverterID{from_, to_}; }
+    virtual double getCost() const override { return cost_; }
+
+    virtual std::shared_ptr<VolumeRepresentation> createFrom(
+        std::shared_ptr<const VolumeRepresentation>) const override {
+        return nullptr;
+    }
+    virtual void update(std::shared_ptr<const VolumeRepresentation>,
+                        std::shared_ptr<VolumeRepresentation>) const override {}
+
+private:
+    std::type_index from_;
+    std::type_index to_;
+    double cost_;
+};
+
+class TestLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    virtual TestLoader* clone() const override { return new TestLoader(*this); }
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        return std::make_shared<VolumeRAMPrecision<float>>(src.getDimensions());
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation>,
+                                      const VolumeRepresentation&) const override {}
+};
+
+const std::type_index a{typeid(int)};
+const std::type_index b{typeid(float)};
+const std::type_index c{typeid(double)};
+
+}  // namespace
+
+TEST(ConversionMetrics, CheapestPath) {
+    TestConverter direct{a, c, 10.0};
+    TestConverter first{a, b, 1.0};
+    TestConverter second{b, c, 1.0};
+
+    RepresentationConverterFactory<VolumeRepresentation> factory;
+    factory.registerObject(&direct);
+    auto package = factory.getRepresentationConverter(a, c);
+    ASSERT_NE(package, nullptr);
+    EXPECT_EQ(package->steps(), size_t{1});
+    EXPECT_EQ(package->cost(), 10.0);
+
+    // Registering new converters makes the factory look for a cheaper path
+    factory.registerObject(&first);
+    factory.registerObject(&second);
+    package = factory.getRepresentationConverter(a, c);
+    ASSERT_NE(package, nullptr);
+    EXPECT_EQ(package->steps(), size_t{2});
+    EXPECT_EQ(package->cost(), 2.0);
+
+    EXPECT_EQ(factory.getRepresentationConverter(c, a), nullptr);
+}
+
+TEST(ConversionMetrics, KeepPackagesInUse) {
+    TestConverter direct{a, c, 10.0};
+    TestConverter first{a, b, 1.0};
+    TestConverter second{b, c, 1.0};
+
+    RepresentationConverterFactory<VolumeRepresentation> factory;
+    factory.registerObject(&direct);
+    const auto package = factory.getRepresentationConverter(a, c);
+    ASSERT_NE(package, nullptr);
+
+    // Invalidates the cached packages, but not the one we hold
+    factory.registerObject(&first);
+    factory.registerObject(&second);
+    EXPECT_EQ(package->steps(), size_t{1});
+    EXPECT_EQ(package->getConverters().front(), &direct);
+    EXPECT_NE(factory.getRepresentationConverter(a, c), package);
+    EXPECT_EQ(factory.getConverters().size(), size_t{3});
+}
+
+TEST(ConversionMetrics, FewestStepsOnEqualCost) {
+    TestConverter direct{a, c, 2.0};
+    TestConverter first{a, b, 1.0};
+    TestConverter second{b, c, 1.0};
+
+    RepresentationConverterFactory<VolumeRepresentation> factory;
+    factory.registerObject(&first);
+    factory.registerObject(&second);
+    factory.registerObject(&direct);
+    auto package = factory.getRepresentationConverter(a, c);
+    ASSERT_NE(package, nullptr);
+    EXPECT_EQ(package->steps(), size_t{1});
+}
+
+TEST(ConversionMetrics, Record) {
+    ConversionMetrics::reset();
+    EXPECT_EQ(ConversionMetrics::getCount(), size_t{0});
+
+    const size3_t dims{16, 8, 4};
+    auto disk = std::make_shared<VolumeDisk>(dims, DataFloat32::get());
+    disk->setLoader(new TestLoader());
+    Volume volume{disk};
+    volume.getRepresentation<VolumeRAM>();
+    volume.getRepresentation<VolumeRAM>();
+
+    const ConversionMetrics::ConverterID id{typeid(VolumeDisk), typeid(VolumeRAM)};
+    const auto entry = ConversionMetrics::get(id);
+    EXPECT_EQ(entry.count, size_t{1});
+    EXPECT_EQ(entry.bytes, dims.x * dims.y * dims.z * sizeof(float));
+    EXPECT_EQ(ConversionMetrics::getCount(), size_t{1});
+
+    const auto all = ConversionMetrics::get();
+    ASSERT_EQ(all.size(), size_t{1});
+    EXPECT_EQ(all.front().from, id.first);
+    EXPECT_EQ(all.front().to, id.second);
+
+    ConversionMetrics::reset();
+    EXPECT_EQ(ConversionMetrics::get(id).count, size_t{0});
+}
+
+}  // namespace inviwo
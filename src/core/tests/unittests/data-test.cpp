@@ -0,0 +1,217 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumebrickedram.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+TEST(Data, ConcurrentGetRepresentation) {
+    Volume volume{std::make_shared<VolumeRAMPrecision<float>>(size3_t{40, 30, 20})};
+    const auto* ram = volume.getRepresentation<VolumeRAM>();
+
+    constexpr size_t nThreads = 8;
+    std::vector<const VolumeBrickedRAM*> bricked(nThreads, nullptr);
+    std::atomic<size_t> mismatches{0};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < nThreads; ++i) {
+        threads.emplace_back([&, i]() {
+            for (int j = 0; j < 1000; ++j) {
+                if (volume.getRepresentation<VolumeRAM>() != ram) ++mismatches;
+                if (volume.getDimensions() != size3_t{40, 30, 20}) ++mismatches;
+            }
+            // Only one thread converts, the others get the same representation
+            bricked[i] = volume.getRepresentation<VolumeBrickedRAM>();
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(mismatches.load(), size_t{0});
+    for (auto* repr : bricked) {
+        EXPECT_EQ(repr, bricked.front());
+    }
+    EXPECT_TRUE(volume.hasValidRepresentation<VolumeBrickedRAM>());
+
+    // Editing invalidates the other representations, they are updated on the next access
+    volume.getEditableRepresentation<VolumeRAM>()->setFromDouble(size3_t{1, 2, 3}, 5.0);
+    EXPECT_FALSE(volume.hasValidRepresentation<VolumeBrickedRAM>());
+    EXPECT_EQ(volume.getRepresentation<VolumeBrickedRAM>()->getAsDouble(size3_t{1, 2, 3}), 5.0);
+    EXPECT_TRUE(volume.hasValidRepresentation<VolumeBrickedRAM>());
+}
+
+TEST(Data, CopyOnWriteVolume) {
+    Volume volume{std::make_shared<VolumeRAMPrecision<float>>(size3_t{16, 8, 4})};
+    volume.getEditableRepresentation<VolumeRAM>()->setFromDouble(size3_t{1, 2, 3}, 1.0);
+
+    std::unique_ptr<Volume> copy{volume.clone()};
+    const auto* ram = volume.getRepresentation<VolumeRAM>();
+    const auto* copyRam = copy->getRepresentation<VolumeRAM>();
+    EXPECT_NE(ram, copyRam);
+    EXPECT_EQ(ram->getData(), copyRam->getData());
+
+    // Metadata edits do not copy the data
+    copy->setSwizzleMask(swizzlemasks::luminance);
+    EXPECT_EQ(ram->getData(), copyRam->getData());
+
+    copy->getEditableRepresentation<VolumeRAM>()->setFromDouble(size3_t{1, 2, 3}, 2.0);
+    EXPECT_NE(ram->getData(), copyRam->getData());
+    EXPECT_EQ(ram->getAsDouble(size3_t{1, 2, 3}), 1.0);
+    EXPECT_EQ(copyRam->getAsDouble(size3_t{1, 2, 3}), 2.0);
+
+    // The original is no longer shared and is written in place
+    auto* data = volume.getEditableRepresentation<VolumeRAM>()->getData();
+    EXPECT_EQ(data, ram->getData());
+}
+
+TEST(Data, DetachInGetEditableRepresentation) {
+    Volume volume{std::make_shared<VolumeRAMPrecision<float>>(size3_t{16, 8, 4})};
+    auto* ram = volume.getEditableRepresentation<VolumeRAM>();
+    auto* data = ram->getData();
+
+    std::unique_ptr<Volume> copy{volume.clone()};
+    // Read access never copies
+    EXPECT_EQ(std::as_const(*ram).getData(), data);
+    EXPECT_EQ(copy->getRepresentation<VolumeRAM>()->getData(), data);
+
+    // The copy is made once, when asking for the editable representation
+    auto* copyRam = copy->getEditableRepresentation<VolumeRAM>();
+    auto* copyData = copyRam->getData();
+    EXPECT_NE(copyData, data);
+    copyRam->setFromDouble(size3_t{1, 2, 3}, 2.0);
+    EXPECT_EQ(copyRam->getData(), copyData);
+    EXPECT_EQ(ram->getAsDouble(size3_t{1, 2, 3}), 0.0);
+
+    // The original is no longer shared, pointers into it stay valid
+    EXPECT_EQ(ram->getData(), data);
+}
+
+TEST(Data, CopyOnWriteRepresentations) {
+    // Representations copied directly, not through their Data, detach when written to
+    VolumeRAMPrecision<float> volume{size3_t{4, 4, 4}};
+    VolumeRAMPrecision<float> volumeCopy{volume};
+    volumeCopy.getDataTyped()[1] = 1.0f;
+    volumeCopy.setFromDouble(size3_t{2, 0, 0}, 2.0);
+    EXPECT_EQ(volume.getAsDouble(size3_t{1, 0, 0}), 0.0);
+    EXPECT_EQ(volume.getAsDouble(size3_t{2, 0, 0}), 0.0);
+    EXPECT_EQ(volumeCopy.getAsDouble(size3_t{1, 0, 0}), 1.0);
+    EXPECT_EQ(volumeCopy.getAsDouble(size3_t{2, 0, 0}), 2.0);
+
+    LayerRAMPrecision<float> layer{size2_t{4, 4}};
+    LayerRAMPrecision<float> layerCopy{layer};
+    static_cast<float*>(layerCopy.getData())[1] = 1.0f;
+    EXPECT_EQ(layer.getAsDouble(size2_t{1, 0}), 0.0);
+    EXPECT_EQ(layerCopy.getAsDouble(size2_t{1, 0}), 1.0);
+
+    const std::vector<int> values{1, 2, 3};
+    BufferRAMPrecision<int> buffer{values};
+    const auto* bufferData = &std::as_const(buffer).getDataContainer();
+    const auto unchanged = [&]() {
+        EXPECT_EQ(&std::as_const(buffer).getDataContainer(), bufferData);
+        EXPECT_EQ(std::as_const(buffer).getDataContainer(), values);
+    };
+
+    // Like MeshClipping, which copies the input buffer and appends to it
+    BufferRAMPrecision<int> appended{buffer};
+    appended.add(4);
+    appended.add({5, 6});
+    appended.append(std::vector<int>{7});
+    unchanged();
+    EXPECT_EQ(appended.getSize(), size_t{7});
+
+    BufferRAMPrecision<int> edited{buffer};
+    edited.set(0, 10);
+    edited[1] = 20;
+    edited.get(2) = 30;
+    unchanged();
+    EXPECT_EQ(edited.getDataContainer(), (std::vector<int>{10, 20, 30}));
+
+    BufferRAMPrecision<int> container{buffer};
+    container.getDataContainer().push_back(4);
+    container.setFromDouble(0, 5.0);
+    static_cast<int*>(container.getData())[1] = 6;
+    unchanged();
+    EXPECT_EQ(container.getDataContainer(), (std::vector<int>{5, 6, 3, 4}));
+
+    BufferRAMPrecision<int> reserved{buffer};
+    reserved.reserve(1000);
+    unchanged();
+    EXPECT_GE(reserved.getDataContainer().capacity(), size_t{1000});
+
+    // Writing to the original does not change the copies
+    BufferRAMPrecision<int> copy{buffer};
+    buffer.set(0, 10);
+    EXPECT_EQ(std::as_const(copy).getDataContainer(), values);
+}
+
+TEST(Data, CopyOnWriteLayer) {
+    Layer layer{std::make_shared<LayerRAMPrecision<unsigned char>>(size2_t{16, 8})};
+    std::unique_ptr<Layer> copy{layer.clone()};
+    const auto* ram = layer.getRepresentation<LayerRAM>();
+    const auto* copyRam = copy->getRepresentation<LayerRAM>();
+    EXPECT_EQ(ram->getData(), copyRam->getData());
+
+    copy->getEditableRepresentation<LayerRAM>()->setFromDouble(size2_t{3, 4}, 7.0);
+    EXPECT_NE(ram->getData(), copyRam->getData());
+    EXPECT_EQ(ram->getAsDouble(size2_t{3, 4}), 0.0);
+    EXPECT_EQ(copyRam->getAsDouble(size2_t{3, 4}), 7.0);
+}
+
+TEST(Data, CopyOnWriteBuffer) {
+    Buffer<int> buffer{std::make_shared<BufferRAMPrecision<int>>(std::vector<int>{1, 2, 3})};
+    std::unique_ptr<Buffer<int>> copy{buffer.clone()};
+    const auto* ram = buffer.getRepresentation<BufferRAM>();
+    const auto* copyRam = copy->getRepresentation<BufferRAM>();
+    EXPECT_EQ(ram->getData(), copyRam->getData());
+
+    copy->getEditableRAMRepresentation()->add(4);
+    EXPECT_NE(ram->getData(), copyRam->getData());
+    EXPECT_EQ(ram->getSize(), size_t{3});
+    EXPECT_EQ(copyRam->getSize(), size_t{4});
+
+    copy->getEditableRAMRepresentation()->clear();
+    EXPECT_EQ(ram->getSize(), size_t{3});
+}
+
+}  // namespace inviwo
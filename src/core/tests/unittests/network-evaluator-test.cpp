@@ -35,14 +35,19 @@
 #include <inviwo/core/common/inviwoapplication.h>
 
 #include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/processormemocache.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/network/processornetworkevaluator.h>
 #include <inviwo/core/network/networklock.h>
 
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/util/zip.h>
 
+#include <array>
 #include <functional>
+#include <string>
+#include <vector>
 
 namespace inviwo {
 
@@ -77,6 +82,9 @@ const ProcessorInfo TestProcessor::processorInfo_{
     "Testing",                   // Category
     CodeState::Stable,           // Code state
     Tags::CPU,                   // Tags
+    Document{},                  // Help
+    true,                        // Visible
+    ProcessingThread::Any,       // Processing thread
 };
 
 struct Instrument {
@@ -256,4 +264,368 @@ TEST(NetworkEvaluator, Error) {
     }
 }
 
+TEST(NetworkEvaluator, InvalidatedDuringEval) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    auto at = createA();
+    auto a = at.get();
+    Instrument ai(*a);
+    auto bt = createB();
+    auto b = bt.get();
+    Instrument bi(*b);
+    auto ct = createA();
+    auto c = ct.get();
+    c->setIdentifier("c");
+    Instrument ci(*c);
+    auto dt = createB();
+    auto d = dt.get();
+    d->setIdentifier("d");
+    Instrument di(*d);
+
+    // a invalidates c while processing, as a property link would
+    bool invalidateC = false;
+    a->onProcess = [func = a->onProcess, c, &invalidateC](TestProcessor& p) {
+        func(p);
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+        if (invalidateC) c->invalidate(InvalidationLevel::InvalidOutput);
+    };
+    c->onProcess = [func = c->onProcess](TestProcessor& p) {
+        func(p);
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(1));
+    };
+
+    network.addProcessor(std::move(at));
+    network.addProcessor(std::move(bt));
+    network.addProcessor(std::move(ct));
+    network.addProcessor(std::move(dt));
+    network.addConnection(a->getOutports()[0], b->getInports()[0]);
+    network.addConnection(c->getOutports()[0], d->getInports()[0]);
+    for (auto* i : {&ai, &bi, &ci, &di}) i->reset();
+
+    struct EndObserver : ProcessorNetworkEvaluationObserver {
+        std::function<void()> onEnd;
+        virtual void onProcessorNetworkEvaluationEnd() override { onEnd(); }
+    };
+    int evaluations = 0;
+    bool validAfterFirst = false;
+    EndObserver observer;
+    observer.onEnd = [&]() {
+        if (evaluations++ == 0) validAfterFirst = c->isValid() && d->isValid();
+    };
+    evaluator.addObserver(&observer);
+
+    invalidateC = true;
+    a->invalidate(InvalidationLevel::InvalidOutput);
+    invalidateC = false;
+
+    EXPECT_TRUE(validAfterFirst);
+    ai.checkAndReset(0, 1, 0);
+    bi.checkAndReset(0, 1, 0);
+    ci.checkAndReset(0, 1, 0);
+    di.checkAndReset(0, 1, 0);
+    evaluator.removeObserver(&observer);
+}
+
+TEST(NetworkEvaluator, ParallelEval) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    evaluator.setEvaluationMode(EvaluationMode::Parallel);
+    EXPECT_EQ(TestProcessor::processorInfo_.processingThread, ProcessingThread::Any);
+    // Processors have to opt in to be processed in the thread pool
+    EXPECT_EQ((ProcessorInfo{"id", "name", "category", CodeState::Stable, Tags::CPU})
+                  .processingThread,
+              ProcessingThread::Front);
+
+    auto at = createA();
+    auto a = at.get();
+    Instrument ai(*a);
+    a->onProcess = [func = a->onProcess](TestProcessor& p) {
+        func(p);
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(1));
+    };
+
+    auto bt = createB();
+    auto b = bt.get();
+    Instrument bi(*b);
+    int bValue = 0;
+    b->onProcess = [func = b->onProcess, &bValue](TestProcessor& p) {
+        func(p);
+        bValue = *static_cast<DataInport<int>*>(p.getInports()[0])->getData();
+    };
+
+    auto ct = createB();
+    ct->setIdentifier("c");
+    auto c = ct.get();
+    Instrument ci(*c);
+    int cValue = 0;
+    c->onProcess = [func = c->onProcess, &cValue](TestProcessor& p) {
+        func(p);
+        cValue = *static_cast<DataInport<int>*>(p.getInports()[0])->getData();
+    };
+
+    {
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(at));
+        network.addProcessor(std::move(bt));
+        network.addProcessor(std::move(ct));
+        network.addConnection(a->getOutports()[0], b->getInports()[0]);
+        network.addConnection(a->getOutports()[0], c->getInports()[0]);
+    }
+
+    {
+        SCOPED_TRACE("Branches");
+        ai.checkAndReset(1, 1, 0);
+        bi.checkAndReset(1, 1, 0);
+        ci.checkAndReset(1, 1, 0);
+        EXPECT_EQ(bValue, 1);
+        EXPECT_EQ(cValue, 1);
+        EXPECT_TRUE(a->isValid());
+        EXPECT_TRUE(b->isValid());
+        EXPECT_TRUE(c->isValid());
+    }
+
+    {
+        SCOPED_TRACE("Invalid branch");
+        c->invalidate(InvalidationLevel::InvalidOutput);
+        ai.checkAndReset(0, 0, 0);
+        bi.checkAndReset(0, 0, 0);
+        ci.checkAndReset(0, 1, 0);
+    }
+}
+
+TEST(NetworkEvaluator, Memoization) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    const std::array<std::shared_ptr<const int>, 2> values{std::make_shared<int>(1),
+                                                           std::make_shared<int>(2)};
+    size_t index = 0;
+
+    auto at = createA();
+    auto a = at.get();
+    Instrument ai(*a);
+    a->onProcess = [func = a->onProcess, &values, &index](TestProcessor& p) {
+        func(p);
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(values[index]);
+    };
+
+    auto mt = createB();
+    mt->setIdentifier("m");
+    mt->addPort(std::make_unique<DataOutport<int>>("out"));
+    auto m = mt.get();
+    Instrument mi(*m);
+    m->onProcess = [func = m->onProcess](TestProcessor& p) {
+        func(p);
+        const auto value = *static_cast<DataInport<int>*>(p.getInports()[0])->getData();
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(
+            std::make_shared<int>(10 * value));
+    };
+    m->setMemoizationCapacity(2);
+
+    auto ct = createB();
+    ct->setIdentifier("c");
+    auto c = ct.get();
+    Instrument ci(*c);
+    int cValue = 0;
+    c->onProcess = [func = c->onProcess, &cValue](TestProcessor& p) {
+        func(p);
+        cValue = *static_cast<DataInport<int>*>(p.getInports()[0])->getData();
+    };
+
+    {
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(at));
+        network.addProcessor(std::move(mt));
+        network.addProcessor(std::move(ct));
+        network.addConnection(a->getOutports()[0], m->getInports()[0]);
+        network.addConnection(m->getOutports()[0], c->getInports()[0]);
+    }
+    ai.reset();
+    mi.checkAndReset(1, 1, 0);
+    ci.reset();
+    EXPECT_EQ(cValue, 10);
+
+    auto* cache = m->getMemoCache();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(cache->size(), 1u);
+
+    {
+        SCOPED_TRACE("New input");
+        index = 1;
+        a->invalidate(InvalidationLevel::InvalidOutput);
+        mi.checkAndReset(0, 1, 0);
+        ci.checkAndReset(0, 1, 0);
+        EXPECT_EQ(cValue, 20);
+        EXPECT_EQ(cache->size(), 2u);
+    }
+    {
+        SCOPED_TRACE("Previous input");
+        index = 0;
+        a->invalidate(InvalidationLevel::InvalidOutput);
+        mi.checkAndReset(0, 0, 0);
+        ci.checkAndReset(0, 1, 0);
+        EXPECT_EQ(cValue, 10);
+        EXPECT_EQ(cache->getHits(), 1u);
+        EXPECT_TRUE(m->isValid());
+    }
+    {
+        SCOPED_TRACE("Modified in place");
+        a->invalidate(InvalidationLevel::InvalidOutput);
+        mi.checkAndReset(0, 1, 0);
+        EXPECT_EQ(cache->getHits(), 1u);
+    }
+    {
+        SCOPED_TRACE("Disabled");
+        m->setMemoizationCapacity(0);
+        EXPECT_EQ(m->getMemoCache(), nullptr);
+        index = 1;
+        a->invalidate(InvalidationLevel::InvalidOutput);
+        mi.checkAndReset(0, 1, 0);
+        EXPECT_EQ(cValue, 20);
+    }
+}
+
+TEST(NetworkEvaluator, ConsumedOutports) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    auto at = createA();
+    at->addPort(std::make_unique<DataOutport<int>>("out2"));
+    auto a = at.get();
+    Instrument ai(*a);
+    int aValue = 0;
+    a->onProcess = [func = a->onProcess, &aValue](TestProcessor& p) {
+        func(p);
+        ++aValue;
+        // Skip the ports that are not consumed, they keep their last data
+        for (auto outport : p.getOutports()) {
+            if (outport->isConsumed()) {
+                static_cast<DataOutport<int>*>(outport)->setData(std::make_shared<int>(aValue));
+            }
+        }
+    };
+
+    auto bt = createB();
+    auto b = bt.get();
+    Instrument bi(*b);
+
+    auto ct = createB();
+    ct->setIdentifier("c");
+    auto c = ct.get();
+    Instrument ci(*c);
+    int cValue = 0;
+    c->onProcess = [func = c->onProcess, &cValue](TestProcessor& p) {
+        func(p);
+        cValue = *static_cast<DataInport<int>*>(p.getInports()[0])->getData();
+    };
+
+    {
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(at));
+        network.addProcessor(std::move(bt));
+        network.addProcessor(std::move(ct));
+        network.addConnection(a->getOutports()[0], b->getInports()[0]);
+    }
+
+    {
+        SCOPED_TRACE("One consumed outport");
+        ai.checkAndReset(1, 1, 0);
+        bi.checkAndReset(1, 1, 0);
+        ci.reset();
+        EXPECT_TRUE(a->getOutports()[0]->isConsumed());
+        EXPECT_FALSE(a->getOutports()[1]->isConsumed());
+        EXPECT_FALSE(a->getOutports()[1]->hasData());
+    }
+
+    {
+        SCOPED_TRACE("Connect second outport");
+        network.addConnection(a->getOutports()[1], c->getInports()[0]);
+        ai.checkAndReset(0, 1, 0);
+        ci.checkAndReset(1, 1, 0);
+        EXPECT_TRUE(a->getOutports()[1]->isConsumed());
+        EXPECT_EQ(cValue, 2);
+    }
+
+    {
+        SCOPED_TRACE("Disconnect and process, the last data is kept");
+        network.removeConnection(a->getOutports()[1], c->getInports()[0]);
+        EXPECT_FALSE(a->getOutports()[1]->isConsumed());
+        a->invalidate(InvalidationLevel::InvalidOutput);
+        ai.checkAndReset(0, 1, 0);
+        ci.reset();
+        ASSERT_TRUE(a->getOutports()[1]->hasData());
+        EXPECT_EQ(*static_cast<DataOutport<int>*>(a->getOutports()[1])->getData(), 2);
+    }
+
+    {
+        SCOPED_TRACE("Reconnect, the stale data is replaced");
+        network.addConnection(a->getOutports()[1], c->getInports()[0]);
+        EXPECT_TRUE(a->getOutports()[1]->isConsumed());
+        ai.checkAndReset(0, 1, 0);
+        EXPECT_EQ(cValue, 4);
+    }
+}
+
+TEST(NetworkEvaluator, Worklist) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    std::vector<TestProcessor*> sources;
+    std::vector<TestProcessor*> sinks;
+    std::vector<std::unique_ptr<Instrument>> instruments;
+    {
+        NetworkLock lock(&network);
+        for (int i = 0; i < 3; ++i) {
+            auto at = createA();
+            at->setIdentifier("a" + std::to_string(i));
+            auto bt = createB();
+            bt->setIdentifier("b" + std::to_string(i));
+            sources.push_back(at.get());
+            sinks.push_back(bt.get());
+            network.addProcessor(std::move(at));
+            network.addProcessor(std::move(bt));
+        }
+        for (auto p : sources) instruments.push_back(std::make_unique<Instrument>(*p));
+        for (auto p : sinks) instruments.push_back(std::make_unique<Instrument>(*p));
+        for (auto [a, b] : util::zip(sources, sinks)) {
+            a->onProcess = [func = a->onProcess](TestProcessor& p) {
+                func(p);
+                auto outport = static_cast<DataOutport<int>*>(p.getOutports()[0]);
+                outport->setData(std::make_shared<int>(0));
+            };
+            network.addConnection(a->getOutports()[0], b->getInports()[0]);
+        }
+    }
+    for (auto& instrument : instruments) instrument->checkAndReset(1, 1, 0);
+
+    {
+        SCOPED_TRACE("Invalidate one branch");
+        sources[1]->invalidate(InvalidationLevel::InvalidOutput);
+        instruments[0]->checkAndReset(0, 0, 0);
+        instruments[1]->checkAndReset(0, 1, 0);
+        instruments[2]->checkAndReset(0, 0, 0);
+        instruments[3]->checkAndReset(0, 0, 0);
+        instruments[4]->checkAndReset(0, 1, 0);
+        instruments[5]->checkAndReset(0, 0, 0);
+    }
+
+    auto ct = createB();
+    ct->setIdentifier("c");
+    auto c = ct.get();
+    Instrument ci(*c);
+    {
+        SCOPED_TRACE("Add a new sink");
+        network.addProcessor(std::move(ct));
+        ci.checkAndReset(0, 0, 1);
+    }
+    {
+        SCOPED_TRACE("Connect the new sink");
+        network.addConnection(sources[2]->getOutports()[0], c->getInports()[0]);
+        ci.checkAndReset(1, 1, 0);
+        for (auto& instrument : instruments) instrument->checkAndReset(0, 0, 0);
+        EXPECT_TRUE(c->isValid());
+    }
+}
+
 }  // namespace inviwo
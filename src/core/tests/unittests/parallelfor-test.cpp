@@ -0,0 +1,154 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/parallelfor.h>
+
+#include <atomic>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+void testVisitEachOnce(ThreadPool* pool, const size3_t& dims,
+                       const util::ParallelSettings& settings) {
+    std::vector<std::atomic<int>> visits(dims.x * dims.y * dims.z);
+    util::parallelFor(
+        pool, dims,
+        [&](const size3_t& pos) { ++visits[pos.x + dims.x * (pos.y + dims.y * pos.z)]; },
+        settings);
+    for (const auto& v : visits) EXPECT_EQ(v.load(), 1);
+}
+
+}  // namespace
+
+TEST(ParallelFor, VisitEachOnce) {
+    ThreadPool pool(3);
+    testVisitEachOnce(&pool, size3_t{37, 5, 300}, {});
+    testVisitEachOnce(&pool, size3_t{300, 301, 2}, {});
+    testVisitEachOnce(&pool, size3_t{7, 9, 11}, {size3_t{2, 3, 4}, 5});
+    testVisitEachOnce(&pool, size3_t{1, 1, 1}, {});
+    testVisitEachOnce(nullptr, size3_t{17, 13, 11}, {size3_t{4, 0, 0}, 0});
+}
+
+TEST(ParallelFor, BrickTiling) {
+    // A flat volume should still be split into many bricks, not a few z-slabs
+    const size3_t dims{2048, 2048, 8};
+    const auto brick = util::defaultBrickSize(dims);
+    EXPECT_LE(brick.z, dims.z);
+    EXPECT_GE((dims.x / brick.x) * (dims.y / brick.y) * (dims.z / brick.z), 64);
+
+    EXPECT_EQ(util::defaultBrickSize(dims, size3_t{16, 8, 4}), (size3_t{16, 8, 4}));
+
+    ThreadPool pool(2);
+    std::atomic<size_t> bricks{0};
+    util::parallelForBricks(
+        &pool, size3_t{10, 10, 10},
+        [&](const size3_t& begin, const size3_t& end) {
+            EXPECT_EQ(end - begin, (size3_t{5, 5, 5}));
+            ++bricks;
+        },
+        {size3_t{5, 5, 5}, 0});
+    EXPECT_EQ(bricks, 8);
+}
+
+TEST(ParallelFor, Reduce) {
+    ThreadPool pool(3);
+    const size3_t dims{65, 33, 17};
+    const auto expected = dims.x * dims.y * dims.z * (dims.x - 1) / 2;
+
+    for (size_t jobs : {0, 1, 3, 1000}) {
+        const auto sum = util::parallelReduce(
+            &pool, dims, size_t{0}, [](size_t& state, const size3_t& pos) { state += pos.x; },
+            [](size_t a, size_t b) { return a + b; }, {size3_t{8, 8, 8}, jobs});
+        ASSERT_TRUE(sum);
+        EXPECT_EQ(*sum, expected);
+    }
+
+    const auto serial = util::parallelReduce(
+        nullptr, dims, size_t{0}, [](size_t& state, const size3_t& pos) { state += pos.x; },
+        [](size_t a, size_t b) { return a + b; });
+    EXPECT_EQ(serial, expected);
+
+    const auto empty = util::parallelReduce(
+        &pool, size3_t{0, 4, 4}, 42, [](int& state, const size3_t&) { state = 0; },
+        [](int a, int b) { return a + b; });
+    EXPECT_EQ(empty, 42);
+}
+
+TEST(ParallelFor, ReduceBool) {
+    // Each task writes its own state concurrently, which must not share storage even for bool
+    ThreadPool pool(4);
+    const size3_t dims{64, 64, 64};
+    for (int i = 0; i < 10; ++i) {
+        const auto found = util::parallelReduce(
+            &pool, dims, false,
+            [](bool& state, const size3_t& pos) { state = state || pos == size3_t{63, 63, 63}; },
+            [](bool a, bool b) { return a || b; }, {size3_t{4, 4, 4}, 64});
+        ASSERT_TRUE(found);
+        EXPECT_TRUE(*found);
+    }
+}
+
+TEST(ParallelFor, ReduceCancelled) {
+    ThreadPool pool(2);
+    CancellationSource source;
+    auto result = pool.enqueue(TaskPriority::Normal, source.getToken(), [&pool, &source]() {
+        return util::parallelReduce(
+            &pool, size3_t{64, 64, 64}, size_t{0},
+            [&source](size_t& state, const size3_t&) {
+                source.cancel();
+                ++state;
+            },
+            [](size_t a, size_t b) { return a + b; }, {size3_t{8, 8, 8}, 0});
+    });
+    EXPECT_EQ(result.get(), std::nullopt);
+}
+
+TEST(ParallelFor, Exceptions) {
+    ThreadPool pool(2);
+    EXPECT_THROW(util::parallelFor(&pool, size3_t{32, 32, 32},
+                                   [](const size3_t& pos) {
+                                       if (pos == size3_t{31, 31, 31}) {
+                                           throw std::runtime_error("parallelFor");
+                                       }
+                                   }),
+                 std::runtime_error);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,136 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/profiler.h>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+const Profiler::Stats* find(const std::vector<Profiler::Stats>& stats, std::string_view name) {
+    auto it = std::find_if(stats.begin(), stats.end(),
+                           [&](const Profiler::Stats& s) { return s.name == name; });
+    return it != stats.end() ? &*it : nullptr;
+}
+
+}  // namespace
+
+TEST(Profiler, Disabled) {
+    Profiler::setEnabled(false);
+    Profiler::reset();
+    for (int i = 0; i < 10; ++i) {
+        IVW_PROFILE_SCOPE("test::disabled");
+    }
+    EXPECT_EQ(find(Profiler::collect(), "test::disabled"), nullptr);
+}
+
+TEST(Profiler, Counter) {
+    Profiler::reset();
+    Profiler::setEnabled(true);
+
+    // More samples than fit in a ring buffer from several threads
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 1; i <= 10000; ++i) IVW_PROFILE_COUNT("test::counter", i);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    Profiler::setEnabled(false);
+
+    const auto stats = Profiler::collect();
+    const auto* counter = find(stats, "test::counter");
+    ASSERT_NE(counter, nullptr);
+    EXPECT_EQ(counter->kind, Profiler::Kind::Counter);
+    EXPECT_EQ(counter->count + Profiler::getDropped(), 40000);
+    if (Profiler::getDropped() == 0) {
+        EXPECT_EQ(counter->total, 4 * 10000 * 10001 / 2);
+        EXPECT_EQ(counter->min, 1);
+        EXPECT_EQ(counter->max, 10000);
+        EXPECT_NEAR(static_cast<double>(counter->p50), 5000.0, 5000.0 / 16);
+        EXPECT_NEAR(static_cast<double>(counter->p95), 9500.0, 9500.0 / 16);
+        EXPECT_NEAR(static_cast<double>(counter->p99), 9900.0, 9900.0 / 16);
+    }
+}
+
+TEST(Profiler, Timer) {
+    Profiler::reset();
+    Profiler::setEnabled(true);
+    for (int i = 0; i < 5; ++i) {
+        IVW_PROFILE_SCOPE("test::timer");
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    Profiler::setEnabled(false);
+
+    const auto stats = Profiler::collect();
+    const auto* timer = find(stats, "test::timer");
+    ASSERT_NE(timer, nullptr);
+    EXPECT_EQ(timer->count, 5);
+    EXPECT_GE(timer->min, 1'000'000);
+    EXPECT_LE(timer->p50, timer->max);
+
+    std::stringstream ss;
+    Profiler::dump(ss);
+    EXPECT_NE(ss.str().find("test::timer"), std::string::npos);
+
+    EXPECT_EQ(Profiler::registerProbe("test::timer", Profiler::Kind::Timer),
+              Profiler::registerProbe("test::timer", Profiler::Kind::Timer));
+}
+
+TEST(Profiler, TimerPerName) {
+    Profiler::reset();
+    Profiler::setEnabled(true);
+    for (const auto* name : {"test::first", "test::second", "test::second"}) {
+        const ProfilerTimer timer{Profiler::registerProbe(name, Profiler::Kind::Timer)};
+    }
+    {
+        const ProfilerTimer timer{Profiler::noProbe};
+    }
+    Profiler::setEnabled(false);
+
+    const auto stats = Profiler::collect();
+    ASSERT_NE(find(stats, "test::first"), nullptr);
+    ASSERT_NE(find(stats, "test::second"), nullptr);
+    EXPECT_EQ(find(stats, "test::first")->count, 1);
+    EXPECT_EQ(find(stats, "test::second")->count, 2);
+    EXPECT_EQ(Profiler::getDropped(), 0);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,122 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/ramallocation.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+namespace {
+
+bool isAligned(const void* ptr, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+class CountingAllocator : public AlignedRAMAllocator {
+public:
+    virtual void* allocate(size_t bytes, const RAMAllocation& allocation) override {
+        ++allocations;
+        return AlignedRAMAllocator::allocate(bytes, allocation);
+    }
+    virtual void deallocate(void* ptr, size_t bytes,
+                            const RAMAllocation& allocation) noexcept override {
+        ++deallocations;
+        AlignedRAMAllocator::deallocate(ptr, bytes, allocation);
+    }
+
+    size_t allocations = 0;
+    size_t deallocations = 0;
+};
+
+}  // namespace
+
+TEST(RAMAllocation, Aligned) {
+    for (auto alignment : {size_t{16}, size_t{64}, size_t{4096}}) {
+        auto data = util::makeRAMArray<float>(1001, RAMAllocation{RAMAllocation::Init::Zero,
+                                                                  alignment, false});
+        EXPECT_TRUE(isAligned(data.get(), alignment));
+        EXPECT_TRUE(std::all_of(data.get(), data.get() + 1001, [](float v) { return v == 0.0f; }));
+    }
+
+    VolumeRAMPrecision<vec4> volume{size3_t{7, 5, 3}};
+    EXPECT_TRUE(isAligned(volume.getData(), RAMAllocation::defaultAlignment));
+}
+
+TEST(RAMAllocation, HugePages) {
+    const size_t size = 3 * 1024 * 1024;
+    auto data = util::makeRAMArray<std::uint8_t>(size, RAMAllocation{RAMAllocation::Init::Zero,
+                                                                     64, true});
+    EXPECT_TRUE(isAligned(data.get(), 64));
+    EXPECT_TRUE(std::all_of(data.get(), data.get() + size, [](auto v) { return v == 0; }));
+}
+
+TEST(RAMAllocation, Zero) {
+    // Large enough to be zeroed in parallel
+    const size3_t dims{256, 256, 64};
+    auto volume = createVolumeRAM(dims, DataUInt8::get(), RAMAllocation{});
+    const auto* data = static_cast<const std::uint8_t*>(volume->getData());
+    EXPECT_TRUE(std::all_of(data, data + glm::compMul(dims), [](auto v) { return v == 0; }));
+
+    LayerRAMPrecision<float> depth{size2_t{8, 8}, RAMAllocation{}, LayerType::Depth};
+    EXPECT_EQ(depth.getAsDouble(size2_t{3, 4}), 1.0);
+}
+
+TEST(RAMAllocation, CustomAllocator) {
+    auto allocator = std::make_shared<CountingAllocator>();
+    util::setRAMAllocator(allocator);
+
+    auto volume = createVolumeRAM(size3_t{4, 4, 4}, DataFloat32::get(),
+                                  RAMAllocation::uninitialized());
+    auto layer = createLayerRAM(size2_t{4, 4}, LayerType::Color, DataVec4UInt8::get());
+    std::unique_ptr<VolumeRAM> copy{volume->clone()};
+    copy->detach();
+    EXPECT_EQ(allocator->allocations, size_t{3});
+
+    util::setRAMAllocator(nullptr);
+    EXPECT_NE(util::getRAMAllocator(), allocator);
+
+    // Existing data is returned to the allocator it came from
+    volume.reset();
+    layer.reset();
+    copy.reset();
+    EXPECT_EQ(allocator->deallocations, size_t{3});
+}
+
+}  // namespace inviwo
@@ -0,0 +1,118 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t header = 8;
+constexpr size3_t dims{4, 3, 2};
+
+util::TempFileHandle writeRaw() {
+    util::TempFileHandle file{"inviwo", ".raw"};
+    std::array<char, header> head{};
+    std::array<std::uint16_t, 4 * 3 * 2> values{};
+    std::iota(values.begin(), values.end(), std::uint16_t{1});
+    std::fwrite(head.data(), 1, head.size(), file);
+    std::fwrite(values.data(), sizeof(std::uint16_t), values.size(), file);
+    std::fflush(file);
+    return file;
+}
+
+}  // namespace
+
+TEST(RawVolumeRAMLoader, Mapped) {
+    auto file = writeRaw();
+    const VolumeDisk disk{dims, DataUInt16::get()};
+
+    RawVolumeRAMLoader loader{file.getFileName(), header, true, true};
+    auto repr = std::static_pointer_cast<VolumeRAM>(loader.createRepresentation(disk));
+    ASSERT_TRUE(repr);
+    EXPECT_EQ(repr->getDimensions(), dims);
+    EXPECT_EQ(repr->getAsDouble(size3_t{0, 0, 0}), 1.0);
+    EXPECT_EQ(repr->getAsDouble(size3_t{3, 2, 1}), 24.0);
+
+    // Changes are not written back to the file
+    repr->setFromDouble(size3_t{0, 0, 0}, 42.0);
+    EXPECT_EQ(repr->getAsDouble(size3_t{0, 0, 0}), 42.0);
+    auto reloaded = std::static_pointer_cast<VolumeRAM>(loader.createRepresentation(disk));
+    EXPECT_EQ(reloaded->getAsDouble(size3_t{0, 0, 0}), 1.0);
+
+    // Copies own their data
+    std::unique_ptr<VolumeRAM> copy{repr->clone()};
+    repr.reset();
+    EXPECT_EQ(copy->getAsDouble(size3_t{0, 0, 0}), 42.0);
+    EXPECT_EQ(copy->getAsDouble(size3_t{3, 2, 1}), 24.0);
+}
+
+TEST(RawVolumeRAMLoader, NotMappedByDefault) {
+    auto file = writeRaw();
+    const VolumeDisk disk{dims, DataUInt16::get()};
+
+    RawVolumeRAMLoader loader{file.getFileName(), header, true};
+    auto repr = std::static_pointer_cast<VolumeRAM>(loader.createRepresentation(disk));
+    EXPECT_EQ(repr->getAsDouble(size3_t{3, 2, 1}), 24.0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(repr->getData()) %
+                  RAMAllocation::defaultAlignment,
+              std::uintptr_t{0});
+
+    // The file can be overwritten without affecting the loaded data
+    std::fseek(file, header, SEEK_SET);
+    const std::uint16_t zero = 0;
+    std::fwrite(&zero, sizeof(zero), 1, file);
+    std::fflush(file);
+    EXPECT_EQ(repr->getAsDouble(size3_t{0, 0, 0}), 1.0);
+}
+
+TEST(RawVolumeRAMLoader, ByteSwapped) {
+    auto file = writeRaw();
+    const VolumeDisk disk{dims, DataUInt16::get()};
+
+    RawVolumeRAMLoader loader{file.getFileName(), header, false};
+    auto repr = std::static_pointer_cast<VolumeRAM>(loader.createRepresentation(disk));
+    EXPECT_EQ(repr->getAsDouble(size3_t{0, 0, 0}), 256.0);
+    EXPECT_EQ(repr->getAsDouble(size3_t{1, 0, 0}), 512.0);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,226 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/representationusage.h>
+#include <inviwo/core/datastructures/residencymanager.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/templatesampler.h>
+#include <inviwo/core/util/volumesampler.h>
+
+#include <memory>
+
+namespace inviwo {
+
+namespace {
+
+class CountingLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    CountingLoader(int& loads) : loads_{loads} {}
+    virtual CountingLoader* clone() const override { return new CountingLoader(*this); }
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        ++loads_;
+        return std::make_shared<VolumeRAMPrecision<float>>(src.getDimensions());
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation>,
+                                      const VolumeRepresentation&) const override {
+        ++loads_;
+    }
+
+private:
+    int& loads_;
+};
+
+std::unique_ptr<Volume> makeVolume(int& loads) {
+    auto disk = std::make_shared<VolumeDisk>(size3_t{16, 16, 16}, DataFloat32::get());
+    disk->setLoader(new CountingLoader(loads));
+    return std::make_unique<Volume>(disk);
+}
+
+constexpr size_t volumeBytes = 16 * 16 * 16 * sizeof(float);
+
+}  // namespace
+
+TEST(ResidencyManager, Disabled) {
+    ResidencyManager::clear();
+    int loads = 0;
+    auto volume = makeVolume(loads);
+    volume->getRepresentation<VolumeRAM>();
+    EXPECT_EQ(loads, 1);
+    EXPECT_EQ(ResidencyManager::size(), 0u);
+}
+
+TEST(ResidencyManager, EvictAndReload) {
+    ResidencyManager::clear();
+    ResidencyManager::setBudget(volumeBytes);
+    util::OnScopeExit reset{[]() {
+        ResidencyManager::setBudget(0);
+        ResidencyManager::clear();
+    }};
+
+    int loadsA = 0;
+    int loadsB = 0;
+    auto a = makeVolume(loadsA);
+    auto b = makeVolume(loadsB);
+    const auto evictions = ResidencyManager::getEvictions();
+
+    a->getRepresentation<VolumeRAM>();
+    EXPECT_EQ(ResidencyManager::getResidentBytes(), volumeBytes);
+    ResidencyManager::nextEpoch();
+
+    // Uses never evict, the budget is only enforced when the next epoch starts
+    b->getRepresentation<VolumeRAM>();
+    EXPECT_EQ(ResidencyManager::getResidentBytes(), 2 * volumeBytes);
+    EXPECT_TRUE(a->hasRepresentation<VolumeRAM>());
+
+    ResidencyManager::nextEpoch();
+    EXPECT_EQ(ResidencyManager::getResidentBytes(), volumeBytes);
+    EXPECT_EQ(ResidencyManager::getEvictions(), evictions + 1);
+    EXPECT_FALSE(a->hasRepresentation<VolumeRAM>());
+    EXPECT_TRUE(b->hasRepresentation<VolumeRAM>());
+
+    // Transparently reloaded, b is evicted in turn since it is now the least recently used one
+    a->getRepresentation<VolumeRAM>();
+    EXPECT_EQ(loadsA, 2);
+    EXPECT_TRUE(b->hasRepresentation<VolumeRAM>());
+    ResidencyManager::nextEpoch();
+    EXPECT_EQ(loadsB, 1);
+    EXPECT_FALSE(b->hasRepresentation<VolumeRAM>());
+    EXPECT_TRUE(a->hasRepresentation<VolumeRAM>());
+    EXPECT_EQ(ResidencyManager::getResidentBytes(), volumeBytes);
+}
+
+TEST(ResidencyManager, KeepShared) {
+    ResidencyManager::clear();
+    ResidencyManager::setBudget(volumeBytes / 2);
+    util::OnScopeExit reset{[]() {
+        ResidencyManager::setBudget(0);
+        ResidencyManager::clear();
+    }};
+
+    int loads = 0;
+    auto volume = makeVolume(loads);
+    auto ram = volume->getRepresentationShared<VolumeRAM>();
+    ResidencyManager::nextEpoch();
+    EXPECT_TRUE(volume->hasRepresentation<VolumeRAM>());
+
+    ram.reset();
+    ResidencyManager::enforce();
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+    EXPECT_EQ(ResidencyManager::size(), 0u);
+
+    volume.reset();
+    EXPECT_EQ(ResidencyManager::getResidentBytes(), 0u);
+}
+
+TEST(ResidencyManager, KeepSampled) {
+    ResidencyManager::clear();
+    ResidencyManager::setBudget(1);
+    util::OnScopeExit reset{[]() {
+        ResidencyManager::setBudget(0);
+        ResidencyManager::clear();
+    }};
+
+    int loads = 0;
+    auto volume = makeVolume(loads);
+    {
+        // Samplers outlive the evaluation they were created in
+        auto sampler = std::make_unique<VolumeSampler>(*volume);
+        using Sampler = TemplateVolumeSampler<float, double, double>;
+        auto templateSampler = std::make_unique<Sampler>(*volume);
+        ResidencyManager::nextEpoch();
+        ResidencyManager::nextEpoch();
+        EXPECT_TRUE(volume->hasRepresentation<VolumeRAM>());
+        EXPECT_EQ(sampler->sample(dvec3{0.5}).x, 0.0);
+        EXPECT_EQ(templateSampler->sample(dvec3{0.5}), 0.0);
+        EXPECT_EQ(loads, 1);
+    }
+    ResidencyManager::enforce();
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+}
+
+TEST(ResidencyManager, KeepPinned) {
+    ResidencyManager::clear();
+    ResidencyManager::setBudget(volumeBytes / 2);
+    util::OnScopeExit reset{[]() {
+        ResidencyManager::setBudget(0);
+        ResidencyManager::clear();
+    }};
+
+    int loads = 0;
+    auto volume = makeVolume(loads);
+    {
+        // Like a ThreadPool task, the raw pointer has to stay valid until the scope ends
+        const RepresentationPins pins;
+        const auto* ram = volume->getRepresentation<VolumeRAM>();
+        EXPECT_EQ(pins.size(), 1u);
+        {
+            const RepresentationPins nested;
+            EXPECT_EQ(volume->getRepresentation<VolumeRAM>(), ram);
+            EXPECT_EQ(nested.size(), 1u);
+        }
+        EXPECT_TRUE(ram->getUsage().isPinned());
+        ResidencyManager::nextEpoch();
+        ResidencyManager::nextEpoch();
+        EXPECT_TRUE(volume->hasRepresentation<VolumeRAM>());
+        EXPECT_EQ(volume->getRepresentation<VolumeRAM>(), ram);
+        EXPECT_EQ(pins.size(), 1u);
+    }
+    ResidencyManager::nextEpoch();
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+    EXPECT_EQ(loads, 1);
+}
+
+TEST(ResidencyManager, KeepEdited) {
+    ResidencyManager::clear();
+    ResidencyManager::setBudget(volumeBytes / 2);
+    util::OnScopeExit reset{[]() {
+        ResidencyManager::setBudget(0);
+        ResidencyManager::clear();
+    }};
+
+    int loads = 0;
+    auto volume = makeVolume(loads);
+    volume->getEditableRepresentation<VolumeRAM>();
+    ResidencyManager::nextEpoch();
+    EXPECT_TRUE(volume->hasRepresentation<VolumeRAM>());
+
+    volume.reset();
+    EXPECT_EQ(ResidencyManager::size(), 0u);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,210 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/latch.h>
+#include <inviwo/core/util/threadpool.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <future>
+#include <numeric>
+#include <array>
+#include <memory>
+
+namespace inviwo {
+
+TEST(ThreadPool, NoWorkers) {
+    ThreadPool pool(0);
+    auto future = pool.enqueue([](int a, int b) { return a + b; }, 1, 2);
+    EXPECT_EQ(future.wait_for(std::chrono::seconds{0}), std::future_status::ready);
+    EXPECT_EQ(future.get(), 3);
+    EXPECT_FALSE(pool.isWorkerThread());
+}
+
+TEST(ThreadPool, Exceptions) {
+    ThreadPool pool(2);
+    auto future = pool.enqueue([]() -> int { throw std::runtime_error("error"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(ThreadPool, NestedWait) {
+    // More outer tasks than workers, each waiting for inner tasks. Without help-while-waiting
+    // all workers would block in the outer tasks and never run the inner ones.
+    ThreadPool pool(2);
+    const int outerCount = 16;
+    const int innerCount = 32;
+
+    std::vector<std::future<int>> outer;
+    for (int i = 0; i < outerCount; ++i) {
+        outer.push_back(pool.enqueue([&pool, innerCount]() {
+            EXPECT_TRUE(pool.isWorkerThread());
+            std::vector<std::future<int>> inner;
+            for (int j = 0; j < innerCount; ++j) {
+                inner.push_back(pool.enqueue([j]() { return j; }));
+            }
+            int sum = 0;
+            for (auto& f : inner) {
+                pool.wait(f);
+                sum += f.get();
+            }
+            return sum;
+        }));
+    }
+
+    for (auto& f : outer) {
+        pool.wait(f);
+        EXPECT_EQ(f.get(), innerCount * (innerCount - 1) / 2);
+    }
+    EXPECT_EQ(pool.getQueueSize(), 0);
+}
+
+TEST(ThreadPool, Resize) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.getSize(), 4);
+
+    Latch started{100};
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 100; ++i) {
+        futures.push_back(pool.enqueue([i, &started]() {
+            started.countDown();
+            return i;
+        }));
+    }
+    ASSERT_TRUE(started.waitFor(std::chrono::seconds{10}));
+
+    // Workers stop once they are free, wait for that with a timeout instead of hanging
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (pool.trySetSize(0) != 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    ASSERT_EQ(pool.getSize(), 0);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(futures[i].get(), i);
+
+    EXPECT_EQ(pool.trySetSize(2), 2);
+}
+
+TEST(ThreadPool, Priority) {
+    ThreadPool pool(1);
+
+    // Block the only worker until all tasks are queued
+    std::promise<void> block;
+    auto blocker = pool.enqueue([f = block.get_future()]() { f.wait(); });
+
+    std::mutex mutex;
+    std::vector<TaskPriority> order;
+    auto record = [&](TaskPriority p) {
+        std::unique_lock<std::mutex> lock{mutex};
+        order.push_back(p);
+    };
+    auto background = pool.enqueue(TaskPriority::Background, record, TaskPriority::Background);
+    auto normal = pool.enqueue(TaskPriority::Normal, record, TaskPriority::Normal);
+    auto interactive = pool.enqueue(TaskPriority::Interactive, record, TaskPriority::Interactive);
+    block.set_value();
+
+    background.wait();
+    normal.wait();
+    interactive.wait();
+    EXPECT_EQ(order, (std::vector<TaskPriority>{TaskPriority::Interactive, TaskPriority::Normal,
+                                                TaskPriority::Background}));
+}
+
+TEST(ThreadPool, Cancellation) {
+    ThreadPool pool(2);
+    EXPECT_FALSE(ThreadPool::currentToken().canBeCancelled());
+
+    CancellationSource source;
+    std::promise<void> started;
+    auto future = pool.enqueue(TaskPriority::Normal, source.getToken(),
+                               [&pool, &started]() {
+                                   EXPECT_TRUE(ThreadPool::currentToken().canBeCancelled());
+                                   started.set_value();
+                                   while (!ThreadPool::currentToken().isCancelled()) {
+                                       std::this_thread::yield();
+                                   }
+                                   // nested tasks inherit the token
+                                   auto inner = pool.enqueue(
+                                       []() { return ThreadPool::currentToken().isCancelled(); });
+                                   pool.wait(inner);
+                                   return inner.get();
+                               });
+    started.get_future().wait();
+    source.cancel();
+    EXPECT_TRUE(future.get());
+    EXPECT_FALSE(ThreadPool::currentToken().isCancelled());
+}
+
+TEST(ThreadPool, TaskFunction) {
+    int calls = 0;
+    TaskFunction small{[&calls]() { ++calls; }};
+    std::array<size_t, 32> big{};
+    TaskFunction large{[&calls, big]() { calls += static_cast<int>(big.size()); }};
+    auto ptr = std::make_unique<int>(10);
+    TaskFunction moveOnly{[&calls, p = std::move(ptr)]() { calls += *p; }};
+
+    TaskFunction moved{std::move(large)};
+    EXPECT_FALSE(large);
+    small();
+    moved();
+    moveOnly();
+    EXPECT_EQ(calls, 43);
+    moved.reset();
+    EXPECT_FALSE(moved);
+}
+
+TEST(ThreadPool, EnqueueRange) {
+    ThreadPool pool(3);
+    std::vector<int> data(1000, 1);
+    auto latch = pool.enqueueRange(data.size(), 7, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) data[i] += static_cast<int>(i);
+    });
+    pool.wait(*latch);
+    EXPECT_NO_THROW(latch->get());
+    EXPECT_EQ(std::accumulate(data.begin(), data.end(), 0), 1000 + 999 * 1000 / 2);
+
+    auto failed = pool.enqueueRange(10, 10, [](size_t begin, size_t) {
+        if (begin == 5) throw std::runtime_error("range");
+    });
+    EXPECT_THROW(failed->get(), std::runtime_error);
+
+    ThreadPool inlinePool(0);
+    size_t count = 0;
+    auto done = inlinePool.enqueueRange(5, 10, [&](size_t begin, size_t end) {
+        count += end - begin;
+    });
+    EXPECT_TRUE(done->isReady());
+    EXPECT_EQ(count, 5);
+}
+
+}  // namespace inviwo
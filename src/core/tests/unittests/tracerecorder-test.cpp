@@ -0,0 +1,127 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/tracerecorder.h>
+#include <inviwo/core/util/threadpool.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace inviwo {
+
+TEST(TraceRecorder, Disabled) {
+    TraceRecorder::setEnabled(false);
+    TraceRecorder::clear();
+
+    int evaluated = 0;
+    {
+        IVW_TRACE_SCOPE("test", std::to_string(++evaluated));
+    }
+    EXPECT_EQ(evaluated, 0);
+    EXPECT_EQ(TraceRecorder::size(), 0);
+}
+
+TEST(TraceRecorder, SingleStatement) {
+    TraceRecorder::clear();
+    TraceRecorder::setEnabled(true);
+
+    int elseTaken = 0;
+    for (const bool trace : {true, false}) {
+        if (trace)
+            IVW_TRACE_SCOPE("test", "Statement");
+        else
+            ++elseTaken;
+    }
+    TraceRecorder::setEnabled(false);
+
+    EXPECT_EQ(elseTaken, 1);
+    EXPECT_EQ(TraceRecorder::size(), 1);
+    TraceRecorder::clear();
+}
+
+TEST(TraceRecorder, ThreadName) {
+    TraceRecorder::clear();
+    TraceRecorder::setEnabled(false);
+
+    std::thread thread{[]() {
+        TraceRecorder::setThreadName("Named \"thread\"");
+        TraceRecorder::setEnabled(true);
+        {
+            IVW_TRACE_SCOPE("test", "Named");
+        }
+        TraceRecorder::setEnabled(false);
+    }};
+    thread.join();
+
+    std::stringstream ss;
+    TraceRecorder::write(ss);
+    EXPECT_NE(ss.str().find(R"("args":{"name":"Named \"thread\""})"), std::string::npos);
+    TraceRecorder::clear();
+}
+
+TEST(TraceRecorder, Record) {
+    TraceRecorder::clear();
+    TraceRecorder::setEnabled(true);
+    {
+        IVW_TRACE_SCOPE("test", "Outer \"scope\"");
+        const int id = 0;
+        TraceRecorder::asyncBegin("test", "Async", &id);
+        TraceRecorder::asyncEnd("test", "Async", &id);
+
+        ThreadPool pool(2);
+        auto future = pool.enqueue([]() { IVW_TRACE_SCOPE("test", "Inner"); });
+        future.wait();
+    }
+    TraceRecorder::setEnabled(false);
+
+    // Outer, async begin and end, inner, and the pool task
+    EXPECT_EQ(TraceRecorder::size(), 5);
+
+    std::stringstream ss;
+    TraceRecorder::write(ss);
+    const auto json = ss.str();
+    EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(json.find(R"("name":"Outer \"scope\"")"), std::string::npos);
+    EXPECT_NE(json.find(R"("ph":"b")"), std::string::npos);
+    EXPECT_NE(json.find(R"("ph":"e")"), std::string::npos);
+    EXPECT_NE(json.find(R"("name":"Inner")"), std::string::npos);
+    EXPECT_NE(json.find(R"("cat":"threadpool")"), std::string::npos);
+
+    TraceRecorder::clear();
+    EXPECT_EQ(TraceRecorder::size(), 0);
+}
+
+}  // namespace inviwo
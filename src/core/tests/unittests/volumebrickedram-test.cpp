@@ -0,0 +1,152 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumebrickedram.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/volumeramutils.h>
+
+#include <memory>
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<VolumeRAMPrecision<int>> makeLinear(size3_t dims) {
+    auto ram = std::make_shared<VolumeRAMPrecision<int>>(dims);
+    std::iota(ram->getDataTyped(), ram->getDataTyped() + glm::compMul(dims), 0);
+    return ram;
+}
+
+}  // namespace
+
+TEST(VolumeBrickedRAM, Layout) {
+    const size3_t dims{21, 10, 7};
+    auto linear = makeLinear(dims);
+    VolumeBrickedRAMPrecision<int> bricked{dims, 8, 2};
+    bricked.copyFrom(*linear);
+
+    EXPECT_EQ(bricked.getBrickCount(), size3_t(3, 2, 1));
+    EXPECT_EQ(bricked.getBrickExtent(size3_t{2, 1, 0}), size3_t(5, 2, 7));
+    EXPECT_EQ(bricked.getNumberOfBytes(), 3 * 2 * 12 * 12 * 12 * sizeof(int));
+
+    const util::IndexMapper3D im{dims};
+    util::forEachVoxel(dims, [&](const size3_t& pos) {
+        EXPECT_EQ(bricked.voxel(pos), static_cast<int>(im(pos)));
+    });
+}
+
+TEST(VolumeBrickedRAM, Apron) {
+    const size3_t dims{20, 9, 5};
+    auto linear = makeLinear(dims);
+    VolumeBrickedRAMPrecision<int> bricked{dims, 8, 1};
+    bricked.copyFrom(*linear);
+
+    const util::IndexMapper3D im{dims};
+    const util::IndexMapper3D bim{size3_t{10}};
+    const int* brick = bricked.getBrickDataTyped(size3_t{1, 0, 0});
+    // Neighbor in the previous brick
+    EXPECT_EQ(brick[bim(size3_t{0, 1, 1})], static_cast<int>(im(size3_t{7, 0, 0})));
+    // Neighbor in the next brick
+    EXPECT_EQ(brick[bim(size3_t{9, 1, 1})], static_cast<int>(im(size3_t{16, 0, 0})));
+    // Clamped at the border
+    EXPECT_EQ(brick[bim(size3_t{1, 0, 0})], static_cast<int>(im(size3_t{8, 0, 0})));
+    EXPECT_EQ(brick[bim(size3_t{1, 1, 9})], static_cast<int>(im(size3_t{8, 0, 4})));
+
+    bricked.voxel(size3_t{7, 0, 0}) = -1;
+    bricked.updateAprons();
+    EXPECT_EQ(brick[bim(size3_t{0, 1, 1})], -1);
+}
+
+TEST(VolumeBrickedRAM, BrickIterator) {
+    const size3_t dims{20, 9, 5};
+    auto linear = makeLinear(dims);
+    VolumeBrickedRAMPrecision<int> bricked{dims, 8, 1};
+    bricked.copyFrom(*linear);
+
+    const util::IndexMapper3D im{dims};
+    size_t count = 0;
+    util::forEachVoxel(bricked.getBrickCount(), [&](const size3_t& brick) {
+        const auto& cbricked = bricked;
+        auto it = cbricked.brickIterator(brick);
+        for (; it != it.end(); ++it, ++count) {
+            const auto pos = bricked.getBrickOffset(brick) + it.blockPos();
+            EXPECT_EQ(*it, static_cast<int>(im(pos)));
+        }
+    });
+    EXPECT_EQ(count, glm::compMul(dims));
+}
+
+TEST(VolumeBrickedRAM, CopyOnWrite) {
+    const size3_t dims{20, 9, 5};
+    auto linear = makeLinear(dims);
+    VolumeBrickedRAMPrecision<int> bricked{dims, RAMAllocation::uninitialized(), 8, 1};
+    bricked.copyFrom(*linear);
+
+    VolumeBrickedRAMPrecision<int> copy{bricked};
+    const auto& cbricked = bricked;
+    const auto& ccopy = copy;
+    EXPECT_EQ(ccopy.getBrickDataTyped(size3_t{0}), cbricked.getBrickDataTyped(size3_t{0}));
+
+    copy.voxel(size3_t{3, 2, 1}) = -1;
+    EXPECT_NE(ccopy.getBrickDataTyped(size3_t{0}), cbricked.getBrickDataTyped(size3_t{0}));
+    EXPECT_EQ(copy.voxel(size3_t{3, 2, 1}), -1);
+    const util::IndexMapper3D im{dims};
+    EXPECT_EQ(cbricked.voxel(size3_t{3, 2, 1}), static_cast<int>(im(size3_t{3, 2, 1})));
+    EXPECT_EQ(cbricked.voxel(size3_t{19, 8, 4}), ccopy.voxel(size3_t{19, 8, 4}));
+}
+
+TEST(VolumeBrickedRAM, Conversion) {
+    const size3_t dims{33, 40, 3};
+    auto linear = makeLinear(dims);
+    Volume volume{linear};
+
+    const auto* bricked = volume.getRepresentation<VolumeBrickedRAM>();
+    ASSERT_TRUE(bricked);
+    EXPECT_EQ(bricked->getDimensions(), dims);
+    EXPECT_EQ(bricked->getAsDouble(size3_t{32, 39, 2}),
+              static_cast<double>(glm::compMul(dims) - 1));
+
+    auto* editable = volume.getEditableRepresentation<VolumeBrickedRAM>();
+    static_cast<VolumeBrickedRAMPrecision<int>*>(editable)->voxel(size3_t{1, 2, 1}) = -5;
+
+    const auto* ram = volume.getRepresentation<VolumeRAM>();
+    const util::IndexMapper3D im{dims};
+    EXPECT_EQ(ram->getAsDouble(size3_t{1, 2, 1}), -5.0);
+    EXPECT_EQ(ram->getAsDouble(size3_t{32, 0, 2}), static_cast<double>(im(size3_t{32, 0, 2})));
+}
+
+}  // namespace inviwo
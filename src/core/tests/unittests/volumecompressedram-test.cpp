@@ -0,0 +1,280 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/algorithm/brickcodec.h>
+#include <inviwo/core/datastructures/idlecompressionmanager.h>
+#include <inviwo/core/datastructures/representationusage.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumecompressedram.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/raiiutils.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+template <typename T>
+std::vector<T> roundTrip(const std::vector<T>& data, size_t components, size_t* compressedSize) {
+    const auto compressed = util::compressBrick(std::as_bytes(std::span{data}),
+                                                sizeof(T), components);
+    *compressedSize = compressed.size();
+    std::vector<T> result(data.size());
+    util::decompressBrick(compressed, std::as_writable_bytes(std::span{result}), sizeof(T),
+                          components);
+    return result;
+}
+
+// A sphere with label 2 inside a slab with label 1
+std::uint16_t label(const size3_t& p) {
+    const auto d = glm::i64vec3{p} - glm::i64vec3{20};
+    return d.x * d.x + d.y * d.y + d.z * d.z < 100 ? 2 : (p.z < 8 ? 1 : 0);
+}
+
+std::shared_ptr<VolumeRAMPrecision<std::uint16_t>> makeLabels(const size3_t& dims) {
+    auto ram = std::make_shared<VolumeRAMPrecision<std::uint16_t>>(dims);
+    const util::IndexMapper3D im{dims};
+    auto* data = ram->getDataTyped();
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) data[im(x, y, z)] = label(size3_t{x, y, z});
+        }
+    }
+    return ram;
+}
+
+}  // namespace
+
+TEST(BrickCodec, LZ) {
+    std::mt19937 rng{42};
+    std::vector<std::byte> data(10000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        // Runs of random length, plus a repeating pattern
+        data[i] = static_cast<std::byte>(i < 5000 ? (i / (1 + rng() % 64)) % 4 : i % 7);
+    }
+    const auto compressed = util::compressLZ(data);
+    EXPECT_LT(compressed.size(), data.size() / 4);
+
+    std::vector<std::byte> result(data.size());
+    util::decompressLZ(compressed, result);
+    EXPECT_EQ(result, data);
+
+    std::vector<std::byte> tooSmall(data.size() - 1);
+    EXPECT_THROW(util::decompressLZ(compressed, tooSmall), Exception);
+
+    const std::vector<std::byte> empty;
+    std::vector<std::byte> none;
+    util::decompressLZ(util::compressLZ(empty), none);
+}
+
+TEST(BrickCodec, Bricks) {
+    size_t compressedSize = 0;
+
+    std::vector<float> ramp(32 * 32 * 32);
+    for (size_t i = 0; i < ramp.size(); ++i) ramp[i] = 0.25f * static_cast<float>(i % 32);
+    EXPECT_EQ(roundTrip(ramp, 1, &compressedSize), ramp);
+    EXPECT_LT(compressedSize, ramp.size() * sizeof(float) / 10);
+
+    std::vector<std::uint32_t> vec3(3 * 1000);
+    for (size_t i = 0; i < vec3.size(); ++i) vec3[i] = static_cast<std::uint32_t>(1000 * (i % 3));
+    EXPECT_EQ(roundTrip(vec3, 3, &compressedSize), vec3);
+    EXPECT_LT(compressedSize, vec3.size() * sizeof(std::uint32_t) / 10);
+
+    std::mt19937 rng{42};
+    std::vector<std::uint8_t> noise(10000);
+    for (auto& v : noise) v = static_cast<std::uint8_t>(rng());
+    EXPECT_EQ(roundTrip(noise, 1, &compressedSize), noise);
+    EXPECT_LE(compressedSize, noise.size() + 1);
+}
+
+TEST(VolumeCompressedRAM, RoundTrip) {
+    const size3_t dims{45, 40, 35};
+    auto ram = makeLabels(dims);
+
+    VolumeCompressedRAM compressed{*ram, 16};
+    EXPECT_EQ(compressed.getDimensions(), dims);
+    EXPECT_EQ(compressed.getBrickCount(), size3_t(3, 3, 3));
+    EXPECT_EQ(compressed.getBrickExtent(size3_t{2, 2, 2}), size3_t(13, 8, 3));
+    EXPECT_LT(compressed.getNumberOfBytes() * 10, compressed.getUncompressedNumberOfBytes());
+
+    VolumeRAMPrecision<std::uint16_t> result{dims, RAMAllocation::uninitialized()};
+    compressed.decompress(result);
+    EXPECT_TRUE(std::equal(ram->getDataTyped(), ram->getDataTyped() + glm::compMul(dims),
+                           result.getDataTyped()));
+
+    const size3_t brick{1, 1, 0};
+    const auto extent = compressed.getBrickExtent(brick);
+    std::vector<std::uint16_t> voxels(glm::compMul(extent));
+    compressed.decompressBrick(brick, voxels.data());
+    const util::IndexMapper3D im{extent};
+    for (size_t z = 0; z < extent.z; ++z) {
+        for (size_t y = 0; y < extent.y; ++y) {
+            for (size_t x = 0; x < extent.x; ++x) {
+                EXPECT_EQ(voxels[im(x, y, z)],
+                          label(compressed.getBrickOffset(brick) + size3_t{x, y, z}));
+            }
+        }
+    }
+}
+
+TEST(VolumeCompressedRAM, Converters) {
+    const size3_t dims{40, 30, 20};
+    Volume volume{makeLabels(dims)};
+    const auto* compressed = volume.getRepresentation<VolumeCompressedRAM>();
+    ASSERT_NE(compressed, nullptr);
+    EXPECT_EQ(compressed->getDimensions(), dims);
+
+    volume.removeOtherRepresentations(compressed);
+    const auto* ram = volume.getRepresentation<VolumeRAM>();
+    EXPECT_EQ(ram->getAsDouble(size3_t{20, 20, 15}), 2.0);
+    EXPECT_EQ(ram->getAsDouble(size3_t{0, 0, 0}), 1.0);
+    EXPECT_EQ(ram->getAsDouble(size3_t{0, 0, 10}), 0.0);
+}
+
+TEST(IdleCompressionManager, CompressIdle) {
+    IdleCompressionManager::clear();
+    IdleCompressionManager::setIdleEpochs(2);
+    util::OnScopeExit reset{[]() {
+        IdleCompressionManager::setIdleEpochs(0);
+        IdleCompressionManager::clear();
+    }};
+
+    const size3_t dims{40, 30, 20};
+    Volume idle{makeLabels(dims)};
+    Volume used{makeLabels(dims)};
+    idle.getRepresentation<VolumeRAM>();
+    used.getRepresentation<VolumeRAM>();
+    EXPECT_EQ(IdleCompressionManager::size(), size_t{2});
+
+    const auto compressions = IdleCompressionManager::getCompressions();
+    for (int i = 0; i < 3; ++i) {
+        IdleCompressionManager::nextEpoch();
+        IdleCompressionManager::wait();
+        used.getRepresentation<VolumeRAM>();
+    }
+    EXPECT_EQ(IdleCompressionManager::getCompressions(), compressions + 1);
+    EXPECT_FALSE(idle.hasRepresentation<VolumeRAM>());
+    EXPECT_TRUE(idle.hasValidRepresentation<VolumeCompressedRAM>());
+    EXPECT_TRUE(used.hasValidRepresentation<VolumeRAM>());
+
+    // Decompressed transparently
+    EXPECT_EQ(idle.getRepresentation<VolumeRAM>()->getAsDouble(size3_t{20, 20, 15}), 2.0);
+}
+
+TEST(IdleCompressionManager, KeepShared) {
+    IdleCompressionManager::clear();
+    IdleCompressionManager::setIdleEpochs(1);
+    util::OnScopeExit reset{[]() {
+        IdleCompressionManager::setIdleEpochs(0);
+        IdleCompressionManager::clear();
+    }};
+
+    Volume volume{makeLabels(size3_t{16, 16, 16})};
+    auto shared = volume.getRepresentationShared<VolumeRAM>();
+    for (int i = 0; i < 3; ++i) {
+        IdleCompressionManager::nextEpoch();
+        IdleCompressionManager::wait();
+    }
+    EXPECT_TRUE(volume.hasValidRepresentation<VolumeRAM>());
+
+    shared.reset();
+    IdleCompressionManager::nextEpoch();
+    IdleCompressionManager::wait();
+    EXPECT_FALSE(volume.hasRepresentation<VolumeRAM>());
+}
+
+TEST(IdleCompressionManager, KeepPinned) {
+    IdleCompressionManager::clear();
+    IdleCompressionManager::setIdleEpochs(1);
+    util::OnScopeExit reset{[]() {
+        IdleCompressionManager::setIdleEpochs(0);
+        IdleCompressionManager::clear();
+    }};
+
+    Volume volume{makeLabels(size3_t{16, 16, 16})};
+    {
+        // Like a ThreadPool task, the raw pointer has to stay valid until the scope ends
+        const RepresentationPins pins;
+        const auto* ram = volume.getRepresentation<VolumeRAM>();
+        for (int i = 0; i < 3; ++i) {
+            IdleCompressionManager::nextEpoch();
+            IdleCompressionManager::wait();
+        }
+        EXPECT_TRUE(volume.hasValidRepresentation<VolumeRAM>());
+        EXPECT_EQ(ram->getAsDouble(size3_t{0, 0, 0}), 1.0);
+    }
+    IdleCompressionManager::nextEpoch();
+    IdleCompressionManager::wait();
+    EXPECT_FALSE(volume.hasRepresentation<VolumeRAM>());
+}
+
+TEST(IdleCompressionManager, KeepRecentlyUsed) {
+    IdleCompressionManager::clear();
+    IdleCompressionManager::setIdleEpochs(1);
+    util::OnScopeExit reset{[]() {
+        IdleCompressionManager::setIdleEpochs(0);
+        IdleCompressionManager::clear();
+    }};
+
+    Volume volume{makeLabels(size3_t{16, 16, 16})};
+    const auto& usage = volume.getRepresentation<VolumeRAM>()->getUsage();
+    const auto firstUse = usage.getLastUse();
+    IdleCompressionManager::nextEpoch();
+    IdleCompressionManager::wait();
+    EXPECT_TRUE(volume.hasValidRepresentation<VolumeRAM>());
+
+    // A use only updates the stamp of the representation
+    volume.getRepresentation<VolumeRAM>();
+    EXPECT_EQ(usage.getLastUse(), firstUse + 1);
+    IdleCompressionManager::nextEpoch();
+    IdleCompressionManager::wait();
+    EXPECT_TRUE(volume.hasValidRepresentation<VolumeRAM>());
+    EXPECT_EQ(IdleCompressionManager::size(), size_t{1});
+
+    IdleCompressionManager::nextEpoch();
+    IdleCompressionManager::wait();
+    EXPECT_FALSE(volume.hasRepresentation<VolumeRAM>());
+    EXPECT_EQ(IdleCompressionManager::size(), size_t{0});
+}
+
+}  // namespace inviwo
@@ -0,0 +1,121 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/volumesequenceprefetcher.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t steps = 8;
+constexpr size3_t dims{4, 3, 2};
+constexpr size_t stepBytes = 4 * 3 * 2 * sizeof(std::uint16_t);
+
+std::shared_ptr<VolumeSequence> createSequence(const util::TempFileHandle& file) {
+    std::vector<std::uint16_t> values(steps * dims.x * dims.y * dims.z);
+    std::iota(values.begin(), values.end(), std::uint16_t{0});
+    std::fwrite(values.data(), sizeof(std::uint16_t), values.size(), file);
+    std::fflush(file);
+
+    auto sequence = std::make_shared<VolumeSequence>();
+    for (size_t t = 0; t < steps; ++t) {
+        auto disk = std::make_shared<VolumeDisk>(file.getFileName(), dims, DataUInt16::get());
+        disk->setLoader(new RawVolumeRAMLoader(file.getFileName(), t * stepBytes, true));
+        sequence->push_back(std::make_shared<Volume>(disk));
+    }
+    return sequence;
+}
+
+std::vector<size_t> prefetch(VolumeSequencePrefetcher& prefetcher, size_t index) {
+    prefetcher.update(index);
+    prefetcher.wait();
+    return prefetcher.getPrefetched();
+}
+
+}  // namespace
+
+TEST(VolumeSequencePrefetcher, Direction) {
+    ASSERT_NE(util::getPoolSize(), 0);
+    util::TempFileHandle file{"inviwo", ".raw"};
+    auto sequence = createSequence(file);
+
+    VolumeSequencePrefetcher prefetcher{2};
+    prefetcher.setSequence(sequence);
+
+    EXPECT_EQ(prefetch(prefetcher, 0), (std::vector<size_t>{1, 2}));
+    ASSERT_TRUE((*sequence)[2]->hasValidRepresentation<VolumeRAM>());
+    EXPECT_EQ((*sequence)[2]->getRepresentation<VolumeRAM>()->getAsDouble(size3_t{0, 0, 0}),
+              2.0 * dims.x * dims.y * dims.z);
+
+    EXPECT_EQ(prefetch(prefetcher, 1), (std::vector<size_t>{2, 3}));
+    // Backwards, wrapping around the start
+    EXPECT_EQ(prefetch(prefetcher, 0), (std::vector<size_t>{6, 7}));
+    EXPECT_EQ(prefetch(prefetcher, 7), (std::vector<size_t>{5, 6}));
+    // Skipping steps
+    EXPECT_EQ(prefetch(prefetcher, 1), (std::vector<size_t>{3, 5}));
+}
+
+TEST(VolumeSequencePrefetcher, Budget) {
+    util::TempFileHandle file{"inviwo", ".raw"};
+    auto sequence = createSequence(file);
+
+    VolumeSequencePrefetcher prefetcher{4, 3 * stepBytes};
+    prefetcher.setSequence(sequence);
+    EXPECT_EQ(prefetch(prefetcher, 0), (std::vector<size_t>{1, 2, 3}));
+
+    prefetcher.setBudget(stepBytes);
+    prefetcher.wait();
+    EXPECT_EQ(prefetcher.getPrefetched(), (std::vector<size_t>{1}));
+
+    prefetcher.setAhead(0);
+    EXPECT_TRUE(prefetcher.getPrefetched().empty());
+
+    prefetcher.setAhead(2);
+    prefetcher.setSequence(nullptr);
+    EXPECT_TRUE(prefetcher.getPrefetched().empty());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,176 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/volumeslabs.h>
+#include <inviwo/core/datastructures/histogram.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/io/volumeslabwriter.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{3, 2, 5};
+
+std::vector<std::uint16_t> values() {
+    std::vector<std::uint16_t> values(dims.x * dims.y * dims.z);
+    std::iota(values.begin(), values.end(), std::uint16_t{0});
+    return values;
+}
+
+util::TempFileHandle writeRaw() {
+    util::TempFileHandle file{"inviwo", ".raw"};
+    const auto data = values();
+    std::fwrite(data.data(), sizeof(std::uint16_t), data.size(), file);
+    std::fflush(file);
+    return file;
+}
+
+Volume makeVolume(const std::string& file) {
+    auto disk = std::make_shared<VolumeDisk>(dims, DataUInt16::get());
+    disk->setLoader(new RawVolumeRAMLoader(file, 0, true));
+    return Volume{disk};
+}
+
+}  // namespace
+
+TEST(VolumeSlabs, ReadRegion) {
+    auto file = writeRaw();
+    auto volume = makeVolume(file.getFileName());
+    const auto* disk = volume.getRepresentation<VolumeDisk>();
+    ASSERT_TRUE(disk->canReadRegion());
+
+    const size3_t offset{1, 1, 2};
+    const size3_t extent{2, 1, 3};
+    auto ram = disk->readRegion(offset, extent);
+    ASSERT_EQ(ram->getDimensions(), extent);
+    const auto data = values();
+    util::IndexMapper3D index(dims);
+    for (size_t z = 0; z < extent.z; ++z) {
+        for (size_t x = 0; x < extent.x; ++x) {
+            const size3_t pos{x, 0, z};
+            EXPECT_EQ(ram->getAsDouble(pos), data[index(pos + offset)]);
+        }
+    }
+
+    EXPECT_THROW(disk->readRegion(size3_t{0, 0, 4}, size3_t{1, 1, 2}), Exception);
+}
+
+TEST(VolumeSlabs, ForEachSlab) {
+    auto file = writeRaw();
+    auto volume = makeVolume(file.getFileName());
+    ASSERT_TRUE(util::canStreamSlabs(volume));
+
+    const auto data = values();
+    const size_t layer = dims.x * dims.y;
+    size_t next = 0;
+    util::forEachVolumeSlab(volume, 2, 1, [&](const util::VolumeSlab& slab) {
+        EXPECT_EQ(slab.z, next);
+        EXPECT_EQ(slab.depth, std::min(size_t{2}, dims.z - slab.z));
+        EXPECT_EQ(slab.haloBefore, slab.z == 0 ? 0 : 1);
+
+        const auto slabDims = slab.ram->getDimensions();
+        EXPECT_EQ(slabDims.z, slab.haloBefore + slab.depth + (slab.z + slab.depth < dims.z));
+        const auto* ptr = static_cast<const std::uint16_t*>(slab.ram->getData());
+        const auto first = (slab.z - slab.haloBefore) * layer;
+        for (size_t i = 0; i < layer * slabDims.z; ++i) {
+            EXPECT_EQ(ptr[i], data[first + i]);
+        }
+        next += slab.depth;
+    });
+    EXPECT_EQ(next, dims.z);
+
+    // Reading slabs does not load the volume
+    EXPECT_FALSE(volume.hasValidRepresentation<VolumeRAM>());
+}
+
+TEST(VolumeSlabs, Writer) {
+    auto file = writeRaw();
+    auto volume = makeVolume(file.getFileName());
+    util::TempFileHandle output{"inviwo", ".raw"};
+
+    VolumeSlabWriter writer{output.getFileName(), dims, DataUInt16::get()};
+    util::forEachVolumeSlab(volume, 2, 1, [&](const util::VolumeSlab& slab) {
+        writer.write(*slab.ram, slab.haloBefore, slab.depth);
+    });
+    EXPECT_EQ(writer.getWrittenLayers(), dims.z);
+
+    Volume result{writer.finish()};
+    const auto* ram = result.getRepresentation<VolumeRAM>();
+    const auto* ptr = static_cast<const std::uint16_t*>(ram->getData());
+    const auto data = values();
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), ptr));
+}
+
+TEST(VolumeSlabs, IncompleteWriter) {
+    util::TempFileHandle output{"inviwo", ".raw"};
+    VolumeSlabWriter writer{output.getFileName(), dims, DataUInt16::get()};
+    EXPECT_THROW(writer.finish(), Exception);
+}
+
+TEST(VolumeSlabs, HistogramAccumulator) {
+    std::vector<float> data(1000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<float>((i * 37) % 101);
+    }
+    const dvec2 range{0.0, 100.0};
+
+    HistogramContainer whole{range, 50, data.begin(), data.end()};
+
+    HistogramAccumulator<float> acc{range, 50};
+    for (size_t i = 0; i < data.size(); i += 300) {
+        acc.add(data.begin() + i, data.begin() + std::min(i + 300, data.size()));
+    }
+    const auto chunked = acc.finish();
+
+    ASSERT_EQ(chunked.size(), whole.size());
+    EXPECT_EQ(chunked[0].getData(), whole[0].getData());
+    EXPECT_EQ(chunked[0].stats_.min, whole[0].stats_.min);
+    EXPECT_EQ(chunked[0].stats_.max, whole[0].stats_.max);
+    EXPECT_DOUBLE_EQ(chunked[0].stats_.mean, whole[0].stats_.mean);
+}
+
+}  // namespace inviwo
@@ -69,7 +69,13 @@ CommandLineParser::CommandLineParser(int argc, char** argv)
     , helpQuiet_("h", "help", "")
     , versionQuiet_("v", "version", "")
     , disableResourceManager_("", "no-resource-manager",
-                              "Pass this flag to disable the resource manager") {
+                              "Pass this flag to disable the resource manager")
+    , traceFile_("", "trace",
+                 "Record a trace of the network evaluation, thread pool tasks, and representation "
+                 "conversions. The trace is written as trace event JSON to the file on exit.",
+                 false, "", "trace file")
+    , profile_("", "profile",
+               "Enable the profiler and log the timings of all profiler probes on exit.") {
     cmdQuiet_.add(workspace_);
     cmdQuiet_.add(outputPath_);
     cmdQuiet_.add(quitAfterStartup_);
@@ -79,6 +85,8 @@ CommandLineParser::CommandLineParser(int argc, char** argv)
     cmdQuiet_.add(helpQuiet_);
     cmdQuiet_.add(versionQuiet_);
     cmdQuiet_.add(disableResourceManager_);
+    cmdQuiet_.add(traceFile_);
+    cmdQuiet_.add(profile_);
     cmdQuiet_.add(wildcard_);
 
     cmd_.add(workspace_);
@@ -88,6 +96,8 @@ CommandLineParser::CommandLineParser(int argc, char** argv)
     cmd_.add(logfile_);
     cmd_.add(logConsole_);
     cmd_.add(disableResourceManager_);
+    cmd_.add(traceFile_);
+    cmd_.add(profile_);
 
     parse(Mode::Quiet);
 }
@@ -186,6 +196,15 @@ bool CommandLineParser::getDisableResourceManager() const {
     return disableResourceManager_.isSet();
 }
 
+bool CommandLineParser::getTrace() const { return traceFile_.isSet(); }
+
+const std::string CommandLineParser::getTraceFileName() const {
+    if (traceFile_.isSet()) return traceFile_.getValue();
+    return "";
+}
+
+bool CommandLineParser::getProfile() const { return profile_.isSet(); }
+
 int CommandLineParser::getARGC() const { return argc_; }
 
 char** CommandLineParser::getARGV() const { return argv_; }
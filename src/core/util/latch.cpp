@@ -0,0 +1,70 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/latch.h>
+
+namespace inviwo {
+
+Latch::Latch(size_t count) : count_{count} {}
+
+void Latch::countDown(size_t n) {
+    // Count down and notify with the lock held, a waiter can then neither miss the notification
+    // nor return and destroy the latch while it is still in use here.
+    std::unique_lock<std::mutex> lock{mutex_};
+    count_ -= n;
+    if (count_ == 0) condition_.notify_all();
+}
+
+void Latch::setException(std::exception_ptr exception) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    if (!exception_) exception_ = exception;
+}
+
+bool Latch::isReady() const {
+    std::unique_lock<std::mutex> lock{mutex_};
+    return count_ == 0;
+}
+
+void Latch::wait() const {
+    std::unique_lock<std::mutex> lock{mutex_};
+    condition_.wait(lock, [this]() { return count_ == 0; });
+}
+
+bool Latch::waitFor(std::chrono::milliseconds duration) const {
+    std::unique_lock<std::mutex> lock{mutex_};
+    return condition_.wait_for(lock, duration, [this]() { return count_ == 0; });
+}
+
+void Latch::get() const {
+    wait();
+    std::unique_lock<std::mutex> lock{mutex_};
+    if (exception_) std::rethrow_exception(exception_);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,70 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/util/networktraceobserver.h>
+
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/processors/processor.h>
+
+namespace inviwo {
+
+NetworkTraceObserver::NetworkTraceObserver(ProcessorNetwork* network,
+                                           ProcessorNetworkEvaluator* evaluator) {
+    network->addObserver(this);
+    evaluator->addObserver(this);
+    network->forEachProcessor([this](Processor* p) { p->ProcessorObservable::addObserver(this); });
+}
+
+void NetworkTraceObserver::onProcessorNetworkDidAddProcessor(Processor* p) {
+    p->ProcessorObservable::addObserver(this);
+}
+
+void NetworkTraceObserver::onProcessorNetworkEvaluationBegin() {
+    evaluationStart_ = TraceRecorder::Clock::now();
+}
+
+void NetworkTraceObserver::onProcessorNetworkEvaluationEnd() {
+    if (!TraceRecorder::isEnabled()) return;
+    TraceRecorder::complete("network", "Evaluate Network", evaluationStart_,
+                            TraceRecorder::Clock::now());
+}
+
+void NetworkTraceObserver::onProcessorAboutToProcess(Processor* p) {
+    if (!TraceRecorder::isEnabled()) return;
+    TraceRecorder::asyncBegin("processor", p->getIdentifier(), p);
+}
+
+void NetworkTraceObserver::onProcessorFinishedProcess(Processor* p) {
+    if (!TraceRecorder::isEnabled()) return;
+    TraceRecorder::asyncEnd("processor", p->getIdentifier(), p);
+}
+
+}  // namespace inviwo
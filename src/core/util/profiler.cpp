@@ -0,0 +1,272 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/util/profiler.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+namespace inviwo {
+
+std::atomic<bool> Profiler::enabled_{false};
+
+namespace {
+
+struct Sample {
+    std::uint32_t probe;
+    std::int64_t value;
+};
+
+/**
+ * Single producer single consumer ring buffer. Only the owning thread pushes, and samples are
+ * only consumed while holding the registry mutex.
+ */
+struct ThreadBuffer {
+    static constexpr size_t capacity = 4096;
+    static constexpr size_t mask = capacity - 1;
+
+    std::array<Sample, capacity> samples;
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+};
+
+/**
+ * Log-linear histogram, values below 16 get their own bucket, larger values are split in 16
+ * buckets per power of two.
+ */
+class Histogram {
+public:
+    static constexpr size_t subBuckets = 16;
+    static constexpr size_t subBits = 4;
+    static constexpr size_t buckets = subBuckets + (64 - subBits) * subBuckets;
+
+    void add(std::int64_t value) {
+        if (counts_.empty()) counts_.resize(buckets, 0);
+        ++counts_[index(value)];
+        ++count_;
+        total_ += value;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    size_t count() const { return count_; }
+
+    Profiler::Stats stats(const std::string& name, Profiler::Kind kind) const {
+        return {name,
+                kind,
+                count_,
+                total_,
+                min_,
+                max_,
+                count_ > 0 ? static_cast<double>(total_) / static_cast<double>(count_) : 0.0,
+                percentile(0.50),
+                percentile(0.95),
+                percentile(0.99)};
+    }
+
+private:
+    static size_t index(std::int64_t value) {
+        const auto v = static_cast<std::uint64_t>(std::max<std::int64_t>(value, 0));
+        if (v < subBuckets) return static_cast<size_t>(v);
+        size_t exponent = 63;
+        while ((v >> exponent) == 0) --exponent;
+        const auto sub = (v >> (exponent - subBits)) & (subBuckets - 1);
+        return subBuckets + (exponent - subBits) * subBuckets + static_cast<size_t>(sub);
+    }
+    // The middle of the bucket, clamped to the observed range
+    std::int64_t value(size_t index) const {
+        if (index < subBuckets) return static_cast<std::int64_t>(index);
+        const auto exponent = (index - subBuckets) / subBuckets + subBits;
+        const auto sub = (index - subBuckets) % subBuckets;
+        const auto lower = static_cast<double>(subBuckets + sub) *
+                           static_cast<double>(std::uint64_t{1} << (exponent - subBits));
+        const auto width = static_cast<double>(std::uint64_t{1} << (exponent - subBits));
+        const auto mid = lower + 0.5 * width;
+        return std::clamp(static_cast<std::int64_t>(std::min(
+                              mid, static_cast<double>(std::numeric_limits<std::int64_t>::max()))),
+                          min_, max_);
+    }
+    std::int64_t percentile(double p) const {
+        if (count_ == 0) return 0;
+        const auto target = std::max<size_t>(
+            1, static_cast<size_t>(std::ceil(p * static_cast<double>(count_))));
+        size_t sum = 0;
+        for (size_t i = 0; i < counts_.size(); ++i) {
+            sum += counts_[i];
+            if (sum >= target) return value(i);
+        }
+        return max_;
+    }
+
+    std::vector<size_t> counts_;
+    size_t count_ = 0;
+    std::int64_t total_ = 0;
+    std::int64_t min_ = std::numeric_limits<std::int64_t>::max();
+    std::int64_t max_ = std::numeric_limits<std::int64_t>::lowest();
+};
+
+struct ProbeInfo {
+    std::string name;
+    Profiler::Kind kind;
+    Histogram histogram;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<ProbeInfo> probes;
+    // Kept alive after the thread exits to not loose its samples.
+    std::vector<std::shared_ptr<ThreadBuffer>> threads;
+    std::atomic<size_t> dropped{0};
+
+    static Registry& get() {
+        static Registry registry;
+        return registry;
+    }
+
+    // Has to be called with the mutex locked
+    void drain(ThreadBuffer& buffer) {
+        const auto tail = buffer.tail.load(std::memory_order_relaxed);
+        const auto head = buffer.head.load(std::memory_order_acquire);
+        for (auto i = tail; i != head; ++i) {
+            const auto& sample = buffer.samples[i & ThreadBuffer::mask];
+            if (sample.probe < probes.size()) probes[sample.probe].histogram.add(sample.value);
+        }
+        buffer.tail.store(head, std::memory_order_release);
+    }
+};
+
+ThreadBuffer& threadBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> local = []() {
+        auto& registry = Registry::get();
+        auto buffer = std::make_shared<ThreadBuffer>();
+        std::scoped_lock lock{registry.mutex};
+        registry.threads.push_back(buffer);
+        return buffer;
+    }();
+    return *local;
+}
+
+}  // namespace
+
+void Profiler::setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+std::uint32_t Profiler::registerProbe(std::string_view name, Kind kind) {
+    auto& registry = Registry::get();
+    std::scoped_lock lock{registry.mutex};
+    auto it = std::find_if(registry.probes.begin(), registry.probes.end(),
+                           [&](const ProbeInfo& p) { return p.kind == kind && p.name == name; });
+    if (it == registry.probes.end()) {
+        it = registry.probes.insert(registry.probes.end(),
+                                    ProbeInfo{std::string{name}, kind, Histogram{}});
+    }
+    return static_cast<std::uint32_t>(std::distance(registry.probes.begin(), it));
+}
+
+void Profiler::record(std::uint32_t probe, std::int64_t value) noexcept {
+    if (!isEnabled()) return;
+
+    auto& buffer = threadBuffer();
+    const auto head = buffer.head.load(std::memory_order_relaxed);
+    if (head - buffer.tail.load(std::memory_order_acquire) == ThreadBuffer::capacity) {
+        // The buffer is full, aggregate it ourselves unless someone else is busy doing that.
+        auto& registry = Registry::get();
+        std::unique_lock lock{registry.mutex, std::try_to_lock};
+        if (!lock) {
+            registry.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        registry.drain(buffer);
+    }
+    buffer.samples[head & ThreadBuffer::mask] = Sample{probe, value};
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<Profiler::Stats> Profiler::collect() {
+    auto& registry = Registry::get();
+    std::scoped_lock lock{registry.mutex};
+    for (auto& buffer : registry.threads) registry.drain(*buffer);
+
+    std::vector<Stats> stats;
+    for (const auto& probe : registry.probes) {
+        if (probe.histogram.count() == 0) continue;
+        stats.push_back(probe.histogram.stats(probe.name, probe.kind));
+    }
+    return stats;
+}
+
+void Profiler::dump(std::ostream& os) {
+    const auto stats = collect();
+
+    size_t width = 5;
+    for (const auto& s : stats) width = std::max(width, s.name.size());
+
+    const auto timer = [](std::int64_t ns) { return fmt::format("{:.3f}ms", ns * 1.0e-6); };
+    os << fmt::format("{:{}} {:>10} {:>14} {:>12} {:>12} {:>12} {:>12} {:>12}\n", "Probe", width,
+                      "Count", "Total", "Mean", "p50", "p95", "p99", "Max");
+    for (const auto& s : stats) {
+        if (s.kind == Kind::Timer) {
+            os << fmt::format("{:{}} {:>10} {:>14} {:>12} {:>12} {:>12} {:>12} {:>12}\n", s.name,
+                              width, s.count, timer(s.total),
+                              timer(static_cast<std::int64_t>(s.mean)), timer(s.p50),
+                              timer(s.p95), timer(s.p99), timer(s.max));
+        } else {
+            os << fmt::format("{:{}} {:>10} {:>14} {:>12.2f} {:>12} {:>12} {:>12} {:>12}\n",
+                              s.name, width, s.count, s.total, s.mean, s.p50, s.p95, s.p99,
+                              s.max);
+        }
+    }
+    if (const auto dropped = getDropped(); dropped > 0) {
+        os << fmt::format("{} samples were dropped\n", dropped);
+    }
+}
+
+void Profiler::reset() {
+    auto& registry = Registry::get();
+    std::scoped_lock lock{registry.mutex};
+    for (auto& buffer : registry.threads) {
+        buffer->tail.store(buffer->head.load(std::memory_order_acquire),
+                           std::memory_order_release);
+    }
+    for (auto& probe : registry.probes) probe.histogram = Histogram{};
+    registry.dropped = 0;
+}
+
+size_t Profiler::getDropped() {
+    return Registry::get().dropped.load(std::memory_order_relaxed);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,116 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/ramallocation.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace inviwo {
+
+namespace {
+
+// Size of transparent huge pages on x86-64 and most aarch64 configurations
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+// Smaller allocations are zeroed in the calling thread
+constexpr size_t parallelZeroBytes = 4 * 1024 * 1024;
+constexpr size_t zeroChunkBytes = 1024 * 1024;
+
+size_t alignment(size_t bytes, const RAMAllocation& allocation) {
+    const auto align = std::max(allocation.alignment, alignof(std::max_align_t));
+    return allocation.hugePages && bytes >= hugePageSize ? std::max(align, hugePageSize) : align;
+}
+
+std::mutex allocatorMutex;
+std::shared_ptr<RAMAllocator>& allocatorInstance() {
+    static std::shared_ptr<RAMAllocator> allocator = std::make_shared<AlignedRAMAllocator>();
+    return allocator;
+}
+
+}  // namespace
+
+void* AlignedRAMAllocator::allocate(size_t bytes, const RAMAllocation& allocation) {
+    const auto align = alignment(bytes, allocation);
+    auto* ptr = ::operator new(bytes, std::align_val_t{align});
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (align >= hugePageSize) {
+        // Only a hint, falls back to normal pages if not available
+        madvise(ptr, bytes, MADV_HUGEPAGE);
+    }
+#endif
+    return ptr;
+}
+
+void AlignedRAMAllocator::deallocate(void* ptr, size_t bytes,
+                                     const RAMAllocation& allocation) noexcept {
+    ::operator delete(ptr, std::align_val_t{alignment(bytes, allocation)});
+}
+
+std::shared_ptr<RAMAllocator> util::getRAMAllocator() {
+    std::scoped_lock lock{allocatorMutex};
+    return allocatorInstance();
+}
+
+void util::setRAMAllocator(std::shared_ptr<RAMAllocator> allocator) {
+    std::scoped_lock lock{allocatorMutex};
+    allocatorInstance() =
+        allocator ? std::move(allocator) : std::make_shared<AlignedRAMAllocator>();
+}
+
+void* util::allocateRAM(RAMAllocator& allocator, size_t bytes, const RAMAllocation& allocation) {
+    auto* ptr = allocator.allocate(bytes, allocation);
+    if (allocation.init == RAMAllocation::Init::Uninitialized) return ptr;
+
+    auto* data = static_cast<std::byte*>(ptr);
+    if (bytes < parallelZeroBytes || util::getPoolSize() == 0) {
+        std::memset(data, 0, bytes);
+        return ptr;
+    }
+    // Zero in chunks on the thread pool, the pages end up near the threads that touched them.
+    // Unlike parallelFor the range tasks are never skipped on cancellation.
+    auto& pool = util::getThreadPool();
+    const auto chunks = (bytes + zeroChunkBytes - 1) / zeroChunkBytes;
+    auto latch = pool.enqueueRange(chunks, 4 * pool.getSize(), [&](size_t first, size_t last) {
+        const auto begin = first * zeroChunkBytes;
+        const auto end = std::min(last * zeroChunkBytes, bytes);
+        std::memset(data + begin, 0, end - begin);
+    });
+    pool.wait(*latch);
+    return ptr;
+}
+
+}  // namespace inviwo
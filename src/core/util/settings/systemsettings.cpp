@@ -31,6 +31,7 @@
 #include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/logstream.h>
 #include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/algorithm/markdown.h>
 
 namespace inviwo {
 
@@ -53,6 +54,20 @@ SystemSettings::SystemSettings(InviwoApplication* app)
     , logStackTraceProperty_("logStackTraceProperty", "Error stack trace log", false)
     , runtimeModuleReloading_("runtimeModuleReloding", "Runtime Module Reloading", false)
     , enableResourceManager_("enableResourceManager", "Enable Resource Manager", false)
+    , parallelEvaluation_("parallelEvaluation", "Parallel Network Evaluation",
+                          "Process independent branches of the network concurrently. Only "
+                          "processors with ProcessingThread::Any will run in the thread pool"_help,
+                          false)
+    , memoryBudget_("memoryBudget", "Memory Budget (MB)",
+                    "Upper bound on RAM representations that can be reloaded from disk. When "
+                    "exceeded the least recently used ones are released and transparently "
+                    "reloaded when needed again. 0 means unlimited"_help,
+                    0, {0, ConstraintBehavior::Immutable}, {65536, ConstraintBehavior::Ignore})
+    , idleCompression_("idleCompression", "Compress Idle Volumes (evaluations)",
+                       "Volumes that have not been used for this many network evaluations are "
+                       "compressed losslessly in RAM, and transparently decompressed when used "
+                       "again. 0 disables compression"_help,
+                       0, {0, ConstraintBehavior::Immutable}, {100, ConstraintBehavior::Ignore})
     , breakOnMessage_{"breakOnMessage",
                       "Break on Message",
                       {MessageBreakLevel::Off, MessageBreakLevel::Error, MessageBreakLevel::Warn,
@@ -66,8 +81,9 @@ SystemSettings::SystemSettings(InviwoApplication* app)
     addProperties(workspaceAuthor_, maxNumRecentFiles_, poolSize_, enablePortInspectors_,
                   portInspectorSize_, enableTouchProperty_, enableGesturesProperty_,
                   enablePickingProperty_, enableSoundProperty_, logStackTraceProperty_,
-                  runtimeModuleReloading_, enableResourceManager_, breakOnMessage_,
-                  breakOnException_, stackTraceInException_, redirectCout_, redirectCerr_);
+                  runtimeModuleReloading_, enableResourceManager_, parallelEvaluation_,
+                  memoryBudget_, idleCompression_, breakOnMessage_, breakOnException_,
+                  stackTraceInException_, redirectCout_, redirectCerr_);
 
     logStackTraceProperty_.onChange(
         [this]() { LogCentral::getPtr()->setLogStacktrace(logStackTraceProperty_.get()); });
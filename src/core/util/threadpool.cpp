@@ -28,24 +28,35 @@
  *********************************************************************************/
 
 #include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/datastructures/representationusage.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/tracerecorder.h>
+
+#include <utility>
 
 namespace inviwo {
 
 // the constructor just launches some amount of workers
 ThreadPool::ThreadPool(size_t threads, std::function<void()> onThreadStart,
                        std::function<void()> onThreadStop)
-    : onThreadStart_{std::move(onThreadStart)}, onThreadStop_{std::move(onThreadStop)} {
+    : queued{0}
+    , sleeping{0}
+    , onThreadStart_{std::move(onThreadStart)}
+    , onThreadStop_{std::move(onThreadStop)} {
+    std::unique_lock<std::shared_mutex> lock(workers_mutex);
     while (workers.size() < threads) {
         workers.push_back(std::make_unique<Worker>(*this));
     }
 }
 
 size_t ThreadPool::trySetSize(size_t size) {
-    while (workers.size() < size) {
-        workers.push_back(std::make_unique<Worker>(*this));
+    {
+        std::unique_lock<std::shared_mutex> lock(workers_mutex);
+        while (workers.size() < size) {
+            workers.push_back(std::make_unique<Worker>(*this));
+        }
     }
 
     if (workers.size() > size) {
@@ -60,65 +71,213 @@ size_t ThreadPool::trySetSize(size_t size) {
             if (active <= size) break;
         }
 
-        condition.notify_all();
+        notify(true);
 
-        std::erase_if(workers, [](const std::unique_ptr<Worker>& worker) {
-            return worker->state == State::Done;
-        });
+        // Join the finished workers outside of the lock, since they might still be stealing.
+        std::vector<std::unique_ptr<Worker>> done;
+        {
+            std::unique_lock<std::shared_mutex> lock(workers_mutex);
+            for (auto& worker : workers) {
+                if (worker->state == State::Done) done.push_back(std::move(worker));
+            }
+            std::erase(workers, nullptr);
+        }
     }
     return workers.size();
 }
 
 size_t ThreadPool::getSize() const { return workers.size(); }
 
-size_t ThreadPool::getQueueSize() {
-    std::unique_lock<std::mutex> lock(queue_mutex);
-    return tasks.size();
+size_t ThreadPool::getQueueSize() { return queued; }
+
+bool ThreadPool::isWorkerThread() const {
+    auto* worker = currentWorker();
+    return worker && worker->pool == this;
 }
 
 ThreadPool::~ThreadPool() {
     for (auto& worker : workers) worker->state = State::Abort;
-    condition.notify_all();
-    workers.clear();  // this will join all threads.
+    notify(true);
+    std::vector<std::unique_ptr<Worker>> toJoin;
+    {
+        std::unique_lock<std::shared_mutex> lock(workers_mutex);
+        std::swap(toJoin, workers);
+    }
+    toJoin.clear();  // this will join all threads.
+}
+
+ThreadPool::Worker*& ThreadPool::currentWorker() {
+    static thread_local Worker* worker = nullptr;
+    return worker;
+}
+
+CancellationToken& ThreadPool::currentTokenRef() {
+    static thread_local CancellationToken token{};
+    return token;
+}
+
+const CancellationToken& ThreadPool::currentToken() { return currentTokenRef(); }
+
+void ThreadPool::run(Task& task) {
+    auto& current = currentTokenRef();
+    // Tasks can be nested when waiting, restore the token of the outer task afterwards
+    auto outer = std::exchange(current, std::move(task.token));
+    try {
+        IVW_TRACE_SCOPE("threadpool", "Task");
+        // Tasks can outlive the evaluation they were started in, keep the representations they use
+        const RepresentationPins pins;
+        task.func();
+    } catch (...) {  // Make sure we don't leak any exceptions.
+    }
+    current = std::move(outer);
 }
 
 ThreadPool::Worker::~Worker() { thread.join(); }
 
 ThreadPool::Worker::Worker(ThreadPool& pool)
-    : state{State::Free}, thread{[this, &pool]() {
+    : state{State::Free}, pool{&pool}, tasks{}, mutex{}, thread{[this, &pool]() {
         util::setThreadDescription("Inviwo Worker Thread");
+        currentWorker() = this;
         pool.onThreadStart_();
-        util::OnScopeExit cleanup{[&pool]() { pool.onThreadStop_(); }};
+        util::OnScopeExit cleanup{[&pool]() {
+            pool.onThreadStop_();
+            currentWorker() = nullptr;
+        }};
 
         for (;;) {
-            std::function<void()> task;
-            state = State::Free;
-            {
-                std::unique_lock<std::mutex> lock(pool.queue_mutex);
-                pool.condition.wait(lock, [this, &pool] {
-                    return state == State::Abort || state == State::Stop || !pool.tasks.empty();
-                });
-                if (state == State::Abort || (state == State::Stop && pool.tasks.empty())) break;
-                task = std::move(pool.tasks.front());
-                pool.tasks.pop();
-            }
-            state = State::Working;
-            try {
-                task();
-            } catch (...) {  // Make sure we don't leak any exceptions.
+            if (state == State::Abort) break;
+
+            Task task;
+            if (pool.pop(this, task)) {
+                auto expected = State::Free;
+                state.compare_exchange_strong(expected, State::Working);
+                run(task);
+                expected = State::Working;
+                state.compare_exchange_strong(expected, State::Free);
+                continue;
             }
+
+            // No tasks anywhere, stop if asked to
+            if (state == State::Stop) break;
+
+            std::unique_lock<std::mutex> lock(pool.queue_mutex);
+            ++pool.sleeping;
+            pool.condition.wait(lock, [this, &pool] {
+                return state == State::Abort || state == State::Stop || pool.queued > 0;
+            });
+            --pool.sleeping;
         }
         state = State::Done;
     }} {}
 
-void ThreadPool::enqueueRaw(std::function<void()> task) {
+void ThreadPool::notify(bool all) {
+    if (sleeping > 0) {
+        // Taking the lock here makes sure that a worker that is about to go to sleep either sees
+        // the new task or is already waiting on the condition when we notify.
+        std::unique_lock<std::mutex> lock(queue_mutex);
+    }
+    if (all) {
+        condition.notify_all();
+    } else {
+        condition.notify_one();
+    }
+}
+
+std::pair<std::deque<ThreadPool::Task>*, std::unique_lock<std::mutex>> ThreadPool::lockQueue(
+    TaskPriority priority) {
+    if (isWorkerThread()) {
+        auto* worker = currentWorker();
+        return {&worker->tasks, std::unique_lock<std::mutex>(worker->mutex)};
+    } else {
+        return {&tasks[static_cast<size_t>(priority)], std::unique_lock<std::mutex>(queue_mutex)};
+    }
+}
+
+void ThreadPool::push(Task task, TaskPriority priority) {
+    // Count the task before it is visible, pop will then never decrement below zero
+    ++queued;
+    {
+        auto [queue, lock] = lockQueue(priority);
+        queue->push_back(std::move(task));
+    }
+    notify(false);
+}
+
+void ThreadPool::wait(const Latch& latch) {
+    if (!isWorkerThread()) {
+        latch.wait();
+        return;
+    }
+    while (!latch.isReady()) {
+        // Nothing to help with, block for a while but wake up regularly to look for new tasks
+        if (!runPendingTask()) latch.waitFor(std::chrono::milliseconds{1});
+    }
+}
+
+bool ThreadPool::popShared(TaskPriority priority, Task& task) {
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    auto& queue = tasks[static_cast<size_t>(priority)];
+    if (queue.empty()) return false;
+    task = std::move(queue.front());
+    queue.pop_front();
+    --queued;
+    return true;
+}
+
+bool ThreadPool::pop(Worker* self, Task& task) {
+    if (queued == 0) return false;
+
+    if (popShared(TaskPriority::Interactive, task)) return true;
+
+    if (self) {
+        std::unique_lock<std::mutex> lock(self->mutex);
+        if (!self->tasks.empty()) {
+            task = std::move(self->tasks.back());
+            self->tasks.pop_back();
+            --queued;
+            return true;
+        }
+    }
+    if (popShared(TaskPriority::Normal, task)) return true;
+    if (popShared(TaskPriority::Background, task)) return true;
+    {
+        std::shared_lock<std::shared_mutex> workersLock(workers_mutex);
+        // Start at a different victim for each thread to spread out the contention.
+        static thread_local size_t victim = 0;
+        const auto size = workers.size();
+        for (size_t i = 0; i < size; ++i) {
+            auto& other = workers[(victim + i) % size];
+            if (other.get() == self) continue;
+            std::unique_lock<std::mutex> lock(other->mutex);
+            if (!other->tasks.empty()) {
+                task = std::move(other->tasks.front());
+                other->tasks.pop_front();
+                --queued;
+                victim = (victim + i) % size;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::runPendingTask() {
+    if (!isWorkerThread()) return false;
+
+    Task task;
+    if (!pop(currentWorker(), task)) return false;
+    run(task);
+    return true;
+}
+
+void ThreadPool::enqueueRaw(TaskFunction func, TaskPriority priority,
+                            CancellationToken token) {
+    Task task{std::move(func), std::move(token)};
     if (workers.empty()) {
-        task();  // No worker threads, just run the task.
+        run(task);  // No worker threads, just run the task.
     } else {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace(std::move(task));
+        push(std::move(task), priority);
     }
-    condition.notify_one();
 }
 
 }  // namespace inviwo
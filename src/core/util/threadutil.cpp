@@ -30,6 +30,7 @@
 #include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/util/tracerecorder.h>
 
 #ifdef WIN32
 #include <windows.h>
@@ -61,6 +62,7 @@ void util::setThreadDescription(const std::string& desc) {
 #else
     pthread_setname_np(pthread_self(), desc.c_str());
 #endif
+    TraceRecorder::setThreadName(desc);
 }
 
 ThreadPool& util::getThreadPool() { return getThreadPool(InviwoApplication::getPtr()); }
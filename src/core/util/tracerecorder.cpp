@@ -0,0 +1,234 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/util/tracerecorder.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/filesystem.h>
+
+#include <fmt/format.h>
+
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace inviwo {
+
+std::atomic<bool> TraceRecorder::enabled_{false};
+
+namespace {
+
+// Time stamps are written relative to the time the library was loaded
+const TraceRecorder::Clock::time_point epoch = TraceRecorder::Clock::now();
+
+struct Event {
+    char phase;
+    const char* category;
+    std::string name;
+    TraceRecorder::Clock::time_point start;
+    TraceRecorder::Clock::duration duration;
+    const void* id;
+};
+
+/**
+ * The events of a single thread. The mutex is only contended while writing or clearing.
+ */
+struct ThreadEvents {
+    std::mutex mutex;
+    std::vector<Event> events;
+    std::string name;
+    size_t tid = 0;
+};
+
+struct Registry {
+    std::mutex mutex;
+    // Kept alive after the thread exits to not loose its events.
+    std::vector<std::shared_ptr<ThreadEvents>> threads;
+
+    static Registry& get() {
+        static Registry registry;
+        return registry;
+    }
+};
+
+// The name set with setThreadName before the thread recorded any events
+thread_local std::string pendingThreadName;
+thread_local bool hasThreadEvents = false;
+
+ThreadEvents& threadEvents() {
+    thread_local std::shared_ptr<ThreadEvents> local = []() {
+        auto& registry = Registry::get();
+        auto events = std::make_shared<ThreadEvents>();
+        std::scoped_lock lock{registry.mutex};
+        events->tid = registry.threads.size() + 1;
+        events->name = pendingThreadName.empty() ? fmt::format("Thread {}", events->tid)
+                                                 : std::move(pendingThreadName);
+        registry.threads.push_back(events);
+        hasThreadEvents = true;
+        return events;
+    }();
+    return *local;
+}
+
+void record(Event&& event) {
+    auto& thread = threadEvents();
+    std::scoped_lock lock{thread.mutex};
+    thread.events.push_back(std::move(event));
+}
+
+void writeEscaped(std::ostream& os, std::string_view str) {
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    os << fmt::format("\\u{:04x}", static_cast<int>(c));
+                } else {
+                    os << c;
+                }
+        }
+    }
+}
+
+}  // namespace
+
+void TraceRecorder::setEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void TraceRecorder::complete(const char* category, std::string name, Clock::time_point start,
+                             Clock::time_point end) {
+    if (!isEnabled()) return;
+    record(Event{'X', category, std::move(name), start, end - start, nullptr});
+}
+
+void TraceRecorder::asyncBegin(const char* category, std::string name, const void* id) {
+    if (!isEnabled()) return;
+    record(Event{'b', category, std::move(name), Clock::now(), Clock::duration{0}, id});
+}
+
+void TraceRecorder::asyncEnd(const char* category, std::string name, const void* id) {
+    if (!isEnabled()) return;
+    record(Event{'e', category, std::move(name), Clock::now(), Clock::duration{0}, id});
+}
+
+void TraceRecorder::setThreadName(std::string_view name) {
+    if (!isEnabled() && !hasThreadEvents) {
+        pendingThreadName = name;
+        return;
+    }
+    auto& thread = threadEvents();
+    std::scoped_lock lock{thread.mutex};
+    thread.name = name;
+}
+
+size_t TraceRecorder::size() {
+    auto& registry = Registry::get();
+    std::scoped_lock lock{registry.mutex};
+    size_t count = 0;
+    for (auto& thread : registry.threads) {
+        std::scoped_lock threadLock{thread->mutex};
+        count += thread->events.size();
+    }
+    return count;
+}
+
+void TraceRecorder::clear() {
+    auto& registry = Registry::get();
+    std::scoped_lock lock{registry.mutex};
+    for (auto& thread : registry.threads) {
+        std::scoped_lock threadLock{thread->mutex};
+        thread->events.clear();
+    }
+}
+
+void TraceRecorder::write(std::ostream& os) {
+    using us = std::chrono::duration<double, std::micro>;
+
+    auto& registry = Registry::get();
+    std::scoped_lock lock{registry.mutex};
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    const auto separator = [&]() {
+        if (!first) os << ",";
+        first = false;
+        os << "\n";
+    };
+
+    for (auto& thread : registry.threads) {
+        std::scoped_lock threadLock{thread->mutex};
+
+        separator();
+        os << R"({"ph":"M","name":"thread_name","pid":1,"tid":)" << thread->tid
+           << R"(,"args":{"name":")";
+        writeEscaped(os, thread->name);
+        os << "\"}}";
+
+        for (const auto& event : thread->events) {
+            separator();
+            os << R"({"ph":")" << event.phase << R"(","cat":")";
+            writeEscaped(os, event.category);
+            os << R"(","name":")";
+            writeEscaped(os, event.name);
+            os << R"(","pid":1,"tid":)" << thread->tid << R"(,"ts":)"
+               << fmt::format("{:.3f}", us{event.start - epoch}.count());
+            if (event.phase == 'X') {
+                os << R"(,"dur":)" << fmt::format("{:.3f}", us{event.duration}.count());
+            } else {
+                os << R"(,"id":")" << event.id << "\"";
+            }
+            os << "}";
+        }
+    }
+    os << "\n]}\n";
+}
+
+void TraceRecorder::write(std::string_view filename) {
+    auto file = filesystem::ofstream(filename);
+    if (!file) {
+        throw FileException(IVW_CONTEXT_CUSTOM("TraceRecorder"), "Could not open file {}",
+                            filename);
+    }
+    write(file);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,177 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+
+#include <inviwo/core/util/volumesequenceprefetcher.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <chrono>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace inviwo {
+
+struct VolumeSequencePrefetcher::State {
+    std::mutex mutex;
+    std::map<size_t, std::shared_ptr<const VolumeRAM>> held;
+    std::set<size_t> loading;
+    std::set<size_t> wanted;
+};
+
+VolumeSequencePrefetcher::VolumeSequencePrefetcher(size_t ahead, size_t budget)
+    : ahead_{ahead}, budget_{budget}, state_{std::make_shared<State>()} {}
+
+VolumeSequencePrefetcher::~VolumeSequencePrefetcher() { cancel_.cancel(); }
+
+void VolumeSequencePrefetcher::setAhead(size_t steps) {
+    if (ahead_ == steps) return;
+    ahead_ = steps;
+    if (last_) update(*last_);
+}
+
+void VolumeSequencePrefetcher::setBudget(size_t bytes) {
+    if (budget_ == bytes) return;
+    budget_ = bytes;
+    if (last_) update(*last_);
+}
+
+void VolumeSequencePrefetcher::setSequence(std::shared_ptr<const VolumeSequence> sequence) {
+    if (sequence_ == sequence) return;
+    clear();
+    sequence_ = std::move(sequence);
+    last_.reset();
+    stride_ = 1;
+}
+
+void VolumeSequencePrefetcher::update(size_t index) {
+    if (!sequence_ || index >= sequence_->size()) return;
+    const auto size = static_cast<std::ptrdiff_t>(sequence_->size());
+    const auto current = static_cast<std::ptrdiff_t>(index);
+
+    // Extrapolate the playback, taking the shorter way around the sequence
+    if (last_ && *last_ != index) {
+        const auto forward = (current - static_cast<std::ptrdiff_t>(*last_) + size) % size;
+        stride_ = forward <= size / 2 ? forward : forward - size;
+    }
+    last_ = index;
+
+    std::vector<size_t> window;
+    size_t bytes = 0;
+    for (size_t i = 1; i <= ahead_; ++i) {
+        const auto offset = static_cast<std::ptrdiff_t>(i) * stride_ % size;
+        const auto step = static_cast<size_t>((current + offset + size) % size);
+        if (step == index || util::contains(window, step)) break;
+        const auto& volume = (*sequence_)[step];
+        if (!volume) continue;
+        const auto dims = volume->getDimensions();
+        const auto stepBytes = dims.x * dims.y * dims.z * volume->getDataFormat()->getSize();
+        if (budget_ != 0 && bytes + stepBytes > budget_) break;
+        bytes += stepBytes;
+        window.push_back(step);
+    }
+
+    std::erase_if(pending_, [](const std::future<void>& f) {
+        return f.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+    });
+
+    // Released representations are destroyed outside of the lock
+    std::vector<std::shared_ptr<const VolumeRAM>> released;
+    std::scoped_lock lock{state_->mutex};
+    state_->wanted = std::set<size_t>(window.begin(), window.end());
+    for (auto it = state_->held.begin(); it != state_->held.end();) {
+        if (state_->wanted.contains(it->first)) {
+            ++it;
+        } else {
+            released.push_back(std::move(it->second));
+            it = state_->held.erase(it);
+        }
+    }
+
+    for (const auto step : window) {
+        if (state_->held.contains(step) || state_->loading.contains(step)) continue;
+        auto volume = (*sequence_)[step];
+        if (volume->hasValidRepresentation<VolumeRAM>()) {
+            state_->held[step] = volume->getRepresentationShared<VolumeRAM>();
+            continue;
+        }
+        if (util::getPoolSize() == 0) continue;
+
+        state_->loading.insert(step);
+        pending_.push_back(util::dispatchPool(
+            TaskPriority::Background, cancel_.getToken(),
+            [state = state_, volume = std::move(volume), step, token = cancel_.getToken()]() {
+                std::shared_ptr<const VolumeRAM> ram;
+                if (!token.isCancelled()) {
+                    try {
+                        const bool wanted = [&]() {
+                            std::scoped_lock lock{state->mutex};
+                            return state->wanted.contains(step);
+                        }();
+                        if (wanted) ram = volume->getRepresentationShared<VolumeRAM>();
+                    } catch (const std::exception& e) {
+                        LogWarnCustom("VolumeSequencePrefetcher",
+                                      "Failed to prefetch step " << step + 1 << ": " << e.what());
+                    }
+                }
+                std::scoped_lock lock{state->mutex};
+                state->loading.erase(step);
+                if (ram && state->wanted.contains(step)) state->held[step] = std::move(ram);
+            }));
+    }
+}
+
+void VolumeSequencePrefetcher::clear() {
+    cancel_.cancel();
+    cancel_ = CancellationSource{};
+    // Pending loads finish against the old state and release their result there
+    state_ = std::make_shared<State>();
+    pending_.clear();
+}
+
+void VolumeSequencePrefetcher::wait() {
+    for (auto& f : pending_) f.wait();
+    pending_.clear();
+}
+
+std::vector<size_t> VolumeSequencePrefetcher::getPrefetched() const {
+    std::scoped_lock lock{state_->mutex};
+    std::vector<size_t> steps;
+    for (const auto& item : state_->held) steps.push_back(item.first);
+    return steps;
+}
+
+}  // namespace inviwo
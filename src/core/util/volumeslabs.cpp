@@ -0,0 +1,99 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/volumeslabs.h>
+#include <inviwo/core/datastructures/residencymanager.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+bool util::canStreamSlabs(const Volume& volume) {
+    return volume.hasValidRepresentation<VolumeDisk>() &&
+           volume.getRepresentation<VolumeDisk>()->canReadRegion();
+}
+
+bool util::shouldStreamSlabs(const Volume& volume) {
+    if (!ResidencyManager::isEnabled() || volume.hasValidRepresentation<VolumeRAM>()) {
+        return false;
+    }
+    const auto bytes = glm::compMul(volume.getDimensions()) * volume.getDataFormat()->getSize();
+    return bytes > ResidencyManager::getBudget() && canStreamSlabs(volume);
+}
+
+size_t util::slabDepth(const Volume& volume, size_t bytes) {
+    const auto dims = volume.getDimensions();
+    const auto layerBytes =
+        std::max(size_t{1}, dims.x * dims.y * volume.getDataFormat()->getSize());
+    return std::clamp(bytes / layerBytes, size_t{1}, std::max(size_t{1}, dims.z));
+}
+
+void util::forEachVolumeSlab(const Volume& volume, size_t depth, size_t halo,
+                             const std::function<void(const VolumeSlab&)>& callback,
+                             const CancellationToken& token) {
+    const auto dims = volume.getDimensions();
+    if (dims.z == 0 || token.isCancelled()) return;
+
+    if (!canStreamSlabs(volume)) {
+        callback(VolumeSlab{volume.getRepresentationShared<VolumeRAM>(), 0, dims.z, 0});
+        return;
+    }
+
+    depth = std::max(depth, size_t{1});
+    const auto read = [disk = volume.getRepresentationShared<VolumeDisk>(), dims, depth,
+                       halo](size_t z) {
+        const auto begin = z - std::min(z, halo);
+        const auto end = std::min(dims.z, z + depth + halo);
+        auto ram = disk->readRegion(size3_t{0, 0, begin}, size3_t{dims.x, dims.y, end - begin});
+        return VolumeSlab{std::move(ram), z, std::min(depth, dims.z - z), z - begin};
+    };
+
+    // Read ahead on the thread pool. When called from a pool task, wait by helping with other
+    // tasks, such that a busy pool can not block the read.
+    auto& pool = util::getThreadPool();
+    auto next = util::dispatchPool(read, size_t{0});
+    for (size_t z = 0; z < dims.z; z += depth) {
+        pool.wait(next);
+        const auto slab = next.get();
+        if (token.isCancelled()) return;
+        if (z + depth < dims.z) {
+            next = util::dispatchPool(read, z + depth);
+        }
+        callback(slab);
+    }
+}
+
+}  // namespace inviwo
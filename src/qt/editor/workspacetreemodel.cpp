@@ -115,7 +115,10 @@ void WorkspaceInfoLoader::operator()() {
 }
 
 void WorkspaceInfoLoader::submit() {
-    std::call_once(flag_, [&]() { app_->dispatchPool([l = shared_from_this()]() { (*l)(); }); });
+    std::call_once(flag_, [&]() {
+        app_->getThreadPool().enqueueRaw([l = shared_from_this()]() { (*l)(); },
+                                         TaskPriority::Background);
+    });
 }
 
 TreeItem::TreeItem(TreeItem* parent)